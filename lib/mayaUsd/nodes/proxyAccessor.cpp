@@ -35,6 +35,7 @@
 #include <maya/MArrayDataBuilder.h>
 #include <maya/MArrayDataHandle.h>
 #include <maya/MDGContext.h>
+#include <maya/MDGModifier.h>
 #include <maya/MDagPath.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
@@ -49,6 +50,7 @@
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -364,6 +366,7 @@ void ProxyAccessor::collectAccessorItems(MObject node)
         kAccessorProfilerCategory, MProfiler::kColorB_L1, "Generate acceleration structure");
 
     _accessorInputItems.clear();
+    _accessorInputIndex.clear();
     _accessorOutputItems.clear();
 
     _validAccessorItems = true;
@@ -454,6 +457,11 @@ void ProxyAccessor::collectAccessorItems(MObject node)
                         item.path.GetText());
             } else {
                 TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Added INPUT '%s'\n", item.path.GetText());
+                if (!item.property.IsEmpty()) {
+                    // First item wins when several plugs access the same property
+                    _accessorInputIndex.emplace(
+                        item.path.AppendProperty(item.property), _accessorInputItems.size());
+                }
                 _accessorInputItems.emplace_back(item);
             }
         } else {
@@ -768,53 +776,66 @@ MStatus ProxyAccessor::stageChanged(const MObject& node, const UsdNotice::Object
 
     bool needsForceCompute = true;
 
-    if (_accessorInputItems.size() > 0) {
-        auto findInputItemFn = [this](const SdfPath& changedPath) -> Item* {
-            for (Item& item : _accessorInputItems) {
-                if (item.path == changedPath
-                    || item.path.AppendProperty(item.property) == changedPath) {
-                    return &item;
-                }
-            }
-            return nullptr;
-        };
-
-        // UFE currently doesn't write time sampled data.
-        ConverterArgs args;
-        args._timeCode = UsdTimeCode::Default(); // getTime();
+    if (_accessorInputIndex.size() > 0) {
+        MProfilingScope profilingScope(
+            kAccessorProfilerCategory, MProfiler::kColorB_L1, "Apply stage changes to inputs");
 
+        std::vector<Item*> changedInputs;
         for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
-            if (changedPath.IsPrimPropertyPath()) {
-                Item* changedInput = findInputItemFn(changedPath);
-                if (!changedInput) {
-                    TF_DEBUG(USDMAYA_PROXYACCESSOR)
-                        .Msg(
-                            "Input has changed but not found in input list '%s'\n",
-                            changedPath.GetText());
-                    continue;
-                }
+            if (!changedPath.IsPrimPropertyPath())
+                continue;
 
+            auto found = _accessorInputIndex.find(changedPath);
+            if (found == _accessorInputIndex.end()) {
                 TF_DEBUG(USDMAYA_PROXYACCESSOR)
-                    .Msg("Input PrimPropertyPath has changed '%s'\n", changedPath.GetText());
+                    .Msg(
+                        "Input has changed but not found in input list '%s'\n",
+                        changedPath.GetText());
+                continue;
+            }
+
+            TF_DEBUG(USDMAYA_PROXYACCESSOR)
+                .Msg("Input PrimPropertyPath has changed '%s'\n", changedPath.GetText());
 
-                MPlug&           changedPlug = changedInput->plug;
-                const Converter* converter = changedInput->converter;
+            changedInputs.push_back(&_accessorInputItems[found->second]);
+        }
 
-                SdfPath        changedPrimPath = changedPath.GetAbsoluteRootOrPrimPath();
-                const UsdPrim& changedPrim = stage->GetPrimAtPath(changedPrimPath);
+        if (!changedInputs.empty()) {
+            // Group the changed inputs per prim, so that each prim is only looked up once
+            std::sort(changedInputs.begin(), changedInputs.end(), [](const Item* a, const Item* b) {
+                return a->path < b->path;
+            });
+
+            // UFE currently doesn't write time sampled data.
+            ConverterArgs args;
+            args._timeCode = UsdTimeCode::Default(); // getTime();
+
+            // Plug values are set in a single modifier, so that plugs get dirtied in one pass
+            // instead of once per changed property.
+            MDGModifier modifier;
+            SdfPath     changedPrimPath;
+            UsdPrim     changedPrim;
+            for (Item* changedInput : changedInputs) {
+                if (changedInput->path != changedPrimPath) {
+                    changedPrimPath = changedInput->path;
+                    changedPrim = stage->GetPrimAtPath(changedPrimPath);
+                }
+                if (!changedPrim)
+                    continue;
 
-                const TfToken&       changedPropertyToken = changedPath.GetNameToken();
                 PXR_NS::UsdAttribute changedAttribute
-                    = changedPrim.GetAttribute(changedPropertyToken);
+                    = changedPrim.GetAttribute(changedInput->property);
 
-                converter->convert(changedAttribute, changedPlug, args);
-
-                // When input plug is set, this value may be a new constant or
-                // just temporary value overriding what comes from animation curve.
-                // Input value change will properly cause outputs to compute so
-                // forcing compute is not necessary (and it destructive for temporary values)
-                needsForceCompute = false;
+                changedInput->converter->convert(
+                    changedAttribute, changedInput->plug, modifier, args);
             }
+            modifier.doIt();
+
+            // When input plug is set, this value may be a new constant or
+            // just temporary value overriding what comes from animation curve.
+            // Input value change will properly cause outputs to compute so
+            // forcing compute is not necessary (and it destructive for temporary values)
+            needsForceCompute = false;
         }
     }
 
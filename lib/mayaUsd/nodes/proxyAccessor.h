@@ -39,6 +39,7 @@
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 class UsdGeomXformCache;
@@ -205,6 +206,8 @@ private:
         SyncId           syncId;
     };
     using Container = std::vector<Item>;
+    //! \brief  Index of items in a container, keyed by the path of the USD property
+    using PropertyIndex = std::unordered_map<SdfPath, size_t, SdfPath::Hash>;
 
     ProxyAccessor(ProxyStageProvider& provider)
         : _stageProvider(provider)
@@ -274,6 +277,8 @@ private:
 
     //! \brief  Acceleration structure holding all input accessor plugs
     Container _accessorInputItems;
+    //! \brief  Lookup of input accessor plugs by property path, used on stage changes
+    PropertyIndex _accessorInputIndex;
     //! \brief  Acceleration structure holding all output accessor plugs
     Container _accessorOutputItems;
 
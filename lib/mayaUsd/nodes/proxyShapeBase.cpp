@@ -37,6 +37,7 @@
 #include <mayaUsd/utils/utilFileSystem.h>
 #include <mayaUsd/utils/variantFallbacks.h>
 
+#include <usdUfe/utils/bboxCacheService.h>
 #include <usdUfe/utils/layers.h>
 
 #include <pxr/base/gf/bbox3d.h>
@@ -1681,22 +1682,24 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
     bool drawRenderPurpose = false;
     bool drawProxyPurpose = true;
     bool drawGuidePurpose = false;
     _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
 
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 = drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 = drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 = drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose)
+        purposes.push_back(UsdGeomTokens->render);
+    if (drawProxyPurpose)
+        purposes.push_back(UsdGeomTokens->proxy);
+    if (drawGuidePurpose)
+        purposes.push_back(UsdGeomTokens->guide);
 
     // Compute the bound in "Usd World" space. This will apply the transform the
-    // referenced prim may have relative to the root of its Usd scene
+    // referenced prim may have relative to the root of its Usd scene. Use the
+    // shared cache so the bounds computed by UFE queries are reused.
     GfBBox3d allBox
-        = imageablePrim.ComputeWorldBound(currTime, purpose1, purpose2, purpose3, purpose4);
+        = UsdUfe::BBoxCacheService::instance().computeWorldBound(prim, currTime, purposes);
 
     UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
 
@@ -2036,6 +2039,8 @@ UsdStageRefPtr MayaUsdProxyShapeBase::getUsdStage() const
 
 size_t MayaUsdProxyShapeBase::getUsdStageVersion() const { return _UsdStageVersion; }
 
+MInt64 MayaUsdProxyShapeBase::getUsdStageUpdateCounter() const { return _UsdStageUpdateCounter; }
+
 void MayaUsdProxyShapeBase::getDrawPurposeToggles(
     bool* drawRenderPurpose,
     bool* drawProxyPurpose,
@@ -249,6 +249,8 @@ public:
     MAYAUSD_CORE_PUBLIC
     size_t getUsdStageVersion() const;
     MAYAUSD_CORE_PUBLIC
+    MInt64 getUsdStageUpdateCounter() const;
+    MAYAUSD_CORE_PUBLIC
     void getDrawPurposeToggles(
         bool* drawRenderPurpose,
         bool* drawProxyPurpose,
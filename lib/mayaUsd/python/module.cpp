@@ -49,6 +49,7 @@ TF_WRAP_MODULE
     TF_WRAP(TranslatorUtil);
     TF_WRAP(UsdUndoManager);
     TF_WRAP(UserTaggedAttribute);
+    TF_WRAP(VP2ResourceRegistry);
     TF_WRAP(WriteUtil);
     TF_WRAP(Util);
     TF_WRAP(XformStack);
@@ -153,5 +153,7 @@ void wrapConverter()
         .def("convertVt", convertMPlugToVtValue)
         .def("convertVt", convertVtValueToMPlug)
         .def("test_convertAndSetWithModifier", test_convertUsdAttrToMDGModifier)
-        .def("test_convertVtAndSetWithModifier", test_convertVtValueToMDGModifier);
+        .def("test_convertVtAndSetWithModifier", test_convertVtValueToMDGModifier)
+        .def("test_getLookupCacheHitCount", &This::getLookupCacheHitCount)
+        .staticmethod("test_getLookupCacheHitCount");
 }
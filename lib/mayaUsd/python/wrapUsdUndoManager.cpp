@@ -88,7 +88,8 @@ void wrapUsdUndoManager()
     {
         class_<UsdUfe::UsdUndoableItem>("UsdUndoableItem")
             .def("undo", &UsdUfe::UsdUndoableItem::undo)
-            .def("redo", &UsdUfe::UsdUndoableItem::redo);
+            .def("redo", &UsdUfe::UsdUndoableItem::redo)
+            .def("getEditCount", &UsdUfe::UsdUndoableItem::getEditCount);
     }
 
     // UsdUndoBlock
@@ -0,0 +1,28 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/render/vp2RenderDelegate/resourceRegistry.h>
+
+#include <pxr/pxr.h>
+#include <pxr_python.h>
+
+using namespace PXR_BOOST_PYTHON_NAMESPACE;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+void wrapVP2ResourceRegistry()
+{
+    def("GetVP2SyncMayaAccessCount", &HdVP2ResourceRegistry::GetSyncMayaAccessCount);
+}
@@ -16,6 +16,7 @@
 //
 #include "basisCurves.h"
 
+#include "basisCurvesIndices.h"
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "drawItem.h"
@@ -39,6 +40,9 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <algorithm>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -57,288 +61,85 @@ VtArray<T> InterpolateVarying(
 {
     VtArray<T> outputValues(numVerts);
 
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
-
     if (wrap == HdTokens->periodic) {
         // XXX : Add support for periodic curves
         TF_WARN("Varying data is only supported for non-periodic curves.");
     }
 
-    TF_FOR_ALL(itVertexCount, vertexCounts)
-    {
-        int nVerts = *itVertexCount;
+    const bool isSpline = basis == HdTokens->catmullRom || basis == HdTokens->bSpline;
+    if (!isSpline && basis != HdTokens->bezier) {
+        TF_WARN("Unsupported basis: '%s'", basis.GetText());
+        return outputValues;
+    }
 
+    // For splines with a vstep of 1, we are doing linear interpolation between
+    // segments, so all we do here is duplicate the first and last values. Since
+    // these are never acutally used during drawing, it would also work just to
+    // set them to 0.
+    //
+    // For bezier splines, we map the linear values to cubic values: the begin
+    // value gets mapped to the first two vertices and the end value gets mapped
+    // to the last two vertices in a segment, and the vstep - 1 inner control
+    // points of a segment have the interpolated value. Shaders can choose to
+    // access value[1] and value[2] when linearly interpolating a value, which
+    // happens to match up with the indexing to use for catmullRom and bSpline
+    // basis.
+    auto curveSizes = [isSpline](int nVerts) -> HdVP2BasisCurvesIndices::CurveOffsets {
         // Handling for the case of potentially incorrect vertex counts
         if (nVerts < 1) {
-            continue;
+            return { 0, 0 };
         }
-
-        if (basis == HdTokens->catmullRom || basis == HdTokens->bSpline) {
-            // For splines with a vstep of 1, we are doing linear interpolation
-            // between segments, so all we do here is duplicate the first and
-            // last outputValues. Since these are never acutally used during
-            // drawing, it would also work just to set the to 0.
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            for (int i = 1; i < nVerts - 2; ++i) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex;
-                ++srcIndex;
-            }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-        } else if (basis == HdTokens->bezier) {
-            // For bezier splines, we map the linear values to cubic values
-            // the begin value gets mapped to the first two vertices and
-            // the end value gets mapped to the last two vertices in a segment.
-            // shaders can choose to access value[1] and value[2] when linearly
-            // interpolating a value, which happens to match up with the
-            // indexing to use for catmullRom and bSpline basis.
-            int vStep = 3;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-
-            // vstep - 1 control points will have an interpolated value
-            for (int i = 2; i < nVerts - 2; i += vStep) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex;
-                ++srcIndex;
-            }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            ++srcIndex;
-        } else {
-            TF_WARN("Unsupported basis: '%s'", basis.GetText());
+        if (isSpline) {
+            const size_t inner = std::max(nVerts - 3, 0);
+            return { inner + 1, inner + 3 };
         }
-    }
-    TF_VERIFY(srcIndex == authoredValues.size());
-    TF_VERIFY(dstIndex == numVerts);
+        const size_t segments = std::max((nVerts - 2) / 3, 0);
+        return { segments + 2, 3 * segments + 4 };
+    };
 
-    return outputValues;
-}
+    std::vector<HdVP2BasisCurvesIndices::CurveOffsets> offsets;
+    HdVP2BasisCurvesIndices::ComputeCurveOffsets(vertexCounts, curveSizes, offsets);
 
-VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
-{
-    /*
-    Here's a diagram of what's happening in this code:
-
-    For open (non periodic, wrap = false) curves:
-
-      bezier (vStep = 3)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-                           [======= seg1 =======]
-
-
-      bspline / catmullRom (vStep = 1)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-             [======= seg1 =======]
-                    [======= seg2 =======]
-                           [======= seg3 =======]
-
-
-    For closed (periodic, wrap = true) curves:
-
-       periodic bezier (vStep = 3)
-       0------1------2------3------4------5------0 (vertex index)
-       [======= seg0 =======]
-                            [======= seg1 =======]
-
-
-       periodic bspline / catmullRom (vStep = 1)
-       0------1------2------3------4------5------0------1------2 (vertex index)
-       [======= seg0 =======]
-              [======= seg1 =======]
-                     [======= seg2 =======]
-                            [======= seg3 =======]
-                                   [======= seg4 =======]
-                                          [======= seg5 =======]
-    */
-    std::vector<GfVec4i> indices;
-
-    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
-    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                vStep;
-    TfToken            basis = topology.GetCurveBasis();
-    if (basis == HdTokens->bezier) {
-        vStep = 3;
-    } else {
-        vStep = 1;
+    // Don't write past the output when the vertex counts don't match.
+    if (!TF_VERIFY(offsets.back().src == authoredValues.size())
+        || !TF_VERIFY(offsets.back().dst == numVerts)) {
+        return outputValues;
     }
 
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int count = *itCounts;
-        // The first segment always eats up 4 verts, not just vstep, so to
-        // compensate, we break at count - 3.
-        int numSegs;
-
-        // If we're closing the curve, make sure that we have enough
-        // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for (int i = 0; i < numSegs; ++i) {
+    const T* src = authoredValues.cdata();
+    T*       dst = outputValues.data();
 
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int     offset = i * vStep;
-            for (int v = 0; v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
-                              : vertexIndex + std::min(offset + v, (count - 1));
+    HdVP2BasisCurvesIndices::ParallelForCurves(vertexCounts.size(), [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            const T* curveSrc = src + offsets[curve].src;
+            const T* curveSrcEnd = src + offsets[curve + 1].src;
+            T*       curveDst = dst + offsets[curve].dst;
+            if (curveSrc == curveSrcEnd) {
+                continue;
             }
-            indices.push_back(seg);
-        }
-        vertexIndex += count;
-    }
-
-    VtVec4iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec4i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
-{
-    std::vector<GfVec2i> indices;
-    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        for (int i = 0; i < *itCounts; i += 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
 
-VtValue _BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
-{
-    const TfToken basis = topology.GetCurveBasis();
-    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
-
-    std::vector<GfVec2i> indices;
-    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
-    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                  vertexIndex = 0; // Index of next vertex to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++vertexIndex;
-        for (int i = 1; i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
-                indices.push_back(GfVec2i(v0, v1));
+            if (isSpline) {
+                *curveDst++ = *curveSrc;
+                while (curveSrc != curveSrcEnd - 1) {
+                    *curveDst++ = *curveSrc++;
+                }
+                *curveDst++ = *curveSrc;
+                *curveDst = *curveSrc;
+            } else {
+                *curveDst++ = *curveSrc;
+                *curveDst++ = *curveSrc++;
+                while (curveSrc != curveSrcEnd - 1) {
+                    *curveDst++ = *curveSrc;
+                    *curveDst++ = *curveSrc;
+                    *curveDst++ = *curveSrc++;
+                }
+                *curveDst++ = *curveSrc;
+                *curveDst = *curveSrc;
             }
-            v0 = v1;
-        }
-        if (wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
         }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
+    });
 
-    return VtValue(finalIndices);
+    return outputValues;
 }
 
 template <typename BaseType>
@@ -349,36 +150,27 @@ VtArray<BaseType> _BuildInterpolatedArray(
 {
     // We need to interpolate primvar depending on its type
     size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
-
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
+    size_t size = authoredData.size();
 
     if (size == 1) {
         // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
+        return VtArray<BaseType>(numVerts, authoredData[0]);
     } else if (size == numVerts) {
-        // Vertex data
-        result = authoredData;
+        // Vertex data, shared without copy
+        return authoredData;
     } else if (size == topology.CalculateNeededNumberOfVaryingControlPoints()) {
         // Varying data
-        result = InterpolateVarying<BaseType>(
+        return InterpolateVarying<BaseType>(
             numVerts,
             topology.GetCurveVertexCounts(),
             topology.GetCurveWrap(),
             topology.GetCurveBasis(),
             authoredData);
-    } else {
-        // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
-        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
     }
 
-    return result;
+    // Fallback
+    TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+    return VtArray<BaseType>(numVerts, defaultValue);
 }
 } // anonymous namespace
 
@@ -408,6 +200,8 @@ void HdVP2BasisCurves::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
+    HdVP2ResourceRegistry::SyncScope syncScope;
+
     if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
         return;
     }
@@ -450,6 +244,8 @@ void HdVP2BasisCurves::Sync(
 
     if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
         _curvesSharedData._topology = GetBasisCurvesTopology(delegate);
+        _curvesSharedData._indexArrays.fill(VtIntArray());
+        _curvesSharedData._indexArraysBuilt.fill(false);
     }
 
     // Prepare position buffer. It is shared among all draw items so it should
@@ -567,33 +363,38 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
         const bool forceLines = (refineLevel <= 0) || (drawMode & MHWRender::MGeometry::kWireframe);
 
-        VtValue result;
-
+        HdVP2BasisCurvesSharedData::IndexArrayKind kind;
         if (!forceLines && type == HdTokens->cubic) {
-            result = _BuildCubicIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kCubicIndices;
         } else if (wrap == HdTokens->segmented) {
-            result = _BuildLinesIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kLinesIndices;
         } else {
-            result = _BuildLineSegmentIndexArray(topology);
+            kind = HdVP2BasisCurvesSharedData::kLineSegmentIndices;
         }
 
-        const void*  indexData = nullptr;
-        unsigned int numIndices = 0;
-
-        if (result.IsHolding<VtVec2iArray>()) {
-            indexData = result.UncheckedGet<VtVec2iArray>().cdata();
-            numIndices = result.GetArraySize() * 2;
-        } else if (result.IsHolding<VtVec4iArray>()) {
-            indexData = result.UncheckedGet<VtVec4iArray>().cdata();
-            numIndices = result.GetArraySize() * 4;
+        // The draw items of the Rprim are updated one after the other, the first one
+        // needing this kind of indices builds them for the others.
+        VtIntArray& indices = _curvesSharedData._indexArrays[kind];
+        if (!_curvesSharedData._indexArraysBuilt[kind]) {
+            _curvesSharedData._indexArraysBuilt[kind] = true;
+            switch (kind) {
+            case HdVP2BasisCurvesSharedData::kCubicIndices:
+                indices = HdVP2BasisCurvesIndices::BuildCubicIndexArray(topology);
+                break;
+            case HdVP2BasisCurvesSharedData::kLinesIndices:
+                indices = HdVP2BasisCurvesIndices::BuildLinesIndexArray(topology);
+                break;
+            default: indices = HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(topology); break;
+            }
         }
 
+        const unsigned int numIndices = indices.size();
         if (drawItemData._indexBuffer && numIndices > 0) {
             stateToCommit._indexBufferData
                 = static_cast<int*>(drawItemData._indexBuffer->acquire(numIndices, true));
 
-            if (indexData != nullptr && stateToCommit._indexBufferData != nullptr) {
-                memcpy(stateToCommit._indexBufferData, indexData, numIndices * sizeof(int));
+            if (stateToCommit._indexBufferData != nullptr) {
+                memcpy(stateToCommit._indexBufferData, indices.cdata(), numIndices * sizeof(int));
             }
         }
     }
@@ -670,9 +471,12 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
             unsigned int numWidths = widths.size();
             if (widthsBuffer && numWidths > 0) {
-                auto& bufferData = stateToCommit._primvarBufferDataMap[HdTokens->widths];
-                bufferData.resize(numWidths * sizeof(float));
-                memcpy(&bufferData[0], widths.cdata(), numWidths * sizeof(float));
+                const size_t numBytes = numWidths * sizeof(float);
+                void*        bufferData
+                    = _delegate->GetVP2ResourceRegistry().GetStagingPool().AllocateForFrame(
+                        numBytes);
+                memcpy(bufferData, widths.cdata(), numBytes);
+                stateToCommit._primvarBufferDataMap[HdTokens->widths] = { bufferData, numBytes };
             }
         }
 
@@ -902,20 +706,17 @@ void HdVP2BasisCurves::_UpdateDrawItem(
         // Retrieve instance transforms from the instancer.
         HdVP2Instancer* instancer
             = static_cast<HdVP2Instancer*>(renderIndex.GetInstancer(GetInstancerId()));
-        VtMatrix4dArray transforms
-            = instancer ? instancer->GetInstanceTransforms(id) : VtMatrix4dArray();
+        if (instancer) {
+            instancer->GetInstanceTransforms(id, worldMatrix, *stateToCommit._instanceTransforms);
+        }
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        const unsigned int instanceCount = stateToCommit._instanceTransforms->length();
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
         } else {
             const SdfPathVector usdPaths = drawScene.GetScenePrimPaths(id, instanceCount);
-            stateToCommit._instanceTransforms->setLength(instanceCount);
             for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
-                (*stateToCommit._instanceTransforms)[i] = worldMatrix * instanceMatrix;
                 stateToCommit._ufeIdentifiers.append(usdPaths[i].GetString().c_str());
             }
 
@@ -1095,15 +896,15 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
         // If available, something changed
         for (const auto& entry : stateToCommit._primvarBufferDataMap) {
-            auto& primvarBufferData = entry.second;
-            if (!primvarBufferData.empty()) {
+            const PrimvarBufferData& primvarBufferData = entry.second;
+            if (primvarBufferData._size > 0) {
                 const auto it = primvarBuffers->find(entry.first);
                 if (it != primvarBuffers->end()) {
                     if (auto primvarBuffer = it->second.get()) {
                         const auto&  desc = primvarBuffer->descriptor();
                         unsigned int numElems
-                            = primvarBufferData.size() / (desc.dataTypeSize() * desc.dimension());
-                        primvarBuffer->update(&primvarBufferData[0], 0, numElems, true);
+                            = primvarBufferData._size / (desc.dataTypeSize() * desc.dimension());
+                        primvarBuffer->update(primvarBufferData._data, 0, numElems, true);
                     }
                 }
             }
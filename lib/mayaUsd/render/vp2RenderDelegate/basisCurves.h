@@ -28,6 +28,7 @@
 
 #include <maya/MHWGeometry.h>
 
+#include <array>
 #include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -54,6 +55,23 @@ struct HdVP2BasisCurvesSharedData
     //! copy.
     HdBasisCurvesTopology _topology;
 
+    //! Kinds of index arrays the draw items build from the topology.
+    enum IndexArrayKind
+    {
+        kCubicIndices,
+        kLinesIndices,
+        kLineSegmentIndices,
+        kIndexArrayKindCount
+    };
+
+    //! Index arrays built from the topology, kept until the topology changes so
+    //! that they are not rebuilt when only the points are animated, nor by every
+    //! draw item drawing the same kind of primitives.
+    std::array<VtIntArray, kIndexArrayKindCount> _indexArrays;
+
+    //! Whether each kind of index array was built, an empty topology builds empty arrays.
+    std::array<bool, kIndexArrayKindCount> _indexArraysBuilt {};
+
     //! A local cache of primvar scene data. "data" is a copy-on-write handle to
     //! the actual primvar buffer, and "interpolation" is the interpolation mode
     //! to be used.
@@ -0,0 +1,188 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "basisCurvesIndices.h"
+
+#include <pxr/imaging/hd/tokens.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+using CurveOffsets = HdVP2BasisCurvesIndices::CurveOffsets;
+
+/*! \brief  Fill \p indices with the output of \p curveFn for each curve.
+
+    \p sizesFn returns the number of vertices and indices of a curve, \p curveFn
+    writes the indices of a curve given its first vertex. The indices are mapped
+    with the indices of the topology, if it has any.
+*/
+template <typename SizesFn, typename CurveFn>
+VtIntArray
+_BuildCurveIndices(const HdBasisCurvesTopology& topology, SizesFn sizesFn, CurveFn curveFn)
+{
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+
+    std::vector<CurveOffsets> offsets;
+    HdVP2BasisCurvesIndices::ComputeCurveOffsets(vertexCounts, sizesFn, offsets);
+
+    VtIntArray indices(offsets.back().dst);
+    int*       out = indices.data();
+
+    const VtIntArray& curveIndices = topology.GetCurveIndices();
+    const int*        remap = curveIndices.empty() ? nullptr : curveIndices.cdata();
+    const int         maxIndex = static_cast<int>(curveIndices.size()) - 1;
+
+    HdVP2BasisCurvesIndices::ParallelForCurves(vertexCounts.size(), [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            int* const curveOut = out + offsets[curve].dst;
+            int* const curveEnd = out + offsets[curve + 1].dst;
+            curveFn(vertexCounts[curve], static_cast<int>(offsets[curve].src), curveOut);
+
+            if (remap) {
+                for (int* index = curveOut; index != curveEnd; ++index) {
+                    *index = remap[std::min(*index, maxIndex)];
+                }
+            }
+        }
+    });
+
+    return indices;
+}
+
+} // namespace
+
+VtIntArray HdVP2BasisCurvesIndices::BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
+{
+    /*
+    Here's a diagram of what's happening in this code:
+
+    For open (non periodic, wrap = false) curves:
+
+      bezier (vStep = 3)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+                           [======= seg1 =======]
+
+
+      bspline / catmullRom (vStep = 1)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+             [======= seg1 =======]
+                    [======= seg2 =======]
+                           [======= seg3 =======]
+
+
+    For closed (periodic, wrap = true) curves:
+
+       periodic bezier (vStep = 3)
+       0------1------2------3------4------5------0 (vertex index)
+       [======= seg0 =======]
+                            [======= seg1 =======]
+
+
+       periodic bspline / catmullRom (vStep = 1)
+       0------1------2------3------4------5------0------1------2 (vertex index)
+       [======= seg0 =======]
+              [======= seg1 =======]
+                     [======= seg2 =======]
+                            [======= seg3 =======]
+                                   [======= seg4 =======]
+                                          [======= seg5 =======]
+    */
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int  vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+
+    auto numSegments = [wrap, vStep](int count) {
+        // The first segment always eats up 4 verts, not just vstep, so to
+        // compensate, we break at count - 3. If we're closing the curve, make
+        // sure that we have enough segments to wrap all the way back to the
+        // beginning.
+        return std::max(wrap ? count / vStep : ((count - 4) / vStep) + 1, 0);
+    };
+
+    return _BuildCurveIndices(
+        topology,
+        [&numSegments](int count) -> CurveOffsets {
+            return { size_t(std::max(count, 0)), size_t(numSegments(count)) * 4 };
+        },
+        [&numSegments, wrap, vStep](int count, int vertexIndex, int* out) {
+            const int numSegs = numSegments(count);
+            for (int i = 0; i < numSegs; ++i) {
+                // Set up curve segments based on curve basis
+                const int offset = i * vStep;
+                for (int v = 0; v < 4; ++v) {
+                    // If there are not enough verts to round out the segment
+                    // just repeat the last vert.
+                    *out++ = wrap ? vertexIndex + ((offset + v) % count)
+                                  : vertexIndex + std::min(offset + v, (count - 1));
+                }
+            }
+        });
+}
+
+VtIntArray HdVP2BasisCurvesIndices::BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
+{
+    // Each pair of vertices is a line, an odd vertex count still uses a whole pair.
+    auto numLines = [](int count) { return size_t(std::max(count + 1, 0) / 2); };
+
+    return _BuildCurveIndices(
+        topology,
+        [&numLines](int count) -> CurveOffsets {
+            return { numLines(count) * 2, numLines(count) * 2 };
+        },
+        [&numLines](int count, int vertexIndex, int* out) {
+            const size_t lines = numLines(count);
+            for (size_t i = 0; i < lines * 2; ++i) {
+                *out++ = vertexIndex++;
+            }
+        });
+}
+
+VtIntArray
+HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
+{
+    const bool skipFirstAndLastSegs = (topology.GetCurveBasis() == HdTokens->catmullRom);
+    const bool wrap = topology.GetCurveWrap() == HdTokens->periodic;
+
+    return _BuildCurveIndices(
+        topology,
+        [skipFirstAndLastSegs, wrap](int count) -> CurveOffsets {
+            const int numSegs = std::max(count - (skipFirstAndLastSegs ? 3 : 1), 0);
+            // A curve always takes at least one vertex.
+            return { size_t(std::max(count, 1)), size_t(numSegs + (wrap ? 1 : 0)) * 2 };
+        },
+        [skipFirstAndLastSegs, wrap](int count, int vertexIndex, int* out) {
+            // Store first vert index incase we are wrapping
+            const int firstVert = vertexIndex;
+            int       v0 = vertexIndex;
+            for (int i = 1; i < count; ++i) {
+                const int v1 = v0 + 1;
+                if (!skipFirstAndLastSegs || (i > 1 && i < count - 1)) {
+                    *out++ = v0;
+                    *out++ = v1;
+                }
+                v0 = v1;
+            }
+            if (wrap) {
+                *out++ = v0;
+                *out++ = firstVert;
+            }
+        });
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,101 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_BASIS_CURVES_INDICES
+#define HD_VP2_BASIS_CURVES_INDICES
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/pxr.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Per-curve kernels of the basis curves
+    \class  HdVP2BasisCurvesIndices
+
+    The per-curve kernels are split in two passes: a serial scan computing the
+    offsets of each curve, which only needs the vertex counts, then a parallel
+    pass filling each curve at its offset.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2BasisCurvesIndices
+{
+public:
+    //! Where the data of a curve starts, in the input and in the output of a kernel.
+    struct CurveOffsets
+    {
+        size_t src;
+        size_t dst;
+    };
+
+    //! Number of curves processed by a task of the parallel loops.
+    static constexpr size_t kCurveGrainSize = 1024;
+
+    /*! \brief  Compute the offsets of each curve from the sizes returned by \p sizesFn.
+
+        \return The total sizes, in the last element of \p offsets.
+    */
+    template <typename SizesFn>
+    static void ComputeCurveOffsets(
+        const VtIntArray&          vertexCounts,
+        SizesFn                    sizesFn,
+        std::vector<CurveOffsets>& offsets)
+    {
+        offsets.resize(vertexCounts.size() + 1);
+
+        CurveOffsets current { 0, 0 };
+        for (size_t curve = 0; curve < vertexCounts.size(); ++curve) {
+            offsets[curve] = current;
+
+            const CurveOffsets sizes = sizesFn(vertexCounts[curve]);
+            current.src += sizes.src;
+            current.dst += sizes.dst;
+        }
+        offsets.back() = current;
+    }
+
+    //! Call \p fn on ranges of the \p count curves, in parallel when there are enough of them.
+    template <typename Fn> static void ParallelForCurves(size_t count, Fn fn)
+    {
+        if (count <= kCurveGrainSize) {
+            fn(0, count);
+            return;
+        }
+
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, count, kCurveGrainSize),
+            [&fn](const tbb::blocked_range<size_t>& range) { fn(range.begin(), range.end()); });
+    }
+
+    //! Build the indices of the cubic segments of the curves, 4 per segment.
+    static VtIntArray BuildCubicIndexArray(const HdBasisCurvesTopology& topology);
+
+    //! Build the indices of the lines of segmented curves, a pair of vertices per line.
+    static VtIntArray BuildLinesIndexArray(const HdBasisCurvesTopology& topology);
+
+    //! Build the indices of the curves drawn as line segments, 2 per segment.
+    static VtIntArray BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_BASIS_CURVES_INDICES
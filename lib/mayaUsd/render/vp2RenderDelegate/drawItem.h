@@ -16,6 +16,8 @@
 #ifndef HD_VP2_DRAW_ITEM
 #define HD_VP2_DRAW_ITEM
 
+#include "instanceCulling.h"
+
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/imaging/hd/drawItem.h>
@@ -86,6 +88,12 @@ public:
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
         //! Whether or not the render item represents the shaded draw for selected instances
         bool _shadedSelectedInstances { false };
+
+        //! Culling and levels of detail of the instances drawn by the render item
+        std::unique_ptr<HdVP2InstanceCuller> _instanceCuller;
+
+        //! Forced reprs needed by the levels of detail of the instances of the render item
+        int _instanceLodReprFlags { 0 };
 #endif
 
         //! Primitive type of the render item
@@ -0,0 +1,421 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "instanceCulling.h"
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec4d.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Maximum number of instances in a leaf of the hierarchy.
+constexpr uint32_t _kLeafSize = 32;
+
+//! Number of instances below which a subtree is culled by a single task.
+constexpr uint32_t _kTaskSize = 4096;
+
+//! Number of instances above which both halves of a node are built in parallel.
+constexpr uint32_t _kParallelBuildSize = 65536;
+
+//! Minimum number of instances processed by a parallel task when computing bounds.
+constexpr size_t _kGrainSize = 1024;
+
+//! Ratio by which an instance drawn as a bounding box must exceed the LOD screen size
+//! to be drawn at full detail again.
+constexpr double _kLodHysteresis = 1.25;
+
+constexpr int _kAllPlanes = 0x3f;
+constexpr int _kOutside = -1;
+
+//! Frustum planes and depth row extracted from a view, in world space.
+struct _Frustum
+{
+    GfVec4d planes[6];
+    GfVec4d depth;
+    double  pixelScale;
+    double  minScreenSize;
+    double  lodScreenSize;
+};
+
+_Frustum _MakeFrustum(const HdVP2CullingView& view)
+{
+    // Maya matrices transform row vectors: clip = [x y z 1] * viewProjection,
+    // so the clip coordinates are given by the columns of the matrix.
+    const MMatrix& m = view.viewProjection;
+    auto           column = [&m](int j) { return GfVec4d(m[0][j], m[1][j], m[2][j], m[3][j]); };
+
+    const GfVec4d x = column(0);
+    const GfVec4d y = column(1);
+    const GfVec4d z = column(2);
+    const GfVec4d w = column(3);
+
+    // The near plane uses the -w <= z convention, which is conservative for
+    // projections mapping depth to [0, w].
+    _Frustum frustum;
+    frustum.planes[0] = w + x;
+    frustum.planes[1] = w - x;
+    frustum.planes[2] = w + y;
+    frustum.planes[3] = w - y;
+    frustum.planes[4] = w + z;
+    frustum.planes[5] = w - z;
+    frustum.depth = w;
+    frustum.pixelScale = view.pixelScale;
+    frustum.minScreenSize = view.minScreenSize;
+    frustum.lodScreenSize = view.lodScreenSize;
+    return frustum;
+}
+
+//! Return the signed distance of the box center to the plane, and the box extent along its normal.
+inline void
+_Project(const GfVec4d& plane, const GfVec3d& center, const GfVec3d& halfSize, double& s, double& r)
+{
+    s = plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3];
+    r = std::abs(plane[0]) * halfSize[0] + std::abs(plane[1]) * halfSize[1]
+        + std::abs(plane[2]) * halfSize[2];
+}
+
+/*! \brief  Classify a box against the frustum planes of \p mask.
+
+    \return _kOutside if the box is culled, otherwise the mask of the planes
+            the box still intersects.
+*/
+int _Classify(const _Frustum& frustum, const GfVec3d& center, const GfVec3d& halfSize, int mask)
+{
+    double s, r;
+    for (int p = 0; p < 6; ++p) {
+        if (!(mask & (1 << p))) {
+            continue;
+        }
+        _Project(frustum.planes[p], center, halfSize, s, r);
+        if (s + r < 0.0) {
+            return _kOutside;
+        }
+        if (s - r >= 0.0) {
+            mask &= ~(1 << p);
+        }
+    }
+
+    // Boxes crossing the camera plane are never culled by size.
+    if (frustum.minScreenSize > 0.0) {
+        _Project(frustum.depth, center, halfSize, s, r);
+        const double minDepth = s - r;
+        if (minDepth > 0.0
+            && 2.0 * halfSize.GetLength() * frustum.pixelScale
+                < frustum.minScreenSize * minDepth) {
+            return _kOutside;
+        }
+    }
+    return mask;
+}
+
+//! Return the projected size in pixels of a box, measured at its center.
+double _ScreenSize(const _Frustum& frustum, const GfVec3d& center, const GfVec3d& halfSize)
+{
+    const GfVec4d& depth = frustum.depth;
+    const double   w
+        = depth[0] * center[0] + depth[1] * center[1] + depth[2] * center[2] + depth[3];
+    if (w <= 0.0) {
+        return std::numeric_limits<double>::max();
+    }
+    return 2.0 * halfSize.GetLength() * frustum.pixelScale / w;
+}
+
+} // namespace
+
+void HdVP2InstanceCuller::Update(
+    size_t              version,
+    const MMatrix&      worldMatrix,
+    const GfRange3d&    localBounds,
+    const MMatrixArray& transforms)
+{
+    if (_built && _version == version && _worldMatrix == worldMatrix
+        && _localBounds == localBounds && _instanceCount == transforms.length()) {
+        return;
+    }
+
+    Build(transforms, localBounds);
+    _version = version;
+    _worldMatrix = worldMatrix;
+}
+
+void HdVP2InstanceCuller::Build(const MMatrixArray& transforms, const GfRange3d& localBounds)
+{
+    _built = true;
+    _visibleValid = false;
+    _localBounds = localBounds;
+    _instanceCount = transforms.length();
+    _nodes.clear();
+    _order.clear();
+    _centers.clear();
+    _halfSizes.clear();
+
+    // Without bounds nothing can be culled, see Cull().
+    if (_instanceCount == 0 || localBounds.IsEmpty()) {
+        return;
+    }
+
+    const GfVec3d localCenter = localBounds.GetMidpoint();
+    const GfVec3d localHalfSize = 0.5 * localBounds.GetSize();
+
+    // World bounds of each instance, indexed by instance.
+    std::vector<GfVec3f> centers(_instanceCount);
+    std::vector<GfVec3f> halfSizes(_instanceCount);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, _instanceCount, _kGrainSize),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const MMatrix& m = transforms[static_cast<unsigned int>(i)];
+                for (int j = 0; j < 3; ++j) {
+                    centers[i][j] = static_cast<float>(
+                        localCenter[0] * m[0][j] + localCenter[1] * m[1][j]
+                        + localCenter[2] * m[2][j] + m[3][j]);
+                    halfSizes[i][j] = static_cast<float>(
+                        localHalfSize[0] * std::abs(m[0][j]) + localHalfSize[1] * std::abs(m[1][j])
+                        + localHalfSize[2] * std::abs(m[2][j]));
+                }
+            }
+        });
+
+    _order.resize(_instanceCount);
+    for (size_t i = 0; i < _instanceCount; ++i) {
+        _order[i] = static_cast<uint32_t>(i);
+    }
+
+    _centers.swap(centers);
+    _halfSizes.swap(halfSizes);
+    _nodes.reserve(2 * (_instanceCount / (_kLeafSize / 2) + 1));
+    _BuildNode(_nodes, 0, static_cast<uint32_t>(_instanceCount));
+
+    // Store the bounds in the order of the leaves, for locality while culling.
+    centers.resize(_instanceCount);
+    halfSizes.resize(_instanceCount);
+    for (size_t k = 0; k < _instanceCount; ++k) {
+        centers[k] = _centers[_order[k]];
+        halfSizes[k] = _halfSizes[_order[k]];
+    }
+    _centers.swap(centers);
+    _halfSizes.swap(halfSizes);
+}
+
+uint32_t HdVP2InstanceCuller::_BuildNode(std::vector<_Node>& nodes, uint32_t first, uint32_t count)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(nodes.size());
+    nodes.emplace_back();
+
+    constexpr float max = std::numeric_limits<float>::max();
+    GfVec3f         boundsMin(max), boundsMax(-max);
+    GfVec3f         centerMin(max), centerMax(-max);
+    for (uint32_t k = first; k < first + count; ++k) {
+        const GfVec3f& center = _centers[_order[k]];
+        const GfVec3f& halfSize = _halfSizes[_order[k]];
+        for (int j = 0; j < 3; ++j) {
+            boundsMin[j] = std::min(boundsMin[j], center[j] - halfSize[j]);
+            boundsMax[j] = std::max(boundsMax[j], center[j] + halfSize[j]);
+            centerMin[j] = std::min(centerMin[j], center[j]);
+            centerMax[j] = std::max(centerMax[j], center[j]);
+        }
+    }
+
+    _Node& node = nodes[nodeIndex];
+    node.min = boundsMin;
+    node.max = boundsMax;
+    node.first = first;
+    node.count = count;
+    node.second = 0;
+
+    if (count <= _kLeafSize) {
+        return nodeIndex;
+    }
+
+    // Median split along the largest extent of the instance centers.
+    const GfVec3f extent = centerMax - centerMin;
+    const int     axis = (extent[0] >= extent[1] && extent[0] >= extent[2]) ? 0
+            : (extent[1] >= extent[2])                                      ? 1
+                                                                            : 2;
+    if (extent[axis] <= 0.0f) {
+        return nodeIndex;
+    }
+
+    const uint32_t half = count / 2;
+    std::nth_element(
+        _order.begin() + first,
+        _order.begin() + first + half,
+        _order.begin() + first + count,
+        [this, axis](uint32_t a, uint32_t b) { return _centers[a][axis] < _centers[b][axis]; });
+
+    if (count <= _kParallelBuildSize) {
+        _BuildNode(nodes, first, half);
+        const uint32_t second = _BuildNode(nodes, first + half, count - half);
+        nodes[nodeIndex].second = second;
+        return nodeIndex;
+    }
+
+    // Build both halves in parallel, then append them after this node.
+    std::vector<_Node> firstNodes, secondNodes;
+    tbb::parallel_invoke(
+        [&]() { _BuildNode(firstNodes, first, half); },
+        [&]() { _BuildNode(secondNodes, first + half, count - half); });
+
+    auto append = [&nodes](const std::vector<_Node>& subtree) {
+        const uint32_t offset = static_cast<uint32_t>(nodes.size());
+        for (_Node child : subtree) {
+            if (child.second != 0) {
+                child.second += offset;
+            }
+            nodes.push_back(child);
+        }
+        return offset;
+    };
+    append(firstNodes);
+    nodes[nodeIndex].second = append(secondNodes);
+    return nodeIndex;
+}
+
+const std::vector<uint8_t>& HdVP2InstanceCuller::Cull(const HdVP2CullingView& view)
+{
+    if (!_visibleValid || _view != view) {
+        // The previous levels of detail are kept for hysteresis.
+        std::vector<uint8_t> previous;
+        previous.swap(_visible);
+        if (previous.size() != _instanceCount) {
+            previous.clear();
+        }
+
+        _Cull(view, previous, _visible);
+        _view = view;
+        _visibleValid = true;
+
+        _boundingBoxCount = 0;
+        if (view.lodScreenSize > 0.0) {
+            _boundingBoxCount = std::count(_visible.begin(), _visible.end(), kBoundingBox);
+        }
+    }
+    return _visible;
+}
+
+void HdVP2InstanceCuller::_Cull(
+    const HdVP2CullingView&     view,
+    const std::vector<uint8_t>& previous,
+    std::vector<uint8_t>&       visible) const
+{
+    if (_nodes.empty()) {
+        visible.assign(_instanceCount, kFullDetail);
+        return;
+    }
+    visible.assign(_instanceCount, kCulled);
+
+    const _Frustum frustum = _MakeFrustum(view);
+
+    auto classifyNode = [&frustum](const _Node& node, int mask) {
+        const GfVec3d min(node.min);
+        const GfVec3d max(node.max);
+        return _Classify(frustum, 0.5 * (min + max), 0.5 * (max - min), mask);
+    };
+
+    // Split the hierarchy in subtrees small enough to be culled by a single task.
+    struct Task
+    {
+        uint32_t node;
+        int      mask;
+    };
+    std::vector<Task> tasks;
+    std::vector<Task> pending;
+
+    const int rootMask = classifyNode(_nodes[0], view.cullFrustum ? _kAllPlanes : 0);
+    if (rootMask != _kOutside) {
+        pending.push_back({ 0, rootMask });
+    }
+    while (!pending.empty()) {
+        const Task task = pending.back();
+        pending.pop_back();
+
+        const _Node& node = _nodes[task.node];
+        if (node.second == 0 || node.count <= _kTaskSize || task.mask == 0) {
+            tasks.push_back(task);
+            continue;
+        }
+        for (uint32_t child : { task.node + 1, node.second }) {
+            const int mask = classifyNode(_nodes[child], task.mask);
+            if (mask != _kOutside) {
+                pending.push_back({ child, mask });
+            }
+        }
+    }
+
+    const bool     useLod = frustum.lodScreenSize > 0.0;
+    const bool     testEachInstance = useLod || frustum.minScreenSize > 0.0;
+    const uint8_t* previousFlags = previous.empty() ? nullptr : previous.data();
+    uint8_t*       flags = visible.data();
+
+    auto levelOfDetail = [&](uint32_t k) -> uint8_t {
+        if (!useLod) {
+            return kFullDetail;
+        }
+        double threshold = frustum.lodScreenSize;
+        if (previousFlags && previousFlags[_order[k]] == kBoundingBox) {
+            threshold *= _kLodHysteresis;
+        }
+        const double size = _ScreenSize(frustum, GfVec3d(_centers[k]), GfVec3d(_halfSizes[k]));
+        return size < threshold ? kBoundingBox : kFullDetail;
+    };
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, tasks.size(), 1),
+        [&](const tbb::blocked_range<size_t>& range) {
+            std::vector<Task> stack;
+            for (size_t t = range.begin(); t < range.end(); ++t) {
+                stack.push_back(tasks[t]);
+                while (!stack.empty()) {
+                    const Task task = stack.back();
+                    stack.pop_back();
+
+                    const _Node& node = _nodes[task.node];
+                    if (task.mask == 0 && !testEachInstance) {
+                        // Fully inside the frustum.
+                        for (uint32_t k = node.first; k < node.first + node.count; ++k) {
+                            flags[_order[k]] = kFullDetail;
+                        }
+                    } else if (node.second == 0) {
+                        for (uint32_t k = node.first; k < node.first + node.count; ++k) {
+                            const int mask = _Classify(
+                                frustum, GfVec3d(_centers[k]), GfVec3d(_halfSizes[k]), task.mask);
+                            if (mask != _kOutside) {
+                                flags[_order[k]] = levelOfDetail(k);
+                            }
+                        }
+                    } else {
+                        for (uint32_t child : { task.node + 1, node.second }) {
+                            const int mask = classifyNode(_nodes[child], task.mask);
+                            if (mask != _kOutside) {
+                                stack.push_back({ child, mask });
+                            }
+                        }
+                    }
+                }
+            }
+        });
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
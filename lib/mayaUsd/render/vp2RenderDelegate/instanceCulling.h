@@ -0,0 +1,141 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_INSTANCE_CULLING
+#define HD_VP2_INSTANCE_CULLING
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/pxr.h>
+
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+
+#include <cstdint>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Viewport camera against which instances are culled
+    \class  HdVP2CullingView
+*/
+struct HdVP2CullingView
+{
+    MMatrix viewProjection;        //!< World to clip space matrix
+    double  pixelScale { 0.0 };    //!< Size in pixels of a unit length at unit depth
+    double  minScreenSize { 0.0 }; //!< Instances smaller than this size in pixels are culled
+    double  lodScreenSize { 0.0 }; //!< Instances smaller than this size in pixels use bboxes
+    bool    cullFrustum { true };  //!< Whether instances outside of the frustum are culled
+
+    bool operator==(const HdVP2CullingView& other) const
+    {
+        return viewProjection == other.viewProjection && pixelScale == other.pixelScale
+            && minScreenSize == other.minScreenSize && lodScreenSize == other.lodScreenSize
+            && cullFrustum == other.cullFrustum;
+    }
+    bool operator!=(const HdVP2CullingView& other) const { return !(*this == other); }
+};
+
+/*! \brief  CPU culling of the instances of a prototype
+    \class  HdVP2InstanceCuller
+
+    Builds a bounding volume hierarchy over the world bounds of the instances
+    and culls them against the view frustum and a minimum screen size. The
+    hierarchy is only rebuilt when the instances change, and the visibility
+    is only recomputed when the view changes.
+
+    The tests are conservative: an instance is only culled when its bounds are
+    fully outside of the frustum, or when they project to less than the
+    minimum screen size.
+
+    Visible instances are also assigned a level of detail from their projected
+    size: instances smaller than the LOD screen size are drawn as bounding
+    boxes. An instance only switches back to full detail once it is noticeably
+    larger than the LOD screen size, to avoid popping when the camera hovers
+    around the threshold.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2InstanceCuller
+{
+public:
+    //! Visibility of an instance, as returned by Cull().
+    enum Visibility : uint8_t
+    {
+        kCulled = 0,
+        kFullDetail = 1,
+        kBoundingBox = 2
+    };
+
+    /*! \brief  Rebuild the hierarchy if the instances changed since the last update.
+
+        \p transforms are the world matrices of the instances and \p localBounds
+        the bounds of the prototype. \p version must change whenever the instance
+        transforms change without \p worldMatrix or \p localBounds changing.
+    */
+    void Update(
+        size_t              version,
+        const MMatrix&      worldMatrix,
+        const GfRange3d&    localBounds,
+        const MMatrixArray& transforms);
+
+    //! Unconditionally rebuild the hierarchy.
+    void Build(const MMatrixArray& transforms, const GfRange3d& localBounds);
+
+    //! Return the Visibility of each instance in \p view.
+    const std::vector<uint8_t>& Cull(const HdVP2CullingView& view);
+
+    //! Return the number of instances of the last build.
+    size_t GetInstanceCount() const { return _instanceCount; }
+
+    //! Return the number of instances drawn as bounding boxes by the last cull.
+    size_t GetBoundingBoxCount() const { return _boundingBoxCount; }
+
+private:
+    struct _Node
+    {
+        GfVec3f  min;
+        GfVec3f  max;
+        uint32_t first;  //!< First instance of the node in _order
+        uint32_t count;  //!< Number of instances of the node
+        uint32_t second; //!< Index of the second child, 0 for leaves
+    };
+
+    uint32_t _BuildNode(std::vector<_Node>& nodes, uint32_t first, uint32_t count);
+    void     _Cull(
+        const HdVP2CullingView&     view,
+        const std::vector<uint8_t>& previous,
+        std::vector<uint8_t>&       visible) const;
+
+    std::vector<_Node>    _nodes;
+    std::vector<uint32_t> _order;     //!< Instance indices, grouped by node
+    std::vector<GfVec3f>  _centers;   //!< Center of the world bounds, in _order
+    std::vector<GfVec3f>  _halfSizes; //!< Half size of the world bounds, in _order
+    size_t                _instanceCount { 0 };
+
+    bool      _built { false };
+    size_t    _version { 0 };
+    MMatrix   _worldMatrix;
+    GfRange3d _localBounds;
+
+    bool                 _visibleValid { false };
+    HdVP2CullingView     _view;
+    std::vector<uint8_t> _visible;
+    size_t               _boundingBoxCount { 0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_INSTANCE_CULLING
@@ -0,0 +1,247 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "instanceTransforms.h"
+
+#include "sampler.h"
+
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstring>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Number of instances processed together by the composition kernel.
+constexpr size_t _kBlockSize = 256;
+
+//! Minimum number of instances processed by a parallel task.
+constexpr size_t _kGrainSize = 1024;
+
+//! Return the typed data of the buffer, or nullptr if the buffer is missing or of another type.
+template <typename T> const T* _GetBufferData(const HdVtBufferSource* buffer, size_t& count)
+{
+    count = 0;
+    if (!buffer || buffer->GetTupleType() != HdVP2TypeHelper::GetTupleType<T>()) {
+        return nullptr;
+    }
+
+    count = buffer->GetNumElements();
+    return static_cast<const T*>(buffer->GetData());
+}
+
+//! Multiply row-major 4x4 matrices: out = a * b. \p out must not alias the inputs.
+inline void _Multiply(const double* a, const double* b, double* out)
+{
+    for (int row = 0; row < 4; ++row) {
+        const double* aRow = a + row * 4;
+        for (int col = 0; col < 4; ++col) {
+            out[row * 4 + col] = aRow[0] * b[col] + aRow[1] * b[4 + col] + aRow[2] * b[8 + col]
+                + aRow[3] * b[12 + col];
+        }
+    }
+}
+
+template <typename Fn> void _ParallelFor(size_t count, Fn fn)
+{
+    if (count <= _kGrainSize) {
+        fn(0, count);
+        return;
+    }
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, count, _kGrainSize),
+        [&fn](const tbb::blocked_range<size_t>& range) { fn(range.begin(), range.end()); });
+}
+
+} // namespace
+
+void HdVP2InstanceTransforms::Update(
+    const GfMatrix4d&       instancerTransform,
+    size_t                  instanceCount,
+    const HdVtBufferSource* translations,
+    const HdVtBufferSource* rotations,
+    const HdVtBufferSource* scales,
+    const HdVtBufferSource* transforms)
+{
+    _instancerTransform = instancerTransform;
+    _instanceCount = instanceCount;
+
+    static const float identity[_ComponentCount] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+    for (int component = 0; component < _ComponentCount; ++component) {
+        _components[component].assign(instanceCount, identity[component]);
+    }
+
+    size_t         translateCount = 0;
+    const GfVec3f* translateData = _GetBufferData<GfVec3f>(translations, translateCount);
+
+    // Rotations are either half-precision quaternions or (real, i, j, k) float vectors.
+    size_t         quathCount = 0;
+    const GfQuath* quathData = _GetBufferData<GfQuath>(rotations, quathCount);
+    size_t         quatfCount = 0;
+    const GfVec4f* quatfData = _GetBufferData<GfVec4f>(rotations, quatfCount);
+
+    size_t         scaleCount = 0;
+    const GfVec3f* scaleData = _GetBufferData<GfVec3f>(scales, scaleCount);
+
+    size_t            transformCount = 0;
+    const GfMatrix4d* transformData = _GetBufferData<GfMatrix4d>(transforms, transformCount);
+    if (transformData) {
+        _transforms.assign(instanceCount, GfMatrix4d(1.0));
+    } else {
+        _transforms.clear();
+    }
+
+    float* tx = _components[_TranslateX].data();
+    float* ty = _components[_TranslateY].data();
+    float* tz = _components[_TranslateZ].data();
+    float* qr = _components[_RotateReal].data();
+    float* qi = _components[_RotateI].data();
+    float* qj = _components[_RotateJ].data();
+    float* qk = _components[_RotateK].data();
+    float* sx = _components[_ScaleX].data();
+    float* sy = _components[_ScaleY].data();
+    float* sz = _components[_ScaleZ].data();
+
+    _ParallelFor(instanceCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < std::min(end, translateCount); ++i) {
+            tx[i] = translateData[i][0];
+            ty[i] = translateData[i][1];
+            tz[i] = translateData[i][2];
+        }
+        for (size_t i = begin; i < std::min(end, quathCount); ++i) {
+            const GfVec3h& imaginary = quathData[i].GetImaginary();
+            qr[i] = quathData[i].GetReal();
+            qi[i] = imaginary[0];
+            qj[i] = imaginary[1];
+            qk[i] = imaginary[2];
+        }
+        for (size_t i = begin; i < std::min(end, quatfCount); ++i) {
+            qr[i] = quatfData[i][0];
+            qi[i] = quatfData[i][1];
+            qj[i] = quatfData[i][2];
+            qk[i] = quatfData[i][3];
+        }
+        for (size_t i = begin; i < std::min(end, scaleCount); ++i) {
+            sx[i] = scaleData[i][0];
+            sy[i] = scaleData[i][1];
+            sz[i] = scaleData[i][2];
+        }
+        for (size_t i = begin; i < std::min(end, transformCount); ++i) {
+            _transforms[i] = transformData[i];
+        }
+    });
+}
+
+void HdVP2InstanceTransforms::Compose(const VtIntArray& indices, VtMatrix4dArray& result) const
+{
+    result.resize(indices.size());
+
+    const double* instancerTransform = _instancerTransform.data();
+    const int*    allIndices = indices.cdata();
+    GfMatrix4d*   out = result.data();
+
+    _ParallelFor(indices.size(), [&](size_t begin, size_t end) {
+        // Components and local transforms of a block of instances, one array per
+        // component and per matrix element so that the loops below vectorize.
+        float  component[_ComponentCount][_kBlockSize];
+        double local[16][_kBlockSize];
+
+        for (size_t blockBegin = begin; blockBegin < end; blockBegin += _kBlockSize) {
+            const size_t count = std::min(_kBlockSize, end - blockBegin);
+            const int*   blockIndices = allIndices + blockBegin;
+
+            for (int c = 0; c < _ComponentCount; ++c) {
+                const float* src = _components[c].data();
+                for (size_t i = 0; i < count; ++i) {
+                    component[c][i] = src[blockIndices[i]];
+                }
+            }
+
+            // scale * rotate * translate, the rotation matrix being built like
+            // GfMatrix4d::SetRotate() does from a quaternion.
+            for (size_t i = 0; i < count; ++i) {
+                const double r = component[_RotateReal][i];
+                const double x = component[_RotateI][i];
+                const double y = component[_RotateJ][i];
+                const double z = component[_RotateK][i];
+                const double sx = component[_ScaleX][i];
+                const double sy = component[_ScaleY][i];
+                const double sz = component[_ScaleZ][i];
+
+                local[0][i] = sx * (1.0 - 2.0 * (y * y + z * z));
+                local[1][i] = sx * (2.0 * (x * y + z * r));
+                local[2][i] = sx * (2.0 * (z * x - y * r));
+                local[3][i] = 0.0;
+                local[4][i] = sy * (2.0 * (x * y - z * r));
+                local[5][i] = sy * (1.0 - 2.0 * (z * z + x * x));
+                local[6][i] = sy * (2.0 * (y * z + x * r));
+                local[7][i] = 0.0;
+                local[8][i] = sz * (2.0 * (z * x + y * r));
+                local[9][i] = sz * (2.0 * (y * z - x * r));
+                local[10][i] = sz * (1.0 - 2.0 * (y * y + x * x));
+                local[11][i] = 0.0;
+                local[12][i] = component[_TranslateX][i];
+                local[13][i] = component[_TranslateY][i];
+                local[14][i] = component[_TranslateZ][i];
+                local[15][i] = 1.0;
+            }
+
+            // instanceTransform * (scale * rotate * translate) * instancerTransform
+            for (size_t i = 0; i < count; ++i) {
+                double srt[16];
+                for (int e = 0; e < 16; ++e) {
+                    srt[e] = local[e][i];
+                }
+
+                double* instanceMatrix = out[blockBegin + i].data();
+                if (!_transforms.empty()) {
+                    double transformed[16];
+                    _Multiply(_transforms[blockIndices[i]].data(), srt, transformed);
+                    _Multiply(transformed, instancerTransform, instanceMatrix);
+                } else {
+                    _Multiply(srt, instancerTransform, instanceMatrix);
+                }
+            }
+        }
+    });
+}
+
+void HdVP2InstanceTransforms::Apply(
+    const MMatrix&         worldMatrix,
+    const VtMatrix4dArray& transforms,
+    MMatrixArray&          result)
+{
+    result.setLength(static_cast<unsigned int>(transforms.size()));
+
+    const double*     world = worldMatrix.matrix[0];
+    const GfMatrix4d* data = transforms.cdata();
+
+    _ParallelFor(transforms.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            _Multiply(world, data[i].data(), result[static_cast<unsigned int>(i)].matrix[0]);
+        }
+    });
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
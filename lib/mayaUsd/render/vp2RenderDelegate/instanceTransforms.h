@@ -0,0 +1,103 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_INSTANCE_TRANSFORMS
+#define HD_VP2_INSTANCE_TRANSFORMS
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/vtBufferSource.h>
+#include <pxr/pxr.h>
+
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Composition of instance transforms from the instancer primvars
+    \class  HdVP2InstanceTransforms
+
+    The translate, rotate and scale primvars are kept in single precision like
+    their USD attributes, one array per component, and are composed in parallel
+    over ranges of instances.
+
+    The transform of an instance is composed as:
+        worldMatrix
+        * instanceTransform(index)
+        * scale(index)
+        * rotate(index)
+        * translate(index)
+        * instancerTransform
+
+    The composition is done in double precision, so that instance transforms
+    and instancers far from the origin don't lose precision.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2InstanceTransforms
+{
+public:
+    /*! \brief  Sample the instancer primvars of \p instanceCount instances.
+
+        Any primvar can be null. Missing primvars, primvars of an unsupported
+        type and instances past the end of a primvar are treated as identity.
+    */
+    void Update(
+        const GfMatrix4d&       instancerTransform,
+        size_t                  instanceCount,
+        const HdVtBufferSource* translations,
+        const HdVtBufferSource* rotations,
+        const HdVtBufferSource* scales,
+        const HdVtBufferSource* transforms);
+
+    //! Return the number of instances sampled by the last update.
+    size_t GetInstanceCount() const { return _instanceCount; }
+
+    //! Compose the transforms of the instances at \p indices.
+    void Compose(const VtIntArray& indices, VtMatrix4dArray& result) const;
+
+    //! Multiply already composed \p transforms by \p worldMatrix.
+    static void
+    Apply(const MMatrix& worldMatrix, const VtMatrix4dArray& transforms, MMatrixArray& result);
+
+private:
+    //! Components of the instances, stored one array per component.
+    enum _Component
+    {
+        _TranslateX,
+        _TranslateY,
+        _TranslateZ,
+        _RotateReal,
+        _RotateI,
+        _RotateJ,
+        _RotateK,
+        _ScaleX,
+        _ScaleY,
+        _ScaleZ,
+        _ComponentCount
+    };
+
+    GfMatrix4d              _instancerTransform { 1.0 };
+    size_t                  _instanceCount { 0 };
+    std::vector<float>      _components[_ComponentCount];
+    std::vector<GfMatrix4d> _transforms; //!< Empty when no instance has a transform
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_INSTANCE_TRANSFORMS
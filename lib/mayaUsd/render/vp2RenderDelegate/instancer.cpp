@@ -17,13 +17,7 @@
 //
 #include "instancer.h"
 
-#include "sampler.h"
-
 #include <pxr/base/gf/matrix4d.h>
-#include <pxr/base/gf/quaternion.h>
-#include <pxr/base/gf/rotation.h>
-#include <pxr/base/gf/vec3f.h>
-#include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
@@ -95,6 +89,10 @@ void HdVP2Instancer::Sync(
     if (*dirtyBits & HdChangeTracker::DirtyInstanceIndex) {
         _maxInstanceIndex = -1;
         _instanceIndicesByPrototype.clear();
+        {
+            std::lock_guard<std::mutex> lock(_prototypeTransformsMutex);
+            _prototypeTransforms.clear();
+        }
         auto prototypeIds = sceneDelegate->GetInstancerPrototypes(id);
         for (const auto& prototypeId : prototypeIds) {
             auto instanceIndices = sceneDelegate->GetInstanceIndices(id, prototypeId);
@@ -111,20 +109,19 @@ void HdVP2Instancer::Sync(
         || HdChangeTracker::IsAnyPrimvarDirty(*dirtyBits, id)
         || (*dirtyBits & HdChangeTracker::DirtyInstanceIndex);
     if (updateInstanceTransforms) {
-        // Initialize all transforms to the instancer's transform, on which we later
-        // apply the individual instances' transformations.
+        ++_version;
+
         // The transforms are computed by:
         // foreach(index : indices) {
-        //     instancerTransform
-        //     * hydra:translate(index)
-        //     * hydra:rotate(index)
+        //     hydra:instanceTransform(index)
         //     * hydra:scale(index)
-        //     * hydra:instanceTransform(index)
+        //     * hydra:rotate(index)
+        //     * hydra:translate(index)
+        //     * instancerTransform
         // }
         // If any transform isn't provided, it's assumed to be the identity.
-        GfMatrix4d instancerTransform = GetDelegate()->GetInstancerTransform(id);
-        _instanceTransforms = VtMatrix4dArray(_maxInstanceIndex + 1, instancerTransform);
-
+        // The primvars are only sampled here, the composition is done for each
+        // prototype in GetInstanceTransforms.
 #if HD_API_VERSION < 56
         TfToken translationsToken = HdInstancerTokens->translate;
         TfToken rotationsToken = HdInstancerTokens->rotate;
@@ -137,67 +134,18 @@ void HdVP2Instancer::Sync(
         TfToken transformsToken = HdInstancerTokens->instanceTransforms;
 #endif
 
-        // Translations
-        if (_primvarMap.count(translationsToken) > 0) {
-            HdVP2BufferSampler sampler(*_primvarMap[translationsToken]);
-            for (int instanceIndex = 0; instanceIndex <= _maxInstanceIndex; instanceIndex++) {
-                GfVec3f translate;
-                if (sampler.Sample(instanceIndex, &translate)) {
-                    GfMatrix4d translateMat(1);
-                    translateMat.SetTranslate(GfVec3d(translate));
-                    _instanceTransforms[instanceIndex]
-                        = translateMat * _instanceTransforms[instanceIndex];
-                }
-            }
-        }
-
-        // Rotations
-        if (_primvarMap.count(rotationsToken) > 0) {
-            HdVP2BufferSampler sampler(*_primvarMap[rotationsToken]);
-            for (int instanceIndex = 0; instanceIndex <= _maxInstanceIndex; instanceIndex++) {
-                GfQuath quath;
-                if (sampler.Sample(instanceIndex, &quath)) {
-                    GfMatrix4d rotateMat(1);
-                    rotateMat.SetRotate(quath);
-                    _instanceTransforms[instanceIndex]
-                        = rotateMat * _instanceTransforms[instanceIndex];
-                } else {
-                    GfVec4f quat;
-                    if (sampler.Sample(instanceIndex, &quat)) {
-                        GfMatrix4d rotateMat(1);
-                        rotateMat.SetRotate(GfQuatd(quat[0], quat[1], quat[2], quat[3]));
-                        _instanceTransforms[instanceIndex]
-                            = rotateMat * _instanceTransforms[instanceIndex];
-                    }
-                }
-            }
-        }
-
-        // Scales
-        if (_primvarMap.count(scalesToken) > 0) {
-            HdVP2BufferSampler sampler(*_primvarMap[scalesToken]);
-            for (int instanceIndex = 0; instanceIndex <= _maxInstanceIndex; instanceIndex++) {
-                GfVec3f scale;
-                if (sampler.Sample(instanceIndex, &scale)) {
-                    GfMatrix4d scaleMat(1);
-                    scaleMat.SetScale(GfVec3d(scale));
-                    _instanceTransforms[instanceIndex]
-                        = scaleMat * _instanceTransforms[instanceIndex];
-                }
-            }
-        }
-
-        // Transforms
-        if (_primvarMap.count(transformsToken) > 0) {
-            HdVP2BufferSampler sampler(*_primvarMap[transformsToken]);
-            for (int instanceIndex = 0; instanceIndex <= _maxInstanceIndex; instanceIndex++) {
-                GfMatrix4d transformMat;
-                if (sampler.Sample(instanceIndex, &transformMat)) {
-                    _instanceTransforms[instanceIndex]
-                        = transformMat * _instanceTransforms[instanceIndex];
-                }
-            }
-        }
+        auto findPrimvar = [this](const TfToken& name) -> const HdVtBufferSource* {
+            auto it = _primvarMap.find(name);
+            return it != _primvarMap.end() ? it->second.get() : nullptr;
+        };
+
+        _instanceTransforms.Update(
+            GetDelegate()->GetInstancerTransform(id),
+            _maxInstanceIndex + 1,
+            findPrimvar(translationsToken),
+            findPrimvar(rotationsToken),
+            findPrimvar(scalesToken),
+            findPrimvar(transformsToken));
     }
 }
 
@@ -218,18 +166,38 @@ VtMatrix4dArray HdVP2Instancer::GetInstanceTransforms(SdfPath const& prototypeId
 
     HdInstancer::_SyncInstancerAndParents(GetDelegate()->GetRenderIndex(), GetId());
 
+    // The draw items of a prototype all ask for the same transforms, compose them once
+    // per version of the instancer and its parents.
+    const size_t version = GetVersion();
+    {
+        std::lock_guard<std::mutex> lock(_prototypeTransformsMutex);
+        auto                        itCached = _prototypeTransforms.find(prototypeId);
+        if (itCached != _prototypeTransforms.end() && itCached->second.first == version) {
+            return itCached->second.second;
+        }
+    }
+
+    VtMatrix4dArray transforms = _ComposeInstanceTransforms(prototypeId);
+
+    std::lock_guard<std::mutex> lock(_prototypeTransformsMutex);
+    _prototypeTransforms[prototypeId] = std::make_pair(version, transforms);
+    return transforms;
+}
+
+/*! \brief  Composes the instance transforms of the prototype, flattening the nested
+            transforms if necessary.
+*/
+VtMatrix4dArray HdVP2Instancer::_ComposeInstanceTransforms(SdfPath const& prototypeId)
+{
     // Get the instance indices from our cache instead of querying the scene delegate.
     auto itInstanceIndices = _instanceIndicesByPrototype.find(prototypeId);
     if (itInstanceIndices == _instanceIndicesByPrototype.end()) {
         return {};
     }
 
-    // Retrieve only the instance transforms relevant to this prototype
-    auto            instanceIndices = itInstanceIndices->second;
-    VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); i++) {
-        transforms[i] = _instanceTransforms[instanceIndices[i]];
-    }
+    // Compose only the instance transforms relevant to this prototype
+    VtMatrix4dArray transforms;
+    _instanceTransforms.Compose(itInstanceIndices->second, transforms);
 
     if (GetParentId().IsEmpty()) {
         return transforms;
@@ -257,4 +225,39 @@ VtMatrix4dArray HdVP2Instancer::GetInstanceTransforms(SdfPath const& prototypeId
     return final;
 }
 
+size_t HdVP2Instancer::GetVersion() const
+{
+    size_t version = _version;
+    if (!GetParentId().IsEmpty()) {
+        const auto* parentInstancer = static_cast<const HdVP2Instancer*>(
+            GetDelegate()->GetRenderIndex().GetInstancer(GetParentId()));
+        if (parentInstancer) {
+            version += parentInstancer->GetVersion();
+        }
+    }
+    return version;
+}
+
+/*! \brief  Computes all instance transforms for the provided prototype id, premultiplied
+            by the world matrix of the prototype.
+
+    This is the format expected by VP2 for instanced render items. The instance
+    transforms are composed once per prototype, only the world matrix of each
+    draw item is applied here.
+
+    \param prototypeId The prototype to get transforms for.
+    \param worldMatrix The world matrix of the prototype.
+    \param transforms  One transform per instance, to apply when drawing.
+*/
+void HdVP2Instancer::GetInstanceTransforms(
+    SdfPath const& prototypeId,
+    const MMatrix& worldMatrix,
+    MMatrixArray&  transforms)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    HdVP2InstanceTransforms::Apply(worldMatrix, GetInstanceTransforms(prototypeId), transforms);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -18,6 +18,8 @@
 #ifndef HD_VP2_INSTANCER
 #define HD_VP2_INSTANCER
 
+#include "instanceTransforms.h"
+
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/token.h>
@@ -27,8 +29,12 @@
 #include <pxr/imaging/hd/vtBufferSource.h>
 #include <pxr/pxr.h>
 
+#include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
+
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -55,7 +61,18 @@ public:
 
     VtMatrix4dArray GetInstanceTransforms(SdfPath const& prototypeId);
 
+    void GetInstanceTransforms(
+        SdfPath const& prototypeId,
+        const MMatrix& worldMatrix,
+        MMatrixArray&  transforms);
+
+    //! Return a version that changes whenever the instance transforms of this
+    //! instancer or of its parents change.
+    size_t GetVersion() const;
+
 private:
+    VtMatrix4dArray _ComposeInstanceTransforms(SdfPath const& prototypeId);
+
     /*! Map of the latest primvar data for this instancer, keyed by
         primvar name. Primvar values are VtValue, an any-type; they are
         interpreted at consumption time (here, in ComputeInstanceTransforms).
@@ -68,8 +85,16 @@ private:
     int                                           _maxInstanceIndex = -1;
     TfHashMap<SdfPath, VtIntArray, SdfPath::Hash> _instanceIndicesByPrototype;
 
-    // Instance transforms cache
-    VtMatrix4dArray _instanceTransforms;
+    // Instance transform components, composed on demand for each prototype
+    HdVP2InstanceTransforms _instanceTransforms;
+
+    // Incremented whenever the instance transforms or indices are updated
+    size_t _version = 0;
+
+    // Composed instance transforms of each prototype, with the version they were composed at.
+    // Prototypes are synced in parallel, hence the mutex.
+    TfHashMap<SdfPath, std::pair<size_t, VtMatrix4dArray>, SdfPath::Hash> _prototypeTransforms;
+    std::mutex                                                             _prototypeTransformsMutex;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
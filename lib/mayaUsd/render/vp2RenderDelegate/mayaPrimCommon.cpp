@@ -24,13 +24,8 @@
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
-#include <mayaUsd/utils/util.h>
-
-#include <maya/MFnDisplayLayer.h>
-#include <maya/MFnDisplayLayerManager.h>
 #include <maya/MObjectArray.h>
 #endif
-#include <maya/M3dView.h>
 #include <maya/MProfiler.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -51,7 +46,6 @@ static const InstancePrototypePath sVoidInstancePrototypePath { SdfPath(), kNati
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
 
 namespace {
-std::mutex        sMayaMutex;
 MayaUsdCustomData sMayaUsdCustomData;
 } // namespace
 
@@ -681,50 +675,32 @@ void MayaUsdRPrim::_UpdatePrimvarSourcesGeneric(
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
 void MayaUsdRPrim::_ProcessDisplayLayerModes(
-    const MObject&     displayLayerObj,
-    DisplayLayerModes& displayLayerModes)
+    const ProxyRenderDelegate::DisplayLayerState* displayLayerState,
+    DisplayLayerModes&                            displayLayerModes)
 {
-    // Maya's MPlug API is not multithreadable, so we need the mutex here
-    std::lock_guard<std::mutex> mutexGuard(sMayaMutex);
-
-    MFnDependencyNode displayLayerNodeFn(displayLayerObj);
-    MPlug             layerEnabled = displayLayerNodeFn.findPlug("enabled");
-    if (!layerEnabled.asBool()) {
+    // The layer attributes were read on the main thread, Rprims are synced in parallel
+    if (!displayLayerState || !displayLayerState->enabled) {
         return;
     }
 
-    MPlug layerVisible = displayLayerNodeFn.findPlug("visibility");
-    MPlug layerHidesOnPlayback = displayLayerNodeFn.findPlug("hideOnPlayback");
-    MPlug layerDisplayType = displayLayerNodeFn.findPlug("displayType");
-    MPlug levelOfDetail = displayLayerNodeFn.findPlug("levelOfDetail");
-    MPlug shading = displayLayerNodeFn.findPlug("shading");
-    MPlug texturing = displayLayerNodeFn.findPlug("texturing");
-    MPlug colorIndex = displayLayerNodeFn.findPlug("color");
-    MPlug useRGBColors = displayLayerNodeFn.findPlug("overrideRGBColors");
-    MPlug colorRGB = displayLayerNodeFn.findPlug("overrideColorRGB");
-    MPlug colorA = displayLayerNodeFn.findPlug("overrideColorA");
-
-    displayLayerModes._visibility &= layerVisible.asBool();
-    displayLayerModes._hideOnPlayback |= layerHidesOnPlayback.asBool();
-    displayLayerModes._texturing = texturing.asBool();
-    if (levelOfDetail.asShort() != 0) {
+    displayLayerModes._visibility &= displayLayerState->visibility;
+    displayLayerModes._hideOnPlayback |= displayLayerState->hideOnPlayback;
+    displayLayerModes._texturing = displayLayerState->texturing;
+    if (displayLayerState->levelOfDetail != 0) {
         displayLayerModes._reprOverride = kBBox;
-    } else if (shading.asShort() == 0 && displayLayerModes._reprOverride != kBBox) {
+    } else if (displayLayerState->shading == 0 && displayLayerModes._reprOverride != kBBox) {
         displayLayerModes._reprOverride = kWire;
     }
     if (displayLayerModes._displayType == kNormal) {
-        displayLayerModes._displayType = (DisplayType)layerDisplayType.asShort();
+        displayLayerModes._displayType = (DisplayType)displayLayerState->displayType;
     }
 
-    if (useRGBColors.asBool()) {
-        auto          colorRGBHolder = UsdMayaUtil::GetPlugDataHandle(colorRGB);
-        const float3& rgbColor = colorRGBHolder->GetDataHandle().asFloat3();
+    if (displayLayerState->useRGBColors) {
         displayLayerModes._wireframeColorIndex = -1;
-        displayLayerModes._wireframeColorRGBA
-            = MColor(rgbColor[0], rgbColor[1], rgbColor[2], colorA.asFloat());
     } else {
-        displayLayerModes._wireframeColorIndex = colorIndex.asInt();
+        displayLayerModes._wireframeColorIndex = displayLayerState->colorIndex;
     }
+    displayLayerModes._wireframeColorRGBA = displayLayerState->colorRGBA;
 }
 
 void MayaUsdRPrim::_PopulateDisplayLayerModes(
@@ -739,7 +715,8 @@ void MayaUsdRPrim::_PopulateDisplayLayerModes(
     for (auto it = ancestorsRange.begin(); it != ancestorsRange.end(); ++it) {
         auto displayLayerObj = drawScene.GetDisplayLayer(*it);
         if (!displayLayerObj.isNull()) {
-            _ProcessDisplayLayerModes(displayLayerObj, displayLayerModes);
+            _ProcessDisplayLayerModes(
+                drawScene.GetDisplayLayerState(displayLayerObj), displayLayerModes);
         }
     }
 
@@ -749,7 +726,8 @@ void MayaUsdRPrim::_PopulateDisplayLayerModes(
     for (unsigned int j = 0; j < proxyShapeDisplayLayerCount; j++) {
         auto displayLayerObj = proxyShapeDisplayLayers[j];
         if (!displayLayerObj.isNull()) {
-            _ProcessDisplayLayerModes(displayLayerObj, displayLayerModes);
+            _ProcessDisplayLayerModes(
+                drawScene.GetDisplayLayerState(displayLayerObj), displayLayerModes);
         }
     }
 }
@@ -980,10 +958,7 @@ MColor MayaUsdRPrim::_GetHighlightColor(const TfToken& className)
 
 MColor MayaUsdRPrim::_GetWireframeColor()
 {
-    if (_displayLayerModes._wireframeColorIndex > 0) {
-        return MColor(M3dView::active3dView().colorAtIndex(
-            _displayLayerModes._wireframeColorIndex - 1, M3dView::kDormantColors));
-    } else if (_displayLayerModes._wireframeColorIndex < 0) {
+    if (_displayLayerModes._wireframeColorIndex != 0) {
         return _displayLayerModes._wireframeColorRGBA;
     } else {
         auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
@@ -1065,10 +1040,13 @@ bool MayaUsdRPrim::_FilterInstanceByDisplayLayer(
     int                    modFlags,
     bool                   isHighlightItem,
     bool                   isDedicatedHighlightItem,
-    InstanceColorOverride& colorOverride) const
+    InstanceColorOverride& colorOverride,
+    bool                   forceBBox) const
 {
+    const bool forcedBboxItem = (reprToken == HdVP2ReprTokens->forcedBbox);
     if (_displayLayerModesInstanced.size() <= usdInstanceId) {
-        return false;
+        // Instances at a bounding box level of detail are only drawn by the forcedBbox repr.
+        return forceBBox != forcedBboxItem;
     }
 
     // Verify display layer visibility
@@ -1077,11 +1055,11 @@ bool MayaUsdRPrim::_FilterInstanceByDisplayLayer(
         return true;
     }
 
-    // Process draw mode overrides
-    const bool forcedBboxItem = (reprToken == HdVP2ReprTokens->forcedBbox);
+    // Process draw mode overrides, the level of detail acting as a bbox override
     const bool forcedWireItem = (reprToken == HdVP2ReprTokens->forcedWire);
     const bool forcedUntexturedItem = (reprToken == HdVP2ReprTokens->forcedUntextured);
-    if (displayLayerModes._reprOverride == kNone) {
+    const auto reprOverride = forceBBox ? kBBox : displayLayerModes._reprOverride;
+    if (reprOverride == kNone) {
         if (displayLayerModes._texturing) {
             // In no-override mode, an instance should be drawn only by
             // the non-forced reprs, so skip the forced ones.
@@ -1099,14 +1077,14 @@ bool MayaUsdRPrim::_FilterInstanceByDisplayLayer(
                 return true;
             }
         }
-    } else if (displayLayerModes._reprOverride == kWire) {
+    } else if (reprOverride == kWire) {
         // Wire override cannot affect bbox mode so keep this repr
         // along with the forcedWire one.
         bool bboxItem = reprToken == HdVP2ReprTokens->bbox;
         if (!forcedWireItem && !bboxItem) {
             return true;
         }
-    } else if (displayLayerModes._reprOverride == kBBox) {
+    } else if (reprOverride == kBBox) {
         // Bbox override affects all draw modes.
         if (!forcedBboxItem) {
             return true;
@@ -1148,11 +1126,7 @@ bool MayaUsdRPrim::_FilterInstanceByDisplayLayer(
 
     // Now that we know that this instance will be rendered, let's check for color override.
     if (colorOverride._allowed && instanceColor == kDormant) {
-        if (displayLayerModes._wireframeColorIndex > 0) {
-            colorOverride._enabled = true;
-            colorOverride._color = MColor(M3dView::active3dView().colorAtIndex(
-                displayLayerModes._wireframeColorIndex - 1, M3dView::kDormantColors));
-        } else if (displayLayerModes._wireframeColorIndex < 0) {
+        if (displayLayerModes._wireframeColorIndex != 0) {
             colorOverride._enabled = true;
             colorOverride._color = displayLayerModes._wireframeColorRGBA;
         }
@@ -1166,6 +1140,7 @@ void MayaUsdRPrim::_SyncForcedReprs(
     HdSceneDelegate*  delegate,
     HdRenderParam*    renderParam,
     HdDirtyBits*      dirtyBits,
+    const TfToken&    reprToken,
     ReprVector const& reprs)
 {
     // Forced representations work only for instanced primitives
@@ -1191,10 +1166,31 @@ void MayaUsdRPrim::_SyncForcedReprs(
         }
     };
 
-    if (_forcedReprFlags & kForcedBBox) {
+    // The render items of the synced repr tell which forced reprs their instances need.
+    int instanceLodReprFlags = 0;
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+    RenderItemFunc getInstanceLodReprFlags
+        = [&instanceLodReprFlags](HdVP2DrawItem::RenderItemData& renderItemData) {
+              instanceLodReprFlags |= renderItemData._instanceLodReprFlags;
+          };
+    _ForEachRenderItemInRepr(_FindRepr(reprs, reprToken), getInstanceLodReprFlags);
+
+    // The bounding box items are culled again from scratch when next needed, so that the levels
+    // of detail of their instances start from the same state as the ones of the synced repr.
+    RenderItemFunc hideBBoxItem
+        = [&hideDrawItem](HdVP2DrawItem::RenderItemData& renderItemData) {
+              hideDrawItem(renderItemData);
+              renderItemData._instanceCuller.reset();
+              renderItemData._instanceLodReprFlags = 0;
+          };
+#else
+    RenderItemFunc& hideBBoxItem = hideDrawItem;
+#endif
+
+    if ((_forcedReprFlags | instanceLodReprFlags) & kForcedBBox) {
         refThis.Sync(delegate, renderParam, dirtyBits, HdVP2ReprTokens->forcedBbox);
     } else {
-        _ForEachRenderItemInRepr(_FindRepr(reprs, HdVP2ReprTokens->forcedBbox), hideDrawItem);
+        _ForEachRenderItemInRepr(_FindRepr(reprs, HdVP2ReprTokens->forcedBbox), hideBBoxItem);
     }
 
     if (_forcedReprFlags & kForcedWire) {
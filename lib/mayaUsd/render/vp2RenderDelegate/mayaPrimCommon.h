@@ -20,6 +20,7 @@
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
+#include <pxr/base/vt/value.h>
 #include <pxr/imaging/hd/changeTracker.h>
 #include <pxr/imaging/hd/types.h>
 
@@ -69,8 +70,17 @@ public:
 };
 #endif
 
+//! Primvar vertex buffer data staged in the frame memory of the HdVP2StagingPool, or read
+//! straight from the primvar array when it needs no conversion.
+struct PrimvarBufferData
+{
+    const void* _data { nullptr };
+    size_t      _size { 0 }; //!< Size of the data in bytes
+    VtValue     _source;     //!< Primvar array holding _data until the commit, if any
+};
+
 //! A primvar vertex buffer data map indexed by primvar name.
-using PrimvarBufferDataMap = std::unordered_map<TfToken, std::vector<char>, TfToken::HashFunctor>;
+using PrimvarBufferDataMap = std::unordered_map<TfToken, PrimvarBufferData, TfToken::HashFunctor>;
 
 //! \brief  Helper struct used to package all the changes into single commit task
 //!         (such commit task will be executed on main-thread)
@@ -153,7 +163,9 @@ public:
         // 1 or more of Maya's display layers have changed, so the compound effect
         // of display layers on this prim will need to be recomputed
         DirtyDisplayLayers = (DirtyDisplayMode << 1),
-        DirtyBitLast = DirtyDisplayLayers
+        // The view instances are culled against has changed
+        DirtyInstanceCulling = (DirtyDisplayLayers << 1),
+        DirtyBitLast = DirtyInstanceCulling
     };
 
     static const MColor       kOpaqueBlue;           //!< Opaque blue
@@ -220,7 +232,7 @@ protected:
         // positive - override with the given index
         int _wireframeColorIndex { 0 };
 
-        //! Wireframe color override
+        //! Wireframe color override, resolved on the main thread for palette indices
         MColor _wireframeColorRGBA;
     };
 
@@ -250,8 +262,11 @@ protected:
         void Reset() { _enabled = false; }
     };
 
-    static void
-    _ProcessDisplayLayerModes(const MObject& displayLayerObj, DisplayLayerModes& displayLayerModes);
+#ifdef MAYA_HAS_DISPLAY_LAYER_API
+    static void _ProcessDisplayLayerModes(
+        const ProxyRenderDelegate::DisplayLayerState* displayLayerState,
+        DisplayLayerModes&                            displayLayerModes);
+#endif
 
     static void _PopulateDisplayLayerModes(
         const SdfPath&       usdPath,
@@ -312,13 +327,15 @@ protected:
         int                    modFlags,
         bool                   isHighlightItem,
         bool                   isDedicatedHighlightItem,
-        InstanceColorOverride& colorOverride) const;
+        InstanceColorOverride& colorOverride,
+        bool                   forceBBox = false) const;
 
     void _SyncForcedReprs(
         HdRprim&          refThis,
         HdSceneDelegate*  delegate,
         HdRenderParam*    renderParam,
         HdDirtyBits*      dirtyBits,
+        const TfToken&    reprToken,
         ReprVector const& reprs);
 
     void _UpdatePrimvarSourcesGeneric(
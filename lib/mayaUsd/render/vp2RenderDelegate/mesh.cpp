@@ -22,7 +22,6 @@
 #include "renderDelegate.h"
 #include "tokens.h"
 
-#include <mayaUsd/base/tokens.h>
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 #include <mayaUsd/utils/colorSpace.h>
 
@@ -69,6 +68,11 @@ constexpr int sDrawModeSelectionHighlighting = MHWRender::MGeometry::kSelectionH
 constexpr int sDrawModeSelectionHighlighting = 0;
 #endif
 
+//! Changes preventing the points of a frame from being replayed from the playback cache.
+constexpr HdDirtyBits sPlaybackCacheExcludedBits = HdChangeTracker::DirtyTopology
+    | HdChangeTracker::DirtyPrimvar | HdChangeTracker::DirtyNormals
+    | HdChangeTracker::DirtyInstancer | HdChangeTracker::DirtyInstanceIndex;
+
 //! Helper utility function to fill primvar data to vertex buffer.
 template <class DEST_TYPE, class SRC_TYPE>
 void _FillPrimvarData(
@@ -805,6 +809,9 @@ void HdVP2Mesh::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
+    // Rprims are synced in parallel, the Maya API calls must be deferred to the commit.
+    HdVP2ResourceRegistry::SyncScope syncScope;
+
     if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
         return;
     }
@@ -818,10 +825,10 @@ void HdVP2Mesh::Sync(
     const SdfPath& id = GetId();
     HdRenderIndex& renderIndex = delegate->GetRenderIndex();
 
-#if !defined(USD_IMAGING_API_VERSION) || USD_IMAGING_API_VERSION < 18
     auto* const          param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
     ProxyRenderDelegate& drawScene = param->GetDrawScene();
-    UsdImagingDelegate*  usdImagingDelegate = drawScene.GetUsdImagingDelegate();
+#if !defined(USD_IMAGING_API_VERSION) || USD_IMAGING_API_VERSION < 18
+    UsdImagingDelegate* usdImagingDelegate = drawScene.GetUsdImagingDelegate();
 #endif
     // Geom subsets are accessed through the mesh topology. I need to know about
     // the additional materialIds that get bound by geom subsets before we build the
@@ -905,17 +912,31 @@ void HdVP2Mesh::Sync(
                | HdChangeTracker::DirtyInstanceIndex))
            != 0);
 
-    if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)
-        || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->normals)
-        || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->primvar) || instancerDirty) {
+    // When only the points changed, like during playback, the points and normals of this frame
+    // may have been cached on a previous loop.
+    HdVP2PlaybackCache* playbackCache = drawScene.GetPlaybackCache();
+    const UsdTimeCode   frame = param->GetFrame();
+    if (playbackCache
+        && (!frame.IsNumeric() || _pointsFromSkel
+            || (*dirtyBits & (HdChangeTracker::DirtyPoints | sPlaybackCacheExcludedBits))
+                != HdChangeTracker::DirtyPoints
+            || !_getInfo(_meshSharedData->_primvarInfo, HdTokens->points))) {
+        playbackCache = nullptr;
+    }
+    const bool replayed
+        = playbackCache && _ReplayPlaybackCache(*playbackCache, frame.GetValue(), dirtyBits);
+
+    if (!replayed
+        && (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)
+            || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->normals)
+            || HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->primvar)
+            || instancerDirty)) {
 
         auto addRequiredPrimvars = [&](const SdfPath& materialId) {
             TfTokenVector requiredPrimvars;
             if (!_GetMaterialPrimvars(renderIndex, materialId, requiredPrimvars)
                 || ((reprToken == HdVP2ReprTokens->smoothHullUntextured)
-                    && (MGlobal::optionVarIntValue(
-                            MayaUsdOptionVars->ShowDisplayColorTextureOff.GetText())
-                        != 0))) {
+                    && drawScene.GetShowDisplayColorTextureOff())) {
                 // if user selected present display color in untextured mode, use fallback shader as
                 // well
                 requiredPrimvars = sFallbackShaderPrimvars;
@@ -1072,6 +1093,10 @@ void HdVP2Mesh::Sync(
 
     _PrepareSharedVertexBuffers(delegate, *dirtyBits, reprToken);
 
+    if (playbackCache && !replayed) {
+        _UpdatePlaybackCache(*playbackCache, frame.GetValue(), *dirtyBits);
+    }
+
 #if PXR_VERSION > 2111
     const TfToken& renderTag = GetRenderTag();
 #else
@@ -1085,7 +1110,59 @@ void HdVP2Mesh::Sync(
     // Draw item update is controlled by its own dirty bits.
     _UpdateRepr(delegate, reprToken);
 
-    _SyncForcedReprs(*this, delegate, renderParam, dirtyBits, _reprs);
+    _SyncForcedReprs(*this, delegate, renderParam, dirtyBits, reprToken, _reprs);
+}
+
+/*! \brief  Restore the points and normals of \p time from the playback cache.
+
+    The replayed normals are flagged as authored normals rather than smooth normals, so that
+    they are copied to the vertex buffer without being recomputed.
+
+    \return False if \p time isn't cached.
+*/
+bool HdVP2Mesh::_ReplayPlaybackCache(
+    const HdVP2PlaybackCache& playbackCache,
+    double                    time,
+    HdDirtyBits*              dirtyBits)
+{
+    HdVP2PlaybackCache::Entry entry;
+    if (!playbackCache.Find(GetId(), time, &entry)) {
+        return false;
+    }
+
+    PrimvarInfo* pointsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->points);
+    pointsInfo->_source.data = entry.points;
+
+    PrimvarInfo* normalsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->normals);
+    if (normalsInfo && !entry.normals.IsEmpty()
+        && normalsInfo->_source.dataSource == PrimvarSource::CPUCompute) {
+        normalsInfo->_source.data = entry.normals;
+        *dirtyBits = (*dirtyBits & ~DirtySmoothNormals) | HdChangeTracker::DirtyNormals;
+    }
+    return true;
+}
+
+//! \brief  Cache the points of \p time, and the normals if they were computed on the CPU.
+void HdVP2Mesh::_UpdatePlaybackCache(
+    HdVP2PlaybackCache& playbackCache,
+    double              time,
+    HdDirtyBits         dirtyBits) const
+{
+    const PrimvarInfo* pointsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->points);
+    if (!pointsInfo) {
+        return;
+    }
+
+    HdVP2PlaybackCache::Entry entry;
+    entry.points = pointsInfo->_source.data;
+
+    PrimvarInfo* normalsInfo = _getInfo(_meshSharedData->_primvarInfo, HdTokens->normals);
+    if (normalsInfo && (dirtyBits & DirtySmoothNormals)
+        && normalsInfo->_source.dataSource == PrimvarSource::CPUCompute) {
+        entry.normals = normalsInfo->_source.data;
+    }
+
+    playbackCache.Insert(GetId(), time, entry);
 }
 
 /*! \brief  Returns the minimal set of dirty bits to place in the
@@ -1201,6 +1278,17 @@ void HdVP2Mesh::_InitRepr(const TfToken& reprToken, HdDirtyBits* dirtyBits)
     if (ARCH_UNLIKELY(!subSceneContainer))
         return;
 
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+    // Instances at the bounding box level of detail are drawn by the forcedBbox repr, which
+    // is otherwise only inited for instances in display layers.
+    const HdVP2CullingView* cullingView = param->GetDrawScene().GetInstanceCullingView();
+    if (cullingView && cullingView->lodScreenSize > 0.0
+        && reprToken != HdVP2ReprTokens->forcedBbox && !GetInstancerId().IsEmpty()
+        && !_FindRepr(_reprs, HdVP2ReprTokens->forcedBbox)) {
+        _InitRepr(HdVP2ReprTokens->forcedBbox, dirtyBits);
+    }
+#endif
+
     HdReprSharedPtr repr = _InitReprCommon(*this, reprToken, _reprs, dirtyBits, GetId());
     if (!repr)
         return;
@@ -1429,7 +1517,8 @@ void HdVP2Mesh::_CreateSmoothHullRenderItems(
                 warning += ") on GeomSubset \"";
                 warning += geomSubset.id.GetString().c_str();
                 warning += "\": greater than the number of faces in the mesh.";
-                MGlobal::displayWarning(warning);
+                _delegate->GetVP2ResourceRegistry().EnqueueCommit(
+                    [warning]() { MGlobal::displayWarning(warning); });
                 continue;
             }
             // we expect that material binding geom subsets will not overlap
@@ -1680,14 +1769,21 @@ void HdVP2Mesh::_UpdateDrawItem(
             // _updateRepr. Find the triangles which represent faces in the matching
             // geom subset and add those triangles to the index buffer for renderItem.
 
-            VtVec3iArray     trianglesFaceVertexIndices; // for this item only!
-            std::vector<int> faceIds;
+            // The subset triangles are gathered in staging memory reused from frame to frame.
+            HdVP2StagingPool& stagingPool = _delegate->GetVP2ResourceRegistry().GetStagingPool();
+            HdVP2StagingVector<GfVec3i> subsetTriangles { HdVP2StagingAllocator<GfVec3i>(
+                stagingPool) };
+            HdVP2StagingVector<int> faceIds { HdVP2StagingAllocator<int>(stagingPool) };
+
+            // Triangles of this item only!
+            const GfVec3i* triangles = nullptr;
+            size_t         numTriangles = 0;
             if (_meshSharedData->_faceIdToGeomSubsetId.size() == 0
                 || reprToken == HdVP2ReprTokens->defaultMaterial) {
                 // If there is no mapping from face to render item or if this is the default
-                // material item then all the faces are on this render item. VtArray has
-                // copy-on-write semantics so this is fast
-                trianglesFaceVertexIndices = _meshSharedData->_trianglesFaceVertexIndices;
+                // material item then all the faces are on this render item.
+                triangles = _meshSharedData->_trianglesFaceVertexIndices.cdata();
+                numTriangles = _meshSharedData->_trianglesFaceVertexIndices.size();
             } else {
                 for (size_t triangleId = 0; triangleId < _meshSharedData->_primitiveParam.size();
                      triangleId++) {
@@ -1696,10 +1792,12 @@ void HdVP2Mesh::_UpdateDrawItem(
                     if (_meshSharedData->_faceIdToGeomSubsetId[faceId]
                         == renderItemData._geomSubset.id) {
                         faceIds.push_back(faceId);
-                        trianglesFaceVertexIndices.push_back(
+                        subsetTriangles.push_back(
                             _meshSharedData->_trianglesFaceVertexIndices[triangleId]);
                     }
                 }
+                triangles = subsetTriangles.data();
+                numTriangles = subsetTriangles.size();
             }
 
             // It is possible that all elements in the opacity array are 1.
@@ -1732,7 +1830,8 @@ void HdVP2Mesh::_UpdateDrawItem(
                         }
                     }
                 } else {
-                    for (const auto& triangle : trianglesFaceVertexIndices) {
+                    for (size_t triangleId = 0; triangleId < numTriangles; ++triangleId) {
+                        const GfVec3i& triangle = triangles[triangleId];
 
                         int x = _meshSharedData->_renderingToSceneFaceVtxIds[triangle[0]];
                         int y = _meshSharedData->_renderingToSceneFaceVtxIds[triangle[1]];
@@ -1746,16 +1845,13 @@ void HdVP2Mesh::_UpdateDrawItem(
                 }
             }
 
-            const int numIndex = trianglesFaceVertexIndices.size() * 3;
+            const int numIndex = numTriangles * 3;
 
             stateToCommit._indexBufferData = numIndex > 0
                 ? static_cast<int*>(drawItemData._indexBuffer->acquire(numIndex, true))
                 : nullptr;
             if (stateToCommit._indexBufferData) {
-                memcpy(
-                    stateToCommit._indexBufferData,
-                    trianglesFaceVertexIndices.data(),
-                    numIndex * sizeof(int));
+                memcpy(stateToCommit._indexBufferData, triangles, numIndex * sizeof(int));
             }
         } else if (desc.geomStyle == HdMeshGeomStyleHullEdgeOnly) {
             unsigned int numIndex = _GetNumOfEdgeIndices(topologyToUse);
@@ -1789,14 +1885,9 @@ void HdVP2Mesh::_UpdateDrawItem(
                 renderIndex.GetSprim(HdPrimTypeTokens->material, materialId));
 
             if (material) {
-                const MString optionVarName(
-                    MayaUsdOptionVars->ShowDisplayColorTextureOff.GetText());
-
                 // if untextured mode with show display color specified, use fallback shader
                 if ((reprToken == HdVP2ReprTokens->smoothHullUntextured)
-                    && (MGlobal::optionVarIntValue(
-                            MayaUsdOptionVars->ShowDisplayColorTextureOff.GetText())
-                        != 0)) {
+                    && drawScene.GetShowDisplayColorTextureOff()) {
                     drawItemData._shaderIsFallback = true;
                 } else {
                     const HdCullStyle cullStyle = GetCullStyle(sceneDelegate);
@@ -1879,11 +1970,12 @@ void HdVP2Mesh::_UpdateDrawItem(
         // Retrieve instance transforms from the instancer.
         HdVP2Instancer* instancer
             = static_cast<HdVP2Instancer*>(renderIndex.GetInstancer(GetInstancerId()));
-        VtMatrix4dArray transforms
-            = instancer ? instancer->GetInstanceTransforms(id) : VtMatrix4dArray();
+        MMatrixArray transforms;
+        if (instancer) {
+            instancer->GetInstanceTransforms(id, worldMatrix, transforms);
+        }
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        const unsigned int instanceCount = transforms.length();
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
@@ -2031,6 +2123,26 @@ void HdVP2Mesh::_UpdateDrawItem(
             if (itemDirtyBits & MayaUsdRPrim::DirtyDisplayLayers) {
                 _SyncDisplayLayerModesInstanced(id, instanceCount);
             }
+
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+            // Instances outside of the view are not submitted to VP2. Selection and
+            // snapping still resolve to the right USD instances through mayaToUsd.
+            // Small instances are drawn as bounding boxes by the forcedBbox repr.
+            const std::vector<uint8_t>* visibleInstances = nullptr;
+            if (const HdVP2CullingView* cullingView = drawScene.GetInstanceCullingView()) {
+                if (!renderItemData._instanceCuller) {
+                    renderItemData._instanceCuller = std::make_unique<HdVP2InstanceCuller>();
+                }
+                HdVP2InstanceCuller& culler = *renderItemData._instanceCuller;
+                culler.Update(instancer->GetVersion(), worldMatrix, range, transforms);
+                visibleInstances = &culler.Cull(*cullingView);
+                renderItemData._instanceLodReprFlags
+                    = culler.GetBoundingBoxCount() ? kForcedBBox : 0;
+            } else {
+                renderItemData._instanceCuller.reset();
+                renderItemData._instanceLodReprFlags = 0;
+            }
+#endif
             const int             modFlags = drawItem->GetModFlags();
             InstanceColorOverride colorOverride(useWireframeColors);
 
@@ -2040,8 +2152,18 @@ void HdVP2Mesh::_UpdateDrawItem(
                 auto info = instanceInfo[usdInstanceId];
                 if (info == kInvalid)
                     continue;
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+                const uint8_t visibility
+                    = visibleInstances ? (*visibleInstances)[usdInstanceId]
+                                       : uint8_t(HdVP2InstanceCuller::kFullDetail);
+                if (visibility == HdVP2InstanceCuller::kCulled)
+                    continue;
+                const bool lodBBox = (visibility == HdVP2InstanceCuller::kBoundingBox);
+#else
+                const bool lodBBox = false;
+#endif
 
-                // Check display layer modes of this instance
+                // Check display layer modes and level of detail of this instance
                 colorOverride.Reset();
                 if (_FilterInstanceByDisplayLayer(
                         usdInstanceId,
@@ -2050,15 +2172,15 @@ void HdVP2Mesh::_UpdateDrawItem(
                         modFlags,
                         isHighlightItem,
                         isDedicatedHighlightItem,
-                        colorOverride))
+                        colorOverride,
+                        lodBBox))
                     continue;
 
 #ifndef MAYA_UPDATE_UFE_IDENTIFIER_SUPPORT
                 stateToCommit._ufeIdentifiers.append(
                     drawScene.GetScenePrimPath(GetId(), usdInstanceId).GetString().c_str());
 #endif
-                transforms[usdInstanceId].Get(instanceMatrix.matrix);
-                stateToCommit._instanceTransforms->append(worldMatrix * instanceMatrix);
+                stateToCommit._instanceTransforms->append(transforms[usdInstanceId]);
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
                 mayaToUsd.push_back(usdInstanceId);
 #endif
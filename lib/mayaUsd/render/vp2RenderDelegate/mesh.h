@@ -135,6 +135,9 @@ private:
 
     bool _PrimvarIsRequired(const TfToken&) const;
 
+    bool _ReplayPlaybackCache(const HdVP2PlaybackCache&, double time, HdDirtyBits*);
+    void _UpdatePlaybackCache(HdVP2PlaybackCache&, double time, HdDirtyBits) const;
+
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
     void _CreateViewportCompute();
 #endif
@@ -204,7 +207,7 @@ private:
     //! Custom dirty bits used by this mesh
     enum DirtyBits : HdDirtyBits
     {
-        DirtySmoothNormals = MayaUsdRPrim::DirtyBitLast,
+        DirtySmoothNormals = (MayaUsdRPrim::DirtyBitLast << 1),
         DirtyFlatNormals = (DirtySmoothNormals << 1),
         //! "Forward" the enumerated types here so we don't have to keep writing MayaUsdRPrim in
         //! the cpp file.
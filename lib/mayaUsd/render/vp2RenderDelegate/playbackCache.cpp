@@ -0,0 +1,115 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "playbackCache.h"
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! Return the size in bytes of \p value, or 0 if it isn't a VtVec3fArray.
+size_t _GetArrayByteSize(const VtValue& value)
+{
+    if (!value.IsHolding<VtVec3fArray>()) {
+        return 0;
+    }
+    return value.UncheckedGet<VtVec3fArray>().size() * sizeof(GfVec3f);
+}
+
+} // namespace
+
+//! \brief  Return the bytes charged for \p entry, or 0 if it can't be cached.
+size_t HdVP2PlaybackCache::_GetByteSize(const Entry& entry)
+{
+    const size_t pointsSize = _GetArrayByteSize(entry.points);
+    if (pointsSize == 0) {
+        return 0;
+    }
+
+    size_t normalsSize = 0;
+    if (!entry.normals.IsEmpty()) {
+        normalsSize = _GetArrayByteSize(entry.normals);
+        if (normalsSize == 0) {
+            return 0;
+        }
+    }
+    return pointsSize + normalsSize;
+}
+
+bool HdVP2PlaybackCache::Find(const SdfPath& id, double time, Entry* entry) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto it = _entries.find({ id, time });
+    if (it == _entries.end()) {
+        return false;
+    }
+    if (entry) {
+        *entry = it->second;
+    }
+    return true;
+}
+
+bool HdVP2PlaybackCache::Insert(const SdfPath& id, double time, const Entry& entry)
+{
+    const size_t byteSize = _GetByteSize(entry);
+    if (byteSize == 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto   it = _entries.find({ id, time });
+    size_t replacedSize = 0;
+    if (it != _entries.end()) {
+        replacedSize = _GetByteSize(it->second);
+    }
+    if (_usedBytes - replacedSize + byteSize > _budget) {
+        return false;
+    }
+
+    _usedBytes = _usedBytes - replacedSize + byteSize;
+    if (it != _entries.end()) {
+        it->second = entry;
+    } else {
+        _entries.emplace(_Key { id, time }, entry);
+    }
+    return true;
+}
+
+void HdVP2PlaybackCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _entries.clear();
+    _usedBytes = 0;
+}
+
+size_t HdVP2PlaybackCache::GetUsedBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _usedBytes;
+}
+
+size_t HdVP2PlaybackCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,115 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PLAYBACK_CACHE
+#define HD_VP2_PLAYBACK_CACHE
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/value.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Cache of the animated vertex data of the Rprims, per frame
+    \class  HdVP2PlaybackCache
+
+    When a frame range is played in a loop, the points of the animated meshes
+    are read from the stage, and their normals recomputed, every time the loop
+    comes round. The cache keeps these arrays for each frame played, so that
+    the next loops only have to copy them to the vertex buffers.
+
+    The arrays are shared with the Rprims, the cache only holds a reference.
+    Their size is still charged to the memory budget of the cache: once it is
+    reached, new frames are no longer cached. Evicting the oldest frames instead
+    would be pointless when looping over a range larger than the budget, since
+    every evicted frame would be needed again before any of the cached ones.
+
+    The cache must be cleared whenever the stage changes. All functions are
+    thread safe.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2PlaybackCache
+{
+public:
+    //! Vertex data of an Rprim at a frame
+    struct Entry
+    {
+        VtValue points;  //!< VtVec3fArray of the points
+        VtValue normals; //!< VtVec3fArray of the computed normals, empty if not cached
+    };
+
+    //! \brief  Construct a cache holding at most \p budget bytes.
+    explicit HdVP2PlaybackCache(size_t budget)
+        : _budget(budget)
+    {
+    }
+
+    //! \brief  Return true and fill \p entry if the data of \p id at \p time is cached.
+    bool Find(const SdfPath& id, double time, Entry* entry) const;
+
+    /*! \brief  Cache the data of \p id at \p time.
+
+        \return False if the data isn't made of VtVec3fArray or doesn't fit in the budget.
+    */
+    bool Insert(const SdfPath& id, double time, const Entry& entry);
+
+    //! \brief  Remove all the cached data.
+    void Clear();
+
+    //! \brief  Return the maximum number of bytes held by the cache.
+    size_t GetBudget() const { return _budget; }
+
+    //! \brief  Return the number of bytes held by the cache.
+    size_t GetUsedBytes() const;
+
+    //! \brief  Return the number of frames cached, over all the Rprims.
+    size_t GetEntryCount() const;
+
+private:
+    struct _Key
+    {
+        SdfPath id;
+        double  time;
+
+        bool operator==(const _Key& other) const { return time == other.time && id == other.id; }
+    };
+
+    struct _KeyHash
+    {
+        size_t operator()(const _Key& key) const
+        {
+            const size_t hash = SdfPath::Hash()(key.id);
+            return hash ^ (std::hash<double>()(key.time) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+        }
+    };
+
+    static size_t _GetByteSize(const Entry& entry);
+
+    const size_t _budget;
+    size_t       _usedBytes { 0 };
+
+    mutable std::mutex                        _mutex;
+    std::unordered_map<_Key, Entry, _KeyHash> _entries;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_PLAYBACK_CACHE
@@ -39,6 +39,12 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstring>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -56,33 +62,72 @@ namespace {
 const TfTokenVector sFallbackShaderPrimvars
     = { HdTokens->displayColor, HdTokens->displayOpacity, HdTokens->normals, HdTokens->widths };
 
+//! Number of points processed by a task of the parallel loops.
+constexpr size_t _kPointGrainSize = 64 * 1024;
+
+//! Call \p fn on ranges of the \p count points, in parallel when there are enough of them.
+template <typename Fn> void _ParallelForPoints(size_t count, Fn fn)
+{
+    if (count <= _kPointGrainSize) {
+        fn(0, count);
+        return;
+    }
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, count, _kPointGrainSize),
+        [&fn](const tbb::blocked_range<size_t>& range) { fn(range.begin(), range.end()); });
+}
+
+/*! \brief  Return the values of the \p numVerts points from \p authoredData.
+
+    Vertex data is returned as is with a \p stride of 1. Uniform data, and the
+    default value used when the data doesn't match the points, are returned
+    with a \p stride of 0 so that the same element is read for every point.
+*/
 template <typename BaseType>
-VtArray<BaseType> _BuildInterpolatedArray(
+const BaseType* _GetInterpolatedData(
     size_t                   numVerts,
     const VtArray<BaseType>& authoredData,
-    const BaseType&          defaultValue)
+    const BaseType&          defaultValue,
+    size_t&                  stride)
 {
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
+    const size_t size = authoredData.size();
+
+    if (size == numVerts) {
+        // Vertex data
+        stride = 1;
+        return authoredData.cdata();
+    }
 
+    stride = 0;
     if (size == 1) {
         // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
-    } else if (size == numVerts) {
-        // Vertex data
-        result = authoredData;
-    } else {
-        // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
-        TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+        return authoredData.cdata();
     }
 
-    return result;
+    // Fallback
+    TF_WARN("Incorrect number of primvar data, using default value for rendering.");
+    return &defaultValue;
+}
+
+//! Write the values of the \p numVerts points from \p authoredData to \p bufferData.
+template <typename BaseType>
+void _FillInterpolatedData(
+    size_t                   numVerts,
+    const VtArray<BaseType>& authoredData,
+    const BaseType&          defaultValue,
+    BaseType*                bufferData)
+{
+    size_t          stride = 0;
+    const BaseType* data = _GetInterpolatedData(numVerts, authoredData, defaultValue, stride);
+
+    _ParallelForPoints(numVerts, [=](size_t begin, size_t end) {
+        if (stride) {
+            memcpy(bufferData + begin, data + begin, (end - begin) * sizeof(BaseType));
+        } else {
+            std::fill(bufferData + begin, bufferData + end, *data);
+        }
+    });
 }
 
 } // anonymous namespace
@@ -114,6 +159,8 @@ void HdVP2Points::Sync(
     HdDirtyBits*     dirtyBits,
     TfToken const&   reprToken)
 {
+    HdVP2ResourceRegistry::SyncScope syncScope;
+
     if (!_SyncCommon(*this, delegate, renderParam, dirtyBits, _GetRepr(reprToken), reprToken)) {
         return;
     }
@@ -206,6 +253,7 @@ template <typename BaseType>
 void PreparePrimvarBuffer(
     HdVP2PointsSharedData&                    pointsSharedData,
     MayaUsdCommitState&                       stateToCommit,
+    HdVP2StagingPool&                         stagingPool,
     const TfToken&                            primvarToken,
     const TfToken&                            bufferToken,
     const MHWRender::MVertexBufferDescriptor& vbDesc,
@@ -227,9 +275,6 @@ void PreparePrimvarBuffer(
         primvarArray.push_back(defaultValue);
     }
 
-    primvarArray
-        = _BuildInterpolatedArray(pointsSharedData._points.size(), primvarArray, defaultValue);
-
     MHWRender::MVertexBuffer* primvarBuffer = pointsSharedData._primvarBuffers[bufferToken].get();
 
     if (!primvarBuffer) {
@@ -237,11 +282,18 @@ void PreparePrimvarBuffer(
         pointsSharedData._primvarBuffers[bufferToken].reset(primvarBuffer);
     }
 
-    unsigned int numElems = primvarArray.size();
+    const size_t numElems = pointsSharedData._points.size();
     if (primvarBuffer && numElems > 0) {
-        auto& bufferData = stateToCommit._primvarBufferDataMap[bufferToken];
-        bufferData.resize(numElems * sizeof(BaseType));
-        memcpy(&bufferData[0], primvarArray.cdata(), numElems * sizeof(BaseType));
+        const size_t numBytes = numElems * sizeof(BaseType);
+        if (primvarArray.size() == numElems) {
+            // Vertex data is committed straight from the primvar array.
+            stateToCommit._primvarBufferDataMap[bufferToken]
+                = { primvarArray.cdata(), numBytes, VtValue(primvarArray) };
+        } else {
+            BaseType* bufferData = stagingPool.AllocateForFrame<BaseType>(numElems);
+            _FillInterpolatedData(numElems, primvarArray, defaultValue, bufferData);
+            stateToCommit._primvarBufferDataMap[bufferToken] = { bufferData, numBytes };
+        }
     }
 }
 
@@ -278,6 +330,8 @@ void HdVP2Points::_UpdateDrawItem(
 
     const auto& primvarSourceMap = _pointsSharedData._primvarSourceMap;
 
+    HdVP2StagingPool& stagingPool = _delegate->GetVP2ResourceRegistry().GetStagingPool();
+
     const MHWRender::MGeometry::DrawMode drawMode = renderItem->drawMode();
 
     // The bounding box item uses a globally-shared geometry data therefore it
@@ -307,9 +361,6 @@ void HdVP2Points::_UpdateDrawItem(
                 normals.push_back(defaultNormal);
             }
 
-            normals
-                = _BuildInterpolatedArray(_pointsSharedData._points.size(), normals, defaultNormal);
-
             if (!_pointsSharedData._normalsBuffer) {
                 const MHWRender::MVertexBufferDescriptor vbDesc(
                     "", MHWRender::MGeometry::kNormal, MHWRender::MGeometry::kFloat, 3);
@@ -317,11 +368,12 @@ void HdVP2Points::_UpdateDrawItem(
                 _pointsSharedData._normalsBuffer.reset(new MHWRender::MVertexBuffer(vbDesc));
             }
 
-            unsigned int numNormals = normals.size();
+            const unsigned int numNormals = _pointsSharedData._points.size();
             if (_pointsSharedData._normalsBuffer && numNormals > 0) {
                 void* bufferData = _pointsSharedData._normalsBuffer->acquire(numNormals, true);
                 if (bufferData) {
-                    memcpy(bufferData, normals.cdata(), numNormals * sizeof(GfVec3f));
+                    _FillInterpolatedData<GfVec3f>(
+                        numNormals, normals, defaultNormal, static_cast<GfVec3f*>(bufferData));
                     _CommitMVertexBuffer(_pointsSharedData._normalsBuffer.get(), bufferData);
                 }
             }
@@ -335,6 +387,7 @@ void HdVP2Points::_UpdateDrawItem(
             PreparePrimvarBuffer(
                 _pointsSharedData,
                 stateToCommit,
+                stagingPool,
                 _tokens->tangents,
                 _tokens->tangents,
                 vbDesc,
@@ -359,13 +412,25 @@ void HdVP2Points::_UpdateDrawItem(
                     const auto& bufferToken
                         = (token == HdTokens->widths) ? _tokens->spriteWidth : token;
                     PreparePrimvarBuffer(
-                        _pointsSharedData, stateToCommit, token, bufferToken, vbDesc, 1.f);
+                        _pointsSharedData,
+                        stateToCommit,
+                        stagingPool,
+                        token,
+                        bufferToken,
+                        vbDesc,
+                        1.f);
                 } else if (value.IsHolding<VtVec2fArray>()) {
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", MHWRender::MGeometry::kTexture, MHWRender::MGeometry::kFloat, 2);
 
                     PreparePrimvarBuffer(
-                        _pointsSharedData, stateToCommit, token, token, vbDesc, GfVec2f(0.f, 0.f));
+                        _pointsSharedData,
+                        stateToCommit,
+                        stagingPool,
+                        token,
+                        token,
+                        vbDesc,
+                        GfVec2f(0.f, 0.f));
                 } else if (value.IsHolding<VtVec3fArray>()) {
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", MHWRender::MGeometry::kTexture, MHWRender::MGeometry::kFloat, 3);
@@ -373,6 +438,7 @@ void HdVP2Points::_UpdateDrawItem(
                     PreparePrimvarBuffer(
                         _pointsSharedData,
                         stateToCommit,
+                        stagingPool,
                         token,
                         token,
                         vbDesc,
@@ -507,19 +573,15 @@ void HdVP2Points::_UpdateDrawItem(
             }
 
             if (prepareCPVBuffer) {
-                colorArray = _BuildInterpolatedArray(
-                    _pointsSharedData._points.size(), colorArray, defaultColor);
-                alphaArray
-                    = _BuildInterpolatedArray(_pointsSharedData._points.size(), alphaArray, 1.f);
-
-                const size_t numColors = colorArray.size();
-                const size_t numAlphas = alphaArray.size();
-                const size_t numVertices = std::min(numColors, numAlphas);
-
-                if (numColors != numAlphas) {
-                    TF_CODING_ERROR(
-                        "color and opacity do not match for points %s", id.GetName().c_str());
-                }
+                const size_t numVertices = _pointsSharedData._points.size();
+
+                size_t         colorStride = 0;
+                const GfVec3f* colors
+                    = _GetInterpolatedData(numVertices, colorArray, defaultColor, colorStride);
+                const float  defaultAlpha = 1.f;
+                size_t       alphaStride = 0;
+                const float* alphas
+                    = _GetInterpolatedData(numVertices, alphaArray, defaultAlpha, alphaStride);
 
                 // Fill color and opacity into the float4 color stream.
                 if (!_pointsSharedData._colorBuffer) {
@@ -533,15 +595,16 @@ void HdVP2Points::_UpdateDrawItem(
                     _pointsSharedData._colorBuffer->acquire(numVertices, true));
 
                 if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t v = 0; v < numVertices; v++) {
-                        const GfVec3f& color = colorArray[v];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[v];
-                    }
+                    _ParallelForPoints(numVertices, [=](size_t begin, size_t end) {
+                        float* out = bufferData + begin * 4;
+                        for (size_t v = begin; v < end; v++) {
+                            const GfVec3f& color = colors[v * colorStride];
+                            *out++ = color[0];
+                            *out++ = color[1];
+                            *out++ = color[2];
+                            *out++ = alphas[v * alphaStride];
+                        }
+                    });
 
                     _CommitMVertexBuffer(_pointsSharedData._colorBuffer.get(), bufferData);
                 }
@@ -599,20 +662,17 @@ void HdVP2Points::_UpdateDrawItem(
         // Retrieve instance transforms from the instancer.
         HdVP2Instancer* instancer
             = static_cast<HdVP2Instancer*>(renderIndex.GetInstancer(GetInstancerId()));
-        VtMatrix4dArray transforms
-            = instancer ? instancer->GetInstanceTransforms(id) : VtMatrix4dArray();
+        if (instancer) {
+            instancer->GetInstanceTransforms(id, worldMatrix, *stateToCommit._instanceTransforms);
+        }
 
-        MMatrix            instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        const unsigned int instanceCount = stateToCommit._instanceTransforms->length();
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
         } else {
             const SdfPathVector usdPaths = drawScene.GetScenePrimPaths(id, instanceCount);
-            stateToCommit._instanceTransforms->setLength(instanceCount);
             for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
-                (*stateToCommit._instanceTransforms)[i] = worldMatrix * instanceMatrix;
                 stateToCommit._ufeIdentifiers.append(usdPaths[i].GetString().c_str());
             }
 
@@ -784,15 +844,15 @@ void HdVP2Points::_UpdateDrawItem(
 
         // If available, something changed
         for (const auto& entry : stateToCommit._primvarBufferDataMap) {
-            auto& primvarBufferData = entry.second;
-            if (!primvarBufferData.empty()) {
+            const PrimvarBufferData& primvarBufferData = entry.second;
+            if (primvarBufferData._size > 0) {
                 const auto it = primvarBuffers->find(entry.first);
                 if (it != primvarBuffers->end()) {
                     if (auto primvarBuffer = it->second.get()) {
                         const auto&  desc = primvarBuffer->descriptor();
                         unsigned int numElems
-                            = primvarBufferData.size() / (desc.dataTypeSize() * desc.dimension());
-                        primvarBuffer->update(&primvarBufferData[0], 0, numElems, true);
+                            = primvarBufferData._size / (desc.dataTypeSize() * desc.dimension());
+                        primvarBuffer->update(primvarBufferData._data, 0, numElems, true);
                     }
                 }
             }
@@ -31,6 +31,7 @@
 #include <usdUfe/ufe/Utils.h>
 
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
@@ -53,6 +54,7 @@
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/gprim.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 
 #include <maya/MColorPickerUtilities.h>
@@ -98,6 +100,31 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_INSTANCE_CULLING,
+    false,
+    "This env flag enables the CPU culling of the instances of point instancers against the "
+    "viewport camera. Culled instances are not submitted to VP2. Culling uses the last viewport "
+    "drawn, it is meant for scenes viewed in a single viewport.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_INSTANCE_CULLING_MIN_SCREEN_SIZE,
+    0,
+    "When instance culling is enabled, instances smaller than this size in pixels are culled.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_PLAYBACK_CACHE_MB,
+    0,
+    "This env flag sets the memory budget, in megabytes, of the cache of animated mesh points "
+    "and normals. When a frame range is played in a loop, the frames cached on the first loop "
+    "are replayed on the next ones. The cache is disabled when set to 0.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_INSTANCE_LOD_SCREEN_SIZE,
+    0,
+    "Instances of point instancers smaller than this size in pixels are drawn as bounding boxes. "
+    "Like instance culling, the level of detail uses the last viewport drawn.");
+
 namespace {
 
 //! Representation selector for point snapping
@@ -633,6 +660,11 @@ void ProxyRenderDelegate::_ClearRenderDelegate()
     _changeVersions.reset();
     _taskRenderTagsValid = false;
     _isPopulated = false;
+
+    if (_playbackCache) {
+        _playbackCache->Clear();
+    }
+    _rootPrimTransform = RootPrimTransformCache();
 }
 
 //! \brief  Clear data which is now stale because proxy shape attributes have changed
@@ -833,11 +865,11 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
     MProfilingScope profilingScope(
         HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "UpdateSceneDelegate");
 
+    const UsdTimeCode timeCode = _proxyShapeData->ProxyShape()->getTime();
     {
         MProfilingScope subProfilingScope(
             HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "SetTime");
 
-        const UsdTimeCode timeCode = _proxyShapeData->ProxyShape()->getTime();
         _sceneDelegate->SetTime(timeCode);
     }
 
@@ -851,12 +883,9 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
     const MMatrix inclusiveMatrix = _proxyShapeData->ProxyDagPath().inclusiveMatrix();
     GfMatrix4d    transform(inclusiveMatrix.matrix);
 
-    if (_proxyShapeData->ProxyShape()->usdPrim().GetPath() != SdfPath::AbsoluteRootPath()) {
-        const UsdTimeCode timeCode = _proxyShapeData->ProxyShape()->getTime();
-        UsdGeomXformCache xformCache(timeCode);
-        GfMatrix4d        m
-            = xformCache.GetLocalToWorldTransform(_proxyShapeData->ProxyShape()->usdPrim());
-        transform = m * transform;
+    const UsdPrim rootPrim = _proxyShapeData->ProxyShape()->usdPrim();
+    if (rootPrim.GetPath() != SdfPath::AbsoluteRootPath()) {
+        transform = _GetRootPrimTransform(rootPrim, timeCode) * transform;
     }
 
     constexpr double tolerance = 1e-9;
@@ -1091,8 +1120,14 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
     UpdateProxyShapeDisplayLayers();
+    _UpdateDisplayLayerStates();
 #endif
 
+    _showDisplayColorTextureOff
+        = MGlobal::optionVarIntValue(MayaUsdOptionVars->ShowDisplayColorTextureOff.GetText()) != 0;
+
+    _UpdatePlaybackCache();
+
     // If update for selection is enabled, the draw data for the "points" repr
     // won't be prepared until point snapping is activated; otherwise the draw
     // data have to be prepared early for possible activation of point snapping.
@@ -1176,6 +1211,7 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
         frameContext.viewTransformName(colorTransformId);
         if (colorTransformId != _colorTransformId) {
             _colorTransformId = colorTransformId;
+            ++_colorCacheVersion;
             dirtyBits |= MayaUsdRPrim::DirtySelectionHighlight;
         }
 #endif
@@ -1205,10 +1241,106 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             }
         }
 
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+        // Selection passes don't change the culling, so that the instances that
+        // can be picked are the ones drawn in the viewport.
+        if (!inSelectionPass) {
+            _UpdateInstanceCulling(frameContext, forcePopulateSelection);
+        }
+#endif
+
+        // The Rprims are synced on worker threads, which must not use the Maya command engine.
+        // The colors are only queried again when the color preferences or space changed.
+        if (_prefetchedColorCacheVersion != _colorCacheVersion) {
+            _PrefetchMayaState();
+            _prefetchedColorCacheVersion = _colorCacheVersion;
+        }
+
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
     }
 }
 
+/*! \brief  Query the Maya state cached before the Rprims are synced.
+
+    The colors are cached until the color preferences or the color space change, so the
+    Rprims only read them from the cache.
+*/
+void ProxyRenderDelegate::_PrefetchMayaState()
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L2, "Prefetch Maya state");
+
+    GetWireframeColor();
+    GetTemplateColor(true);
+    GetTemplateColor(false);
+    GetReferenceColor();
+    GetDefaultColor(HdPrimTypeTokens->basisCurves);
+    GetDefaultColor(HdPrimTypeTokens->points);
+    GetSelectionHighlightColor();
+    GetSelectionHighlightColor(HdPrimTypeTokens->mesh);
+    GetSelectionHighlightColor(HdPrimTypeTokens->basisCurves);
+    GetSelectionHighlightColor(HdPrimTypeTokens->points);
+}
+
+/*! \brief  Return the transform in the stage of the prim used as the root of the proxy shape.
+
+    Computing it requires a walk up the ancestors of the prim, so it is only done again when
+    the stage changed or, if one of the ancestors is animated, when the time changed.
+*/
+const GfMatrix4d&
+ProxyRenderDelegate::_GetRootPrimTransform(const UsdPrim& rootPrim, const UsdTimeCode& timeCode)
+{
+    RootPrimTransformCache& cache = _rootPrimTransform;
+
+    const MInt64 stageCounter = _proxyShapeData->ProxyShape()->getUsdStageUpdateCounter();
+    if (cache.prim == rootPrim && cache.stageCounter == stageCounter
+        && (!cache.timeVarying || cache.time == timeCode)) {
+        return cache.transform;
+    }
+
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorC_L1, "ComputeRootPrimTransform");
+
+    UsdGeomXformCache xformCache(timeCode);
+    cache.transform = xformCache.GetLocalToWorldTransform(rootPrim);
+    cache.prim = rootPrim;
+    cache.time = timeCode;
+    cache.stageCounter = stageCounter;
+
+    cache.timeVarying = false;
+    for (UsdPrim prim = rootPrim; prim && !prim.IsPseudoRoot(); prim = prim.GetParent()) {
+        if (xformCache.TransformMightBeTimeVarying(prim)) {
+            cache.timeVarying = true;
+            break;
+        }
+        if (xformCache.GetResetXformStack(prim)) {
+            break;
+        }
+    }
+
+    return cache.transform;
+}
+
+//! \brief  Create the playback cache when enabled, and clear it when the stage changed.
+void ProxyRenderDelegate::_UpdatePlaybackCache()
+{
+    static const int budget = TfGetEnvSetting(MAYAUSD_VP2_PLAYBACK_CACHE_MB);
+    if (budget <= 0) {
+        return;
+    }
+
+    if (!_playbackCache) {
+        _playbackCache.reset(new HdVP2PlaybackCache(size_t(budget) << 20));
+    }
+
+    // Any authored change can affect the cached points, even on other frames.
+    const MInt64 stageCounter = _proxyShapeData->ProxyShape()->getUsdStageUpdateCounter();
+    if (stageCounter != _playbackCacheStageCounter) {
+        _playbackCache->Clear();
+        _playbackCacheStageCounter = stageCounter;
+    }
+}
+
 void ProxyRenderDelegate::setLongDurationRendering() { _longDurationRendering = true; }
 
 //! \brief  Main update entry from subscene override.
@@ -1590,6 +1722,7 @@ void ProxyRenderDelegate::DisplayLayerRemoved(MObject& node, void* clientData)
         MMessage::removeCallback(iter->second);
         me->_mayaDisplayLayerDirtyCallbackIds.erase(iter);
     }
+    me->_displayLayerStatesDirty = true;
 }
 
 //! \brief  Notify of display layer membership change.
@@ -1612,6 +1745,7 @@ void ProxyRenderDelegate::DisplayLayerMembershipChanged(const MString& memberPat
             if (displayLayerObj.hasFn(MFn::kDisplayLayer)
                 && MFnDisplayLayer(displayLayerObj).name() != "defaultLayer") {
                 _usdPathToDisplayLayerMap[usdPath] = displayLayerObj;
+                _displayLayerStatesDirty = true;
             } else {
                 _usdPathToDisplayLayerMap.erase(usdPath);
             }
@@ -1630,6 +1764,8 @@ void ProxyRenderDelegate::DisplayLayerMembershipChanged(const MString& memberPat
 
 void ProxyRenderDelegate::DisplayLayerDirty(MFnDisplayLayer& displayLayer)
 {
+    _displayLayerStatesDirty = true;
+
     MSelectionList members;
     displayLayer.getMembers(members);
 
@@ -1725,6 +1861,7 @@ void ProxyRenderDelegate::AddDisplayLayerToCache(MObject& displayLayerObj)
 
             SdfPath usdPath(path.getSegments()[1].string());
             _usdPathToDisplayLayerMap[usdPath] = displayLayerObj;
+            _displayLayerStatesDirty = true;
         }
     }
 }
@@ -1741,6 +1878,7 @@ void ProxyRenderDelegate::UpdateProxyShapeDisplayLayers()
 
     _usdStageDisplayLayers
         = displayLayerManager.getAncestorLayersInclusive(GetProxyShapeDagPath().fullPathName());
+    _displayLayerStatesDirty = true;
 }
 
 MObject ProxyRenderDelegate::GetDisplayLayer(const SdfPath& path)
@@ -1748,6 +1886,69 @@ MObject ProxyRenderDelegate::GetDisplayLayer(const SdfPath& path)
     auto it = _usdPathToDisplayLayerMap.find(path);
     return it != _usdPathToDisplayLayerMap.end() ? it->second : MObject();
 }
+
+const ProxyRenderDelegate::DisplayLayerState*
+ProxyRenderDelegate::GetDisplayLayerState(const MObject& displayLayerObj) const
+{
+    auto it = _displayLayerStates.find(MObjectHandle(displayLayerObj));
+    return it != _displayLayerStates.end() ? &it->second : nullptr;
+}
+
+//! \brief  Read the attributes of the display layers used by the stage, on the main thread.
+void ProxyRenderDelegate::_UpdateDisplayLayerStates()
+{
+    if (!_displayLayerStatesDirty) {
+        return;
+    }
+
+    _displayLayerStatesDirty = false;
+    _displayLayerStates.clear();
+
+    auto addDisplayLayerState = [this](const MObject& displayLayerObj) {
+        if (displayLayerObj.isNull()) {
+            return;
+        }
+        MObjectHandle handle(displayLayerObj);
+        if (_displayLayerStates.count(handle)) {
+            return;
+        }
+
+        MFnDependencyNode displayLayerNodeFn(displayLayerObj);
+        DisplayLayerState state;
+        state.enabled = displayLayerNodeFn.findPlug("enabled").asBool();
+        state.visibility = displayLayerNodeFn.findPlug("visibility").asBool();
+        state.hideOnPlayback = displayLayerNodeFn.findPlug("hideOnPlayback").asBool();
+        state.texturing = displayLayerNodeFn.findPlug("texturing").asBool();
+        state.displayType = displayLayerNodeFn.findPlug("displayType").asShort();
+        state.levelOfDetail = displayLayerNodeFn.findPlug("levelOfDetail").asShort();
+        state.shading = displayLayerNodeFn.findPlug("shading").asShort();
+        state.useRGBColors = displayLayerNodeFn.findPlug("overrideRGBColors").asBool();
+        if (state.useRGBColors) {
+            auto colorRGBHolder
+                = UsdMayaUtil::GetPlugDataHandle(displayLayerNodeFn.findPlug("overrideColorRGB"));
+            const float3& rgbColor = colorRGBHolder->GetDataHandle().asFloat3();
+            state.colorRGBA = MColor(
+                rgbColor[0],
+                rgbColor[1],
+                rgbColor[2],
+                displayLayerNodeFn.findPlug("overrideColorA").asFloat());
+        } else {
+            state.colorIndex = displayLayerNodeFn.findPlug("color").asInt();
+            if (state.colorIndex > 0) {
+                state.colorRGBA = M3dView::active3dView().colorAtIndex(
+                    state.colorIndex - 1, M3dView::kDormantColors);
+            }
+        }
+        _displayLayerStates.emplace(handle, state);
+    };
+
+    for (const auto& item : _usdPathToDisplayLayerMap) {
+        addDisplayLayerState(item.second);
+    }
+    for (unsigned int j = 0; j < _usdStageDisplayLayers.length(); j++) {
+        addDisplayLayerState(_usdStageDisplayLayers[j]);
+    }
+}
 #endif
 
 void ProxyRenderDelegate::_RequestRefresh()
@@ -1760,6 +1961,11 @@ void ProxyRenderDelegate::_RequestRefresh()
 void ProxyRenderDelegate::ColorPrefsChanged()
 {
     _colorPrefsChanged = true;
+    ++_colorCacheVersion;
+#ifdef MAYA_HAS_DISPLAY_LAYER_API
+    // The palette colors of the display layers are resolved with their other attributes.
+    _displayLayerStatesDirty = true;
+#endif
     _RequestRefresh();
 }
 
@@ -2073,13 +2279,13 @@ GfVec3f ProxyRenderDelegate::GetDefaultColor(const TfToken& className)
     }
 
     // Check the cache. It is safe since colorCache->second is atomic
-    if (colorCache->second == _frameCounter) {
+    if (colorCache->second == _colorCacheVersion) {
         return colorCache->first;
     }
 
     // Enter the mutex and check the cache again
     std::lock_guard<std::mutex> mutexGuard(_mayaCommandEngineMutex);
-    if (colorCache->second == _frameCounter) {
+    if (colorCache->second == _colorCacheVersion) {
         return colorCache->first;
     }
 
@@ -2089,6 +2295,9 @@ GfVec3f ProxyRenderDelegate::GetDefaultColor(const TfToken& className)
 
     // Execute Maya command engine to fetch the color
     MDoubleArray colorResult;
+    if (!TF_VERIFY(HdVP2ResourceRegistry::VerifyMayaAccess())) {
+        return colorCache->first;
+    }
     MGlobal::executeCommand(queryCommand, colorResult);
 
     if (colorResult.length() == 3) {
@@ -2099,7 +2308,7 @@ GfVec3f ProxyRenderDelegate::GetDefaultColor(const TfToken& className)
     }
 
     // Update the cache and return
-    colorCache->second = _frameCounter;
+    colorCache->second = _colorCacheVersion;
     return colorCache->first;
 }
 
@@ -2125,13 +2334,13 @@ MColor ProxyRenderDelegate::_GetDisplayColor(
     const MColor& defaultColor)
 {
     // Check the cache. It is safe since colorCache.second is atomic
-    if (colorCache.second == _frameCounter) {
+    if (colorCache.second == _colorCacheVersion) {
         return colorCache.first;
     }
 
     // Enter the mutex and check the cache again
     std::lock_guard<std::mutex> mutexGuard(_mayaCommandEngineMutex);
-    if (colorCache.second == _frameCounter) {
+    if (colorCache.second == _colorCacheVersion) {
         return colorCache.first;
     }
 
@@ -2143,6 +2352,9 @@ MColor ProxyRenderDelegate::_GetDisplayColor(
 
     // Query and return the display color.
     MDoubleArray colorResult;
+    if (!TF_VERIFY(HdVP2ResourceRegistry::VerifyMayaAccess())) {
+        return colorCache.first;
+    }
     MGlobal::executeCommand(queryCommand, colorResult);
 
     if (colorResult.length() == 3) {
@@ -2161,7 +2373,7 @@ MColor ProxyRenderDelegate::_GetDisplayColor(
     }
 
     // Update the cache and return
-    colorCache.second = _frameCounter;
+    colorCache.second = _colorCacheVersion;
     return colorCache.first;
 }
 
@@ -2205,13 +2417,13 @@ MColor ProxyRenderDelegate::GetSelectionHighlightColor(const TfToken& className)
     }
 
     // Check the cache. It is safe since colorCache->second is atomic
-    if (colorCache->second == _frameCounter) {
+    if (colorCache->second == _colorCacheVersion) {
         return colorCache->first;
     }
 
     // Enter the mutex and check the cache again
     std::lock_guard<std::mutex> mutexGuard(_mayaCommandEngineMutex);
-    if (colorCache->second == _frameCounter) {
+    if (colorCache->second == _colorCacheVersion) {
         return colorCache->first;
     }
 
@@ -2229,6 +2441,9 @@ MColor ProxyRenderDelegate::GetSelectionHighlightColor(const TfToken& className)
 
     // Query and return the selection color.
     MDoubleArray colorResult;
+    if (!TF_VERIFY(HdVP2ResourceRegistry::VerifyMayaAccess())) {
+        return colorCache->first;
+    }
     MGlobal::executeCommand(queryCommand, colorResult);
 
     if (colorResult.length() == 3) {
@@ -2258,7 +2473,7 @@ MColor ProxyRenderDelegate::GetSelectionHighlightColor(const TfToken& className)
     }
 
     // Update the cache and return
-    colorCache->second = _frameCounter;
+    colorCache->second = _colorCacheVersion;
     return colorCache->first;
 #endif // MAYA_API_VERSION < 20230000
 }
@@ -2289,6 +2504,74 @@ UsdImagingDelegate* ProxyRenderDelegate::GetUsdImagingDelegate() const
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
 bool ProxyRenderDelegate::SnapToSelectedObjects() const { return _snapToSelectedObjects; }
 bool ProxyRenderDelegate::SnapToPoints() const { return _snapToPoints; }
+
+const HdVP2CullingView* ProxyRenderDelegate::GetInstanceCullingView() const
+{
+    return _instanceCullingViewValid ? &_instanceCullingView : nullptr;
+}
+
+void ProxyRenderDelegate::_UpdateInstanceCulling(
+    const MHWRender::MFrameContext& frameContext,
+    bool                            instancersChanged)
+{
+    static const bool cullingEnabled = TfGetEnvSetting(MAYAUSD_VP2_INSTANCE_CULLING);
+    static const int  lodScreenSize = TfGetEnvSetting(MAYAUSD_VP2_INSTANCE_LOD_SCREEN_SIZE);
+    if (!cullingEnabled && lodScreenSize <= 0) {
+        return;
+    }
+
+    if (instancersChanged) {
+        _instancedRprimsValid = false;
+    }
+
+    MStatus          status;
+    HdVP2CullingView view;
+    view.viewProjection = frameContext.getMatrix(MHWRender::MFrameContext::kViewProjMtx, &status);
+    if (!status) {
+        return;
+    }
+    const MMatrix projection
+        = frameContext.getMatrix(MHWRender::MFrameContext::kProjectionMtx, &status);
+    if (!status) {
+        return;
+    }
+    int originX, originY, width, height;
+    if (!frameContext.getViewportDimensions(originX, originY, width, height)) {
+        return;
+    }
+    view.pixelScale = 0.5 * projection[1][1] * height;
+    view.cullFrustum = cullingEnabled;
+    if (cullingEnabled) {
+        view.minScreenSize = TfGetEnvSetting(MAYAUSD_VP2_INSTANCE_CULLING_MIN_SCREEN_SIZE);
+    }
+    view.lodScreenSize = lodScreenSize > 0 ? lodScreenSize : 0;
+
+    if (_instanceCullingViewValid && view == _instanceCullingView) {
+        return;
+    }
+    _instanceCullingView = view;
+    _instanceCullingViewValid = true;
+
+    // Only the instanced Rprims depend on the view, keep track of them so that
+    // camera moves don't need to visit every Rprim.
+    const SdfPathVector& rprims = _renderIndex->GetRprimIds();
+    if (!_instancedRprimsValid || _instancedRprimsCount != rprims.size()) {
+        _instancedRprims.clear();
+        for (const SdfPath& path : rprims) {
+            const HdRprim* rprim = _renderIndex->GetRprim(path);
+            if (rprim && !rprim->GetInstancerId().IsEmpty()) {
+                _instancedRprims.push_back(path);
+            }
+        }
+        _instancedRprimsCount = rprims.size();
+        _instancedRprimsValid = true;
+    }
+
+    HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+    for (const SdfPath& path : _instancedRprims) {
+        changeTracker.MarkRprimDirty(path, MayaUsdRPrim::DirtyInstanceCulling);
+    }
+}
 #endif
 
 // ProxyShapeData
@@ -17,14 +17,18 @@
 #define PROXY_RENDER_DELEGATE
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/render/vp2RenderDelegate/instanceCulling.h>
+#include <mayaUsd/render/vp2RenderDelegate/playbackCache.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/imaging/hd/engine.h>
 #include <pxr/imaging/hd/selection.h>
 #include <pxr/imaging/hd/task.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
 #include <pxr/usdImaging/usdImaging/version.h>
 
 #include <maya/MDagPath.h>
@@ -192,8 +196,36 @@ public:
 
     MAYAUSD_CORE_PUBLIC
     const MObjectArray& GetProxyShapeDisplayLayers() const { return _usdStageDisplayLayers; }
+
+    //! Attributes of a display layer, read on the main thread so that Rprims can be synced
+    //! in parallel without using the Maya API.
+    struct DisplayLayerState
+    {
+        bool   enabled { true };
+        bool   visibility { true };
+        bool   hideOnPlayback { false };
+        bool   texturing { true };
+        short  displayType { 0 };
+        short  levelOfDetail { 0 };
+        short  shading { 1 };
+        bool   useRGBColors { false };
+        MColor colorRGBA; //!< Override color, also resolved from the palette for colorIndex
+        int    colorIndex { 0 };
+    };
+
+    //! Return the attributes of \p displayLayerObj, or nullptr if the layer is unknown.
+    MAYAUSD_CORE_PUBLIC
+    const DisplayLayerState* GetDisplayLayerState(const MObject& displayLayerObj) const;
 #endif
 
+    //! Return the value of the ShowDisplayColorTextureOff optionVar for the current frame.
+    MAYAUSD_CORE_PUBLIC
+    bool GetShowDisplayColorTextureOff() const { return _showDisplayColorTextureOff; }
+
+    //! Return the cache of the animated vertex data, or nullptr when playback caching is disabled.
+    MAYAUSD_CORE_PUBLIC
+    HdVP2PlaybackCache* GetPlaybackCache() const { return _playbackCache.get(); }
+
     MAYAUSD_CORE_PUBLIC
     void ColorPrefsChanged();
 
@@ -257,6 +289,10 @@ public:
 
     MAYAUSD_CORE_PUBLIC
     bool SnapToPoints() const;
+
+    //! Return the view to cull instances against, or nullptr when instance culling is disabled.
+    MAYAUSD_CORE_PUBLIC
+    const HdVP2CullingView* GetInstanceCullingView() const;
 #endif
 
     static void setLongDurationRendering();
@@ -286,7 +322,11 @@ private:
         const char*   colorName,
         bool          colorCorrection,
         const MColor& defaultColor);
+    void _PrefetchMayaState();
+    void _UpdatePlaybackCache();
+    const GfMatrix4d& _GetRootPrimTransform(const UsdPrim& rootPrim, const UsdTimeCode& timeCode);
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
+    void _UpdateDisplayLayerStates();
     bool _DirtyUfeSubtree(const Ufe::Path& rootPath);
     bool _DirtyUfeSubtree(const MString& rootStr);
     void _DirtyUsdSubtree(const UsdPrim& prim);
@@ -297,6 +337,12 @@ private:
 
     void ComputeCombinedDisplayStyles(const unsigned int newDisplayStyle);
 
+#ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
+    void _UpdateInstanceCulling(
+        const MHWRender::MFrameContext& frameContext,
+        bool                            instancersChanged);
+#endif
+
     /*! \brief  Hold all data related to the proxy shape.
 
         In addition to holding data read from the proxy shape, ProxyShapeData tracks when data read
@@ -381,8 +427,27 @@ private:
     bool                       _usdStageDisplayLayersDirty = false;
     MObjectArray               _usdStageDisplayLayers;
     std::map<SdfPath, MObject> _usdPathToDisplayLayerMap;
+
+    bool _displayLayerStatesDirty { true };
+    UsdMayaUtil::MObjectHandleUnorderedMap<DisplayLayerState> _displayLayerStates;
 #endif
 
+    bool _showDisplayColorTextureOff { false }; //!< Cached value of the optionVar
+
+    //! Transform in the stage of the prim used as the root of the proxy shape
+    struct RootPrimTransformCache
+    {
+        GfMatrix4d  transform { 1.0 };
+        UsdPrim     prim;                  //!< Prim of the transform, invalid until computed
+        UsdTimeCode time;                  //!< Time of the transform
+        MInt64      stageCounter { 0 };    //!< Stage update counter of the transform
+        bool        timeVarying { false }; //!< Whether the prim or an ancestor is animated
+    };
+    RootPrimTransformCache _rootPrimTransform;
+
+    std::unique_ptr<HdVP2PlaybackCache> _playbackCache; //!< Vertex data of the frames played
+    MInt64 _playbackCacheStageCounter { 0 }; //!< Stage update counter of the cached data
+
     std::vector<MCallbackId> _mayaColorPrefsCallbackIds;
     std::vector<MCallbackId> _mayaColorManagementCallbackIds;
 
@@ -392,10 +457,18 @@ private:
     bool _snapToSelectedObjects {
         false
     }; //!< Whether point snapping should snap to selected objects
+
+    HdVP2CullingView _instanceCullingView; //!< The view instances are culled against
+    bool             _instanceCullingViewValid { false };
+    SdfPathVector    _instancedRprims; //!< The Rprims to update when the view changes
+    size_t           _instancedRprimsCount { 0 }; //!< The Rprim count when last gathered
+    bool             _instancedRprimsValid { false };
 #endif
 
     std::mutex _mayaCommandEngineMutex;
     uint64_t   _frameCounter { 0 };
+    uint64_t   _colorCacheVersion { 1 }; //!< Bumped when the cached colors must be queried again
+    uint64_t   _prefetchedColorCacheVersion { 0 }; //!< Version of the prefetched colors
 
     // The name of the currently used color space
     MString _colorTransformId;
@@ -0,0 +1,53 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "resourceRegistry.h"
+
+#include <atomic>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+//! True while the calling thread syncs Rprims
+thread_local bool _isSyncing = false;
+
+//! Number of Maya API accesses made while syncing Rprims
+std::atomic<size_t> _syncMayaAccessCount { 0 };
+
+} // namespace
+
+HdVP2ResourceRegistry::SyncScope::SyncScope()
+    : _wasSyncing(_isSyncing)
+{
+    _isSyncing = true;
+}
+
+HdVP2ResourceRegistry::SyncScope::~SyncScope() { _isSyncing = _wasSyncing; }
+
+bool HdVP2ResourceRegistry::CanAccessMaya() { return !_isSyncing; }
+
+bool HdVP2ResourceRegistry::VerifyMayaAccess()
+{
+    if (CanAccessMaya()) {
+        return true;
+    }
+    ++_syncMayaAccessCount;
+    return false;
+}
+
+size_t HdVP2ResourceRegistry::GetSyncMayaAccessCount() { return _syncMayaAccessCount; }
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -16,11 +16,18 @@
 #ifndef HD_VP2_RESOURCE_REGISTRY
 #define HD_VP2_RESOURCE_REGISTRY
 
+#include "stagingPool.h"
 #include "taskCommit.h"
 
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+
 #include <tbb/concurrent_queue.h>
 #include <tbb/tbb_allocator.h>
 
+#include <cstddef>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Central place to manage GPU resources commits and any resources not managed by VP2
@@ -44,6 +51,9 @@ public:
                 commitTask->destroy();
             }
         }
+
+        // Commit tasks can read the frame staging blocks, they are only recycled now.
+        _stagingPool.Recycle();
     }
 
     //! \brief  Enqueue commit task. Call is thread safe.
@@ -52,9 +62,52 @@ public:
         _commitTasks.push(HdVP2TaskCommitBody<Body>::construct(taskBody));
     }
 
+    /*! \brief  Scope flagging the calling thread as syncing Rprims.
+
+        Rprims are synced in parallel on worker threads, where the Maya API must not be
+        used. Any Maya API call has to be deferred with EnqueueCommit(), or the Maya state
+        has to be gathered on the main thread before the sync.
+    */
+    class SyncScope
+    {
+    public:
+        MAYAUSD_CORE_PUBLIC
+        SyncScope();
+        MAYAUSD_CORE_PUBLIC
+        ~SyncScope();
+
+        SyncScope(const SyncScope&) = delete;
+        SyncScope& operator=(const SyncScope&) = delete;
+
+    private:
+        const bool _wasSyncing;
+    };
+
+    //! \brief  Return true if the calling thread is allowed to use the Maya API.
+    MAYAUSD_CORE_PUBLIC
+    static bool CanAccessMaya();
+
+    /*! \brief  Check that the Maya API can be used from the calling thread.
+
+        Accesses made while syncing Rprims are counted, so that they can be tracked down.
+        \return True if the Maya API can be used.
+    */
+    MAYAUSD_CORE_PUBLIC
+    static bool VerifyMayaAccess();
+
+    //! \brief  Return the pool of the temporary buffers used by Rprims to prepare VP2 buffers.
+    HdVP2StagingPool& GetStagingPool() { return _stagingPool; }
+
+    //! \brief  Return the number of Maya API accesses made while syncing Rprims.
+    MAYAUSD_CORE_PUBLIC
+    static size_t GetSyncMayaAccessCount();
+
 private:
     //! Concurrent queue for commit tasks
     tbb::concurrent_queue<HdVP2TaskCommit*, tbb::tbb_allocator<HdVP2TaskCommit*>> _commitTasks;
+
+    //! Staging memory reused from frame to frame
+    HdVP2StagingPool _stagingPool;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
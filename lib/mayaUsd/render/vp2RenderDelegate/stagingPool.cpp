@@ -0,0 +1,138 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "stagingPool.h"
+
+#include <algorithm>
+#include <new>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+HdVP2StagingPool::~HdVP2StagingPool()
+{
+    for (_ThreadCache& cache : _threadCaches) {
+        for (const _FrameBlock& frameBlock : cache.frameBlocks) {
+            _Release(cache, frameBlock.data, frameBlock.size);
+        }
+        for (size_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass) {
+            for (void* data : cache.sizeClasses[sizeClass].freeBlocks) {
+                _FreeToSystem(data, _GetBlockSize(sizeClass));
+            }
+        }
+    }
+}
+
+//! \brief  Return the size class of \p size bytes, or kSizeClassCount if it is too large.
+size_t HdVP2StagingPool::_GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < kSizeClassCount && _GetBlockSize(sizeClass) < size) {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+void* HdVP2StagingPool::_AllocateFromSystem(size_t size)
+{
+    void* data = ::operator new(size);
+    _reservedBytes += size;
+    ++_systemAllocationCount;
+    return data;
+}
+
+void HdVP2StagingPool::_FreeToSystem(void* data, size_t size)
+{
+    ::operator delete(data);
+    _reservedBytes -= size;
+}
+
+void* HdVP2StagingPool::Acquire(size_t size)
+{
+    const size_t sizeClass = _GetSizeClass(size);
+    if (sizeClass == kSizeClassCount) {
+        return _AllocateFromSystem(size);
+    }
+
+    _SizeClass& freeList = _threadCaches.local().sizeClasses[sizeClass];
+    if (++freeList.inUse > ptrdiff_t(freeList.peak)) {
+        freeList.peak = freeList.inUse;
+    }
+
+    if (!freeList.freeBlocks.empty()) {
+        void* data = freeList.freeBlocks.back();
+        freeList.freeBlocks.pop_back();
+        return data;
+    }
+    return _AllocateFromSystem(_GetBlockSize(sizeClass));
+}
+
+void HdVP2StagingPool::Release(void* data, size_t size)
+{
+    _Release(_threadCaches.local(), data, size);
+}
+
+void HdVP2StagingPool::_Release(_ThreadCache& cache, void* data, size_t size)
+{
+    if (data == nullptr) {
+        return;
+    }
+
+    const size_t sizeClass = _GetSizeClass(size);
+    if (sizeClass == kSizeClassCount) {
+        _FreeToSystem(data, size);
+        return;
+    }
+
+    _SizeClass& freeList = cache.sizeClasses[sizeClass];
+    freeList.freeBlocks.push_back(data);
+    --freeList.inUse;
+}
+
+void* HdVP2StagingPool::AllocateForFrame(size_t size)
+{
+    void* data = Acquire(size);
+    _threadCaches.local().frameBlocks.push_back({ data, size });
+    return data;
+}
+
+void HdVP2StagingPool::Recycle()
+{
+    for (_ThreadCache& cache : _threadCaches) {
+        for (const _FrameBlock& frameBlock : cache.frameBlocks) {
+            _Release(cache, frameBlock.data, frameBlock.size);
+        }
+        cache.frameBlocks.clear();
+
+        for (size_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass) {
+            _SizeClass& freeList = cache.sizeClasses[sizeClass];
+
+            // Keep enough blocks for the busiest of the last two frames, so that a
+            // frame needing fewer buffers doesn't drop the memory of the next one.
+            const size_t inUse = size_t(std::max(freeList.inUse, ptrdiff_t(0)));
+            const size_t needed = std::max(freeList.peak, freeList.lastPeak);
+            const size_t keep = needed > inUse ? needed - inUse : 0;
+
+            while (freeList.freeBlocks.size() > keep) {
+                _FreeToSystem(freeList.freeBlocks.back(), _GetBlockSize(sizeClass));
+                freeList.freeBlocks.pop_back();
+            }
+
+            freeList.lastPeak = freeList.peak;
+            freeList.peak = inUse;
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
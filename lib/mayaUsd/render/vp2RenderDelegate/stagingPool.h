@@ -0,0 +1,180 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_STAGING_POOL
+#define HD_VP2_STAGING_POOL
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Pool of the temporary memory used to prepare VP2 buffers
+    \class  HdVP2StagingPool
+
+    Rprims are synced on worker threads and build their index and primvar data
+    in temporary buffers before copying them to the VP2 buffers. During playback,
+    the same buffers are needed on every frame, so the pool keeps the released
+    blocks in free lists, one per power of two size class, instead of returning
+    them to the system.
+
+    Blocks are either released explicitly with Release(), or allocated for the
+    frame with AllocateForFrame() and released all at once by Recycle(). Recycle()
+    also frees the blocks which were not needed by the last two frames, so that
+    the pool doesn't hold on to the memory of a stage which is no longer animated.
+
+    Each thread has its own free lists: a block goes back to the free lists of
+    the thread which released it, and frame blocks to the thread which allocated
+    them.
+
+    All functions are thread safe, except Recycle() which must be called on the
+    main thread once the Rprims are synced and the commits are executed.
+*/
+class MAYAUSD_CORE_PUBLIC HdVP2StagingPool
+{
+public:
+    //! \brief  Default constructor
+    HdVP2StagingPool() = default;
+    //! \brief  Free all the blocks of the pool
+    ~HdVP2StagingPool();
+
+    HdVP2StagingPool(const HdVP2StagingPool&) = delete;
+    HdVP2StagingPool& operator=(const HdVP2StagingPool&) = delete;
+
+    //! \brief  Return a block of at least \p size bytes, to be released with Release().
+    void* Acquire(size_t size);
+
+    //! \brief  Return the block \p data of \p size bytes to the pool.
+    void Release(void* data, size_t size);
+
+    //! \brief  Return a block of at least \p size bytes, valid until the next Recycle().
+    void* AllocateForFrame(size_t size);
+
+    //! \brief  Return an array of \p count elements, valid until the next Recycle().
+    template <typename T> T* AllocateForFrame(size_t count)
+    {
+        return static_cast<T*>(AllocateForFrame(count * sizeof(T)));
+    }
+
+    //! \brief  Release the frame blocks and free the blocks not needed recently.
+    void Recycle();
+
+    //! \brief  Return the number of bytes allocated from the system and held by the pool.
+    size_t GetReservedBytes() const { return _reservedBytes; }
+
+    //! \brief  Return the number of blocks allocated from the system since the creation.
+    size_t GetSystemAllocationCount() const { return _systemAllocationCount; }
+
+private:
+    //! Smallest block size, smaller requests are rounded up to it.
+    static constexpr size_t kMinSizeClassLog2 = 8;
+    //! Largest pooled block size, larger requests go straight to the system.
+    static constexpr size_t kMaxSizeClassLog2 = 28;
+    static constexpr size_t kSizeClassCount = kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+
+    struct _SizeClass
+    {
+        std::vector<void*> freeBlocks;
+        ptrdiff_t          inUse { 0 };    //!< Blocks acquired minus blocks released
+        size_t             peak { 0 };     //!< Most blocks in use this frame
+        size_t             lastPeak { 0 }; //!< Most blocks in use last frame
+    };
+
+    struct _ThreadCache;
+
+    struct _FrameBlock
+    {
+        void*  data;
+        size_t size;
+    };
+
+    //! Free lists of a thread, so that the workers never contend for a block.
+    struct _ThreadCache
+    {
+        std::array<_SizeClass, kSizeClassCount> sizeClasses;
+        std::vector<_FrameBlock>                frameBlocks;
+    };
+
+    static size_t _GetSizeClass(size_t size);
+    static size_t _GetBlockSize(size_t sizeClass)
+    {
+        return size_t(1) << (sizeClass + kMinSizeClassLog2);
+    }
+
+    void* _AllocateFromSystem(size_t size);
+    void  _FreeToSystem(void* data, size_t size);
+    void  _Release(_ThreadCache& cache, void* data, size_t size);
+
+    tbb::enumerable_thread_specific<_ThreadCache> _threadCaches;
+
+    std::atomic<size_t> _reservedBytes { 0 };
+    std::atomic<size_t> _systemAllocationCount { 0 };
+};
+
+/*! \brief  Standard allocator drawing its memory from a HdVP2StagingPool
+    \class  HdVP2StagingAllocator
+
+    Lets the staging containers of the Rprims, like the index arrays being built,
+    reuse the memory of the previous frames.
+*/
+template <typename T> class HdVP2StagingAllocator
+{
+public:
+    using value_type = T;
+
+    explicit HdVP2StagingAllocator(HdVP2StagingPool& pool)
+        : _pool(&pool)
+    {
+    }
+
+    template <typename U>
+    HdVP2StagingAllocator(const HdVP2StagingAllocator<U>& other)
+        : _pool(other.GetPool())
+    {
+    }
+
+    T* allocate(size_t count) { return static_cast<T*>(_pool->Acquire(count * sizeof(T))); }
+    void deallocate(T* data, size_t count) { _pool->Release(data, count * sizeof(T)); }
+
+    HdVP2StagingPool* GetPool() const { return _pool; }
+
+    template <typename U> bool operator==(const HdVP2StagingAllocator<U>& other) const
+    {
+        return _pool == other.GetPool();
+    }
+    template <typename U> bool operator!=(const HdVP2StagingAllocator<U>& other) const
+    {
+        return _pool != other.GetPool();
+    }
+
+private:
+    HdVP2StagingPool* _pool;
+};
+
+//! Vector whose storage comes from a HdVP2StagingPool.
+template <typename T> using HdVP2StagingVector = std::vector<T, HdVP2StagingAllocator<T>>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_STAGING_POOL
@@ -16,6 +16,8 @@
 #ifndef HD_VP2_TASK_COMMIT
 #define HD_VP2_TASK_COMMIT
 
+#include <pxr/pxr.h>
+
 #include <tbb/tbb_allocator.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
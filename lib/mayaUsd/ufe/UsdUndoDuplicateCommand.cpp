@@ -42,6 +42,7 @@
 #include <ufe/sceneNotification.h>
 
 #include <algorithm>
+#include <optional>
 
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
@@ -78,6 +79,16 @@ UsdUndoDuplicateCommand::create(const UsdUfe::UsdSceneItem::Ptr& srcItem)
     return std::make_shared<UsdUndoDuplicateCommand>(srcItem);
 }
 
+UsdUndoDuplicateCommand::Ptr UsdUndoDuplicateCommand::create(
+    const UsdUfe::UsdSceneItem::Ptr& srcItem,
+    const PXR_NS::SdfLayerHandle&    routedLayer)
+{
+    auto cmd = std::make_shared<UsdUndoDuplicateCommand>(srcItem);
+    cmd->_isRouted = true;
+    cmd->_routedLayer = routedLayer;
+    return cmd;
+}
+
 UsdUfe::UsdSceneItem::Ptr UsdUndoDuplicateCommand::duplicatedItem() const
 {
     return UsdUfe::createSiblingSceneItem(_ufeSrcPath, _usdDstPath.GetElementString());
@@ -93,7 +104,12 @@ void UsdUndoDuplicateCommand::execute()
     auto path = prim.GetPath();
     auto stage = prim.GetStage();
 
-    UsdUfe::OperationEditRouterContext ctx(UsdUfe::EditRoutingTokens->RouteDuplicate, prim);
+    // Use the layer routed by the caller, if any, rather than routing again.
+    std::optional<UsdUfe::OperationEditRouterContext> ctx;
+    if (_isRouted)
+        ctx.emplace(stage, _routedLayer);
+    else
+        ctx.emplace(UsdUfe::EditRoutingTokens->RouteDuplicate, prim);
     _dstLayer = stage->GetEditTarget().GetLayer();
 
     auto                               item = Ufe::Hierarchy::createItem(_ufeSrcPath);
@@ -58,6 +58,11 @@ public:
     //! Create a UsdUndoDuplicateCommand from a USD prim and UFE path.
     static UsdUndoDuplicateCommand::Ptr create(const UsdUfe::UsdSceneItem::Ptr& srcItem);
 
+    //! Create a UsdUndoDuplicateCommand using a layer already routed by the caller, for
+    //! example with getEditRouterLayers. A null layer keeps the edit target of the stage.
+    static UsdUndoDuplicateCommand::Ptr
+    create(const UsdUfe::UsdSceneItem::Ptr& srcItem, const PXR_NS::SdfLayerHandle& routedLayer);
+
     UsdUfe::UsdSceneItem::Ptr duplicatedItem() const;
     UFE_V4(Ufe::SceneItem::Ptr sceneItem() const override { return duplicatedItem(); })
 
@@ -74,6 +79,9 @@ private:
     PXR_NS::SdfLayerHandle _srcLayer;
     PXR_NS::SdfLayerHandle _dstLayer;
 
+    bool                   _isRouted = false;
+    PXR_NS::SdfLayerHandle _routedLayer;
+
 }; // UsdUndoDuplicateCommand
 
 } // namespace ufe
@@ -17,7 +17,9 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <usdUfe/base/tokens.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/utils/editRouter.h>
 #include <usdUfe/utils/usdUtils.h>
 
 #include <pxr/base/tf/token.h>
@@ -85,11 +87,23 @@ void UsdUndoDuplicateSelectionCommand::execute()
 {
     UsdUfe::UsdUndoBlock undoBlock(&_undoableItem);
 
+    // Route all the duplicates with a single call to the edit router. The
+    // duplicate commands use the routed layers instead of routing again.
+    std::vector<PXR_NS::UsdPrim> srcPrims;
+    srcPrims.reserve(_sourceItems.size());
     for (auto&& usdItem : _sourceItems) {
+        srcPrims.push_back(usdItem->prim());
+    }
+    const auto dstLayers
+        = UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteDuplicate, srcPrims);
+
+    for (size_t i = 0; i < _sourceItems.size(); ++i) {
+        const auto& usdItem = _sourceItems[i];
+
         // Need to create and execute. If we create all before executing any, then the collision
         // resolution on names will merge bob1 and bob2 into a single bob3 instead of creating a
         // bob3 and a bob4.
-        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem);
+        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, dstLayers[i]);
         duplicateCmd->execute();
 
         // Currently unordered_map since we need to streamline the targetItem override.
@@ -31,6 +31,7 @@
 #endif
 
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/bboxCacheService.h>
 #include <usdUfe/utils/layers.h>
 #include <usdUfe/utils/usdUtils.h>
 
@@ -635,6 +636,9 @@ Ufe::BBox3d getPulledPrimsBoundingBox(const Ufe::Path& path)
 
 #ifdef HAS_ORPHANED_NODES_MANAGER
     const auto& updaterMgr = PXR_NS::PrimUpdaterManager::getInstance();
+    if (!updaterMgr.hasPulledPrims())
+        return ufeBBox;
+
     PXR_NS::PrimUpdaterManager::PulledPrimPaths pulledPaths = updaterMgr.getPulledPrimPaths();
     for (const auto& paths : pulledPaths) {
         const Ufe::Path& pulledPath = paths.first;
@@ -650,12 +654,27 @@ Ufe::BBox3d getPulledPrimsBoundingBox(const Ufe::Path& path)
         const MDagPath& mayaPath = paths.second;
         Ufe::BBox3d     pulledBBox = getTransformedBBox(mayaPath);
 
-        for (auto parentPath = pulledPath.pop(); parentPath != path;
-             parentPath = parentPath.pop()) {
-            Ufe::SceneItem::Ptr parentItem = Ufe::Hierarchy::createItem(parentPath);
-            if (!parentItem)
-                continue;
-            pulledBBox = transformBBox(parentItem, pulledBBox);
+        // Bring the pulled bounds in the space of the queried item, through
+        // the USD parents of the pulled prim. Use the shared cache, which
+        // keeps the transforms of the parents from one query to the next.
+        const PXR_NS::UsdPrim parentPrim = UsdUfe::ufePathToPrim(pulledPath.pop());
+        const PXR_NS::UsdPrim ancestorPrim = (path.nbSegments() == 1)
+            ? (parentPrim ? parentPrim.GetStage()->GetPseudoRoot() : PXR_NS::UsdPrim())
+            : UsdUfe::ufePathToPrim(path);
+        if (parentPrim && ancestorPrim) {
+            const auto time = getTime(pulledPath);
+            pulledBBox = transformBBox(
+                UsdUfe::BBoxCacheService::instance().computeRelativeTransform(
+                    parentPrim, ancestorPrim, time),
+                pulledBBox);
+        } else {
+            for (auto parentPath = pulledPath.pop(); parentPath != path;
+                 parentPath = parentPath.pop()) {
+                Ufe::SceneItem::Ptr parentItem = Ufe::Hierarchy::createItem(parentPath);
+                if (!parentItem)
+                    continue;
+                pulledBBox = transformBBox(parentItem, pulledBBox);
+            }
         }
 
         ufeBBox = UsdUfe::combineUfeBBox(ufeBBox, pulledBBox);
@@ -16,18 +16,27 @@
 #include "converter.h"
 
 #include <mayaUsd/utils/colorSpace.h>
+#include <mayaUsd/utils/hash.h>
+
+#include <usdUfe/utils/SIMD.h>
 
 #include <maya/MArrayDataBuilder.h>
 #include <maya/MArrayDataHandle.h>
 #include <maya/MDGModifier.h>
 #include <maya/MDataBlock.h>
 #include <maya/MFnData.h>
+#include <maya/MFnDoubleArrayData.h>
+#include <maya/MFnFloatArrayData.h>
 #include <maya/MFnIntArrayData.h>
 #include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnPointArrayData.h>
 #include <maya/MFnStringData.h>
 #include <maya/MFnUnitAttribute.h>
+#include <maya/MFnVectorArrayData.h>
+#include <maya/MObjectHandle.h>
 
+#include <list>
+#include <mutex>
 #include <unordered_map>
 
 // clang-format off
@@ -52,10 +61,22 @@
 ||
 | Matrix4d         | GfMatrix4d            | MFnData::kMatrix,  MFn::kMatrixData                            | MMatrix, MFnMatrixData  | MakeMayaFnData     |
 ||
-| IntArray         | VtArray< int >        | MFnData::kIntArray, MFn::kIntArrayData                | MIntArray, MFnIntArrayData       | MakeMayaFnData     |
-| Point3fArray     | VtArray< GfVec3f >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
 | Matrix4dArray    | VtArray< GfMatrix4d > | MFnData::kMatrixArray, MFn::kMatrixArrayData          | MMatrixArray, MFnMatrixArrayData | MakeMayaFnData     |
 
+This table lists currently supported types for typed array data, converted in bulk
+
+| SdfValueTypeName | USD C++ Type          | Maya Type                                                | Maya C++ Type                  | Helper TypeTrait  |
+|:-----------------|:----------------------|:---------------------------------------------------------|:-------------------------------|:------------------|
+| IntArray         | VtArray< int >        | MFnData::kIntArray                                       | MIntArray                      | MakeBulkArrayData |
+| FloatArray       | VtArray< float >      | MFnData::kFloatArray, MFnData::kDoubleArray              | MFloatArray, MDoubleArray      | MakeBulkArrayData |
+| DoubleArray      | VtArray< double >     | MFnData::kDoubleArray, MFnData::kFloatArray              | MDoubleArray, MFloatArray      | MakeBulkArrayData |
+| Point3fArray     | VtArray< GfVec3f >    | MFnData::kPointArray, MFnData::kVectorArray              | MPointArray, MVectorArray      | MakeBulkArrayData |
+| Vector3fArray    | VtArray< GfVec3f >    | MFnData::kPointArray, MFnData::kVectorArray              | MPointArray, MVectorArray      | MakeBulkArrayData |
+| Point3dArray     | VtArray< GfVec3d >    | MFnData::kVectorArray, MFnData::kPointArray              | MVectorArray, MPointArray      | MakeBulkArrayData |
+| Vector3dArray    | VtArray< GfVec3d >    | MFnData::kVectorArray, MFnData::kPointArray              | MVectorArray, MPointArray      | MakeBulkArrayData |
+
+The first Maya type is the one created when the destination attribute doesn't request another one.
+
 This table lists currently supported types for array attributes
 
 | USD C++ Item Type | Maya C++ Item Type | Helper TypeTrait            |
@@ -1007,6 +1028,278 @@ struct MArrayPlugConvert
     }
 };
 
+//---------------------------------------------------------------------------------
+//! \brief  Type trait declaration for Usd array types converted in bulk from and to Maya typed
+//! array data. Each specialization reads the Maya array with a single get() into the Usd array,
+//! or into a staging buffer converted with a vectorized conversion when the layouts differ, and
+//! creates the Maya array from a buffer.
+template <class USD_ArrayType> struct MakeBulkArrayData : public std::false_type
+{
+};
+
+//! \brief  Type trait for VtArray<int> providing bulk conversions from and to MIntArray data.
+template <> struct MakeBulkArrayData<VtArray<int>> : public std::true_type
+{
+    static bool read(const MObject& data, VtArray<int>& dst)
+    {
+        if (!data.hasFn(MFn::kIntArrayData))
+            return false;
+
+        MFnIntArrayData dataFn(data);
+        MIntArray       src = dataFn.array();
+        dst.resize(src.length());
+        if (!dst.empty())
+            src.get(dst.data());
+        return true;
+    }
+
+    static MObject create(const VtArray<int>& src, MFnData::Type)
+    {
+        MFnIntArrayData dataFn;
+        return dataFn.create(MIntArray(src.cdata(), static_cast<unsigned int>(src.size())));
+    }
+};
+
+//! \brief  Type trait for VtArray<float> providing bulk conversions from and to MFloatArray and
+//! MDoubleArray data.
+template <> struct MakeBulkArrayData<VtArray<float>> : public std::true_type
+{
+    static bool read(const MObject& data, VtArray<float>& dst)
+    {
+        if (data.hasFn(MFn::kFloatArrayData)) {
+            MFnFloatArrayData dataFn(data);
+            MFloatArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty())
+                src.get(dst.data());
+            return true;
+        }
+        if (data.hasFn(MFn::kDoubleArrayData)) {
+            MFnDoubleArrayData dataFn(data);
+            MDoubleArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty()) {
+                std::unique_ptr<double[]> values(new double[dst.size()]);
+                src.get(values.get());
+                BulkConverter::convert(values.get(), dst.data(), dst.size());
+            }
+            return true;
+        }
+        return false;
+    }
+
+    static MObject create(const VtArray<float>& src, MFnData::Type dataType)
+    {
+        const unsigned int count = static_cast<unsigned int>(src.size());
+        if (dataType == MFnData::kDoubleArray) {
+            MFnDoubleArrayData dataFn;
+            return dataFn.create(MDoubleArray(src.cdata(), count));
+        }
+        MFnFloatArrayData dataFn;
+        return dataFn.create(MFloatArray(src.cdata(), count));
+    }
+};
+
+//! \brief  Type trait for VtArray<double> providing bulk conversions from and to MDoubleArray and
+//! MFloatArray data.
+template <> struct MakeBulkArrayData<VtArray<double>> : public std::true_type
+{
+    static bool read(const MObject& data, VtArray<double>& dst)
+    {
+        if (data.hasFn(MFn::kDoubleArrayData)) {
+            MFnDoubleArrayData dataFn(data);
+            MDoubleArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty())
+                src.get(dst.data());
+            return true;
+        }
+        if (data.hasFn(MFn::kFloatArrayData)) {
+            MFnFloatArrayData dataFn(data);
+            MFloatArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty())
+                src.get(dst.data());
+            return true;
+        }
+        return false;
+    }
+
+    static MObject create(const VtArray<double>& src, MFnData::Type dataType)
+    {
+        const unsigned int count = static_cast<unsigned int>(src.size());
+        if (dataType == MFnData::kFloatArray) {
+            MFnFloatArrayData dataFn;
+            return dataFn.create(MFloatArray(src.cdata(), count));
+        }
+        MFnDoubleArrayData dataFn;
+        return dataFn.create(MDoubleArray(src.cdata(), count));
+    }
+};
+
+//! \brief  Type trait for VtArray<GfVec3f> providing bulk conversions from and to MPointArray
+//! and MVectorArray data.
+template <> struct MakeBulkArrayData<VtArray<GfVec3f>> : public std::true_type
+{
+    static bool read(const MObject& data, VtArray<GfVec3f>& dst)
+    {
+        if (data.hasFn(MFn::kPointArrayData)) {
+            MFnPointArrayData dataFn(data);
+            BulkConverter::read(dataFn.array(), dst);
+            return true;
+        }
+        if (data.hasFn(MFn::kVectorArrayData)) {
+            MFnVectorArrayData dataFn(data);
+            MVectorArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty())
+                src.get(reinterpret_cast<float(*)[3]>(dst.data()));
+            return true;
+        }
+        return false;
+    }
+
+    static MObject create(const VtArray<GfVec3f>& src, MFnData::Type dataType)
+    {
+        if (dataType == MFnData::kVectorArray) {
+            MFnVectorArrayData dataFn;
+            return dataFn.create(MVectorArray(
+                reinterpret_cast<const float(*)[3]>(src.cdata()),
+                static_cast<unsigned int>(src.size())));
+        }
+        MFnPointArrayData dataFn;
+        return dataFn.create(BulkConverter::createPointArray(src));
+    }
+};
+
+//! \brief  Type trait for VtArray<GfVec3d> providing bulk conversions from and to MVectorArray
+//! and MPointArray data.
+template <> struct MakeBulkArrayData<VtArray<GfVec3d>> : public std::true_type
+{
+    static bool read(const MObject& data, VtArray<GfVec3d>& dst)
+    {
+        if (data.hasFn(MFn::kVectorArrayData)) {
+            MFnVectorArrayData dataFn(data);
+            MVectorArray       src = dataFn.array();
+            dst.resize(src.length());
+            if (!dst.empty())
+                src.get(reinterpret_cast<double(*)[3]>(dst.data()));
+            return true;
+        }
+        if (data.hasFn(MFn::kPointArrayData)) {
+            MFnPointArrayData dataFn(data);
+            BulkConverter::read(dataFn.array(), dst);
+            return true;
+        }
+        return false;
+    }
+
+    static MObject create(const VtArray<GfVec3d>& src, MFnData::Type dataType)
+    {
+        if (dataType == MFnData::kPointArray) {
+            MFnPointArrayData dataFn;
+            return dataFn.create(BulkConverter::createPointArray(src));
+        }
+        MFnVectorArrayData dataFn;
+        return dataFn.create(MVectorArray(
+            reinterpret_cast<const double(*)[3]>(src.cdata()),
+            static_cast<unsigned int>(src.size())));
+    }
+};
+
+//! \brief  Utility class for bulk conversion between typed array data and Usd arrays, for plugs
+//! and data handles.
+template <class USD_ArrayType> struct MBulkArrayConvert
+{
+    using BulkHelper = MakeBulkArrayData<USD_ArrayType>;
+
+    //! \brief  Return the array data type of the plug attribute, used to pick the Maya array
+    //! type created when converting to Maya.
+    static MFnData::Type dataType(const MPlug& plug)
+    {
+        MObject object = plug.attribute();
+        if (!object.hasFn(MFn::kTypedAttribute)) {
+            return MFnData::kInvalid;
+        }
+
+        MFnTypedAttribute attr(object);
+        return attr.attrType();
+    }
+
+    // MPlug <--> PXR_NS::UsdAttribute
+    static void convert(const MPlug& src, PXR_NS::UsdAttribute& dst, const ConverterArgs& args)
+    {
+        USD_ArrayType tmpDst;
+        if (BulkHelper::read(src.asMObject(), tmpDst)) {
+            dst.Set<USD_ArrayType>(tmpDst, args._timeCode);
+        }
+    }
+    static void convert(const PXR_NS::UsdAttribute& src, MPlug& dst, const ConverterArgs& args)
+    {
+        USD_ArrayType tmpSrc;
+        src.Get<USD_ArrayType>(&tmpSrc, args._timeCode);
+        dst.setMObject(BulkHelper::create(tmpSrc, dataType(dst)));
+    }
+    static void convert(
+        const PXR_NS::UsdAttribute& src,
+        MPlug&                      plug,
+        MDGModifier&                dst,
+        const ConverterArgs&        args)
+    {
+        USD_ArrayType tmpSrc;
+        src.Get<USD_ArrayType>(&tmpSrc, args._timeCode);
+        dst.newPlugValue(plug, BulkHelper::create(tmpSrc, dataType(plug)));
+    }
+
+    // MPlug <--> VtValue
+    static void convert(const MPlug& src, VtValue& dst, const ConverterArgs&)
+    {
+        USD_ArrayType tmpDst;
+        BulkHelper::read(src.asMObject(), tmpDst);
+        dst = tmpDst;
+    }
+    static void convert(const VtValue& src, MPlug& dst, const ConverterArgs&)
+    {
+        const USD_ArrayType& tmpSrc = src.Get<USD_ArrayType>();
+        dst.setMObject(BulkHelper::create(tmpSrc, dataType(dst)));
+    }
+    static void convert(const VtValue& src, MPlug& plug, MDGModifier& dst, const ConverterArgs&)
+    {
+        const USD_ArrayType& tmpSrc = src.Get<USD_ArrayType>();
+        dst.newPlugValue(plug, BulkHelper::create(tmpSrc, dataType(plug)));
+    }
+
+    // MDataHandle <--> PXR_NS::UsdAttribute
+    static void
+    convert(const MDataHandle& src, PXR_NS::UsdAttribute& dst, const ConverterArgs& args)
+    {
+        USD_ArrayType tmpDst;
+        if (BulkHelper::read(const_cast<MDataHandle&>(src).data(), tmpDst)) {
+            dst.Set<USD_ArrayType>(tmpDst, args._timeCode);
+        }
+    }
+    static void
+    convert(const PXR_NS::UsdAttribute& src, MDataHandle& dst, const ConverterArgs& args)
+    {
+        USD_ArrayType tmpSrc;
+        src.Get<USD_ArrayType>(&tmpSrc, args._timeCode);
+        dst.setMObject(BulkHelper::create(tmpSrc, dst.type()));
+    }
+
+    // MDataHandle <--> VtValue
+    static void convert(const MDataHandle& src, VtValue& dst, const ConverterArgs&)
+    {
+        USD_ArrayType tmpDst;
+        BulkHelper::read(const_cast<MDataHandle&>(src).data(), tmpDst);
+        dst = tmpDst;
+    }
+    static void convert(const VtValue& src, MDataHandle& dst, const ConverterArgs&)
+    {
+        const USD_ArrayType& tmpSrc = src.Get<USD_ArrayType>();
+        dst.setMObject(BulkHelper::create(tmpSrc, dst.type()));
+    }
+};
+
 //---------------------------------------------------------------------------------
 //! \brief  Storage for generated instances of converters.
 using ConvertStorage = std::unordered_map<SdfValueTypeName, const Converter, SdfValueTypeNameHash>;
@@ -1054,6 +1347,35 @@ struct Converter::GenerateConverters
                 ));
     }
 
+    template <class USD_ArrayType>
+    static void createBulkConverter(ConvertStorage& converters, const SdfValueTypeName& typeName)
+    {
+        converters.emplace(
+            typeName,
+            Converter(
+                typeName,
+                &MBulkArrayConvert<USD_ArrayType>::convert // MPlugToUsdAttrFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // UsdAttrToMPlugFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // UsdAttrToMDGModifierFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // MPlugToVtValueFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // VtValueToMPlugFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // VtValueToMDGModifierFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // MDataHandleToUsdAttrFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // UsdAttrToMDataHandleFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // MDataHandleToVtValueFn
+                ,
+                &MBulkArrayConvert<USD_ArrayType>::convert // VtValueToMDataHandleFn
+                ));
+    }
+
     static ConvertStorage generate()
     {
         ConvertStorage converters;
@@ -1076,8 +1398,13 @@ struct Converter::GenerateConverters
         createConverter<double3, GfVec3d, NeedsGammaCorrection::kYes>(
             converters, SdfValueTypeNames->Color3d);
 
-        createConverter<MIntArray, VtArray<int>>(converters, SdfValueTypeNames->IntArray);
-        createConverter<MPointArray, VtArray<GfVec3f>>(converters, SdfValueTypeNames->Point3fArray);
+        createBulkConverter<VtArray<int>>(converters, SdfValueTypeNames->IntArray);
+        createBulkConverter<VtArray<float>>(converters, SdfValueTypeNames->FloatArray);
+        createBulkConverter<VtArray<double>>(converters, SdfValueTypeNames->DoubleArray);
+        createBulkConverter<VtArray<GfVec3f>>(converters, SdfValueTypeNames->Point3fArray);
+        createBulkConverter<VtArray<GfVec3f>>(converters, SdfValueTypeNames->Vector3fArray);
+        createBulkConverter<VtArray<GfVec3d>>(converters, SdfValueTypeNames->Point3dArray);
+        createBulkConverter<VtArray<GfVec3d>>(converters, SdfValueTypeNames->Vector3dArray);
         createConverter<MMatrixArray, VtArray<GfMatrix4d>>(
             converters, SdfValueTypeNames->Matrix4dArray);
 
@@ -1143,6 +1470,123 @@ namespace {
 ConvertStorage _converters = Converter::GenerateConverters::generate();
 //! \brief  Global storage for array attribute converters
 ConvertStorage _convertersForArrayPlug = Converter::GenerateArrayPlugConverters::generate();
+
+//---------------------------------------------------------------------------------
+//! \brief  Cache of the converters found for pairs of Maya attribute and Usd type. Finding the
+//! Usd type of a plug goes through several function sets, which dominates the lookup when the
+//! same plugs are converted repeatedly (e.g. every frame by the proxy accessor). The least
+//! recently used entries are evicted first, so that the plugs converted every frame stay cached.
+class ConverterLookupCache
+{
+public:
+    //! \brief  Look for a cached converter. Return false if the pair is not cached.
+    bool find(
+        const MObject&          attribute,
+        const SdfValueTypeName& typeName,
+        bool                    isArrayPlug,
+        const Converter*&       converter)
+    {
+        const Key key { MObjectHandle(attribute), typeName, isArrayPlug };
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto findIt = _index.find(key);
+        if (findIt == _index.end())
+            return false;
+
+        // The attribute may have been deleted and its memory reused by another attribute.
+        if (!findIt->first.attribute.isAlive()) {
+            _entries.erase(findIt->second);
+            _index.erase(findIt);
+            return false;
+        }
+
+        _entries.splice(_entries.begin(), _entries, findIt->second);
+        converter = findIt->second->second;
+        ++_hitCount;
+        return true;
+    }
+
+    //! \brief  Cache the converter found for the given pair.
+    void insert(
+        const MObject&          attribute,
+        const SdfValueTypeName& typeName,
+        bool                    isArrayPlug,
+        const Converter*        converter)
+    {
+        const Key key { MObjectHandle(attribute), typeName, isArrayPlug };
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto findIt = _index.find(key);
+        if (findIt != _index.end()) {
+            findIt->second->second = converter;
+            _entries.splice(_entries.begin(), _entries, findIt->second);
+            return;
+        }
+
+        // Entries of deleted dynamic attributes are never looked up again, keep the cache bounded.
+        if (_index.size() >= maxEntries) {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+
+        _entries.emplace_front(key, converter);
+        _index.emplace(key, _entries.begin());
+    }
+
+    //! \brief  Return the number of lookups answered by the cache.
+    size_t hitCount()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _hitCount;
+    }
+
+private:
+    struct Key
+    {
+        MObjectHandle    attribute;
+        SdfValueTypeName typeName;
+        bool             isArrayPlug;
+
+        bool operator==(const Key& other) const
+        {
+            return attribute == other.attribute && typeName == other.typeName
+                && isArrayPlug == other.isArrayPlug;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = key.attribute.hashCode();
+            MayaUsd::hash_combine(seed, SdfValueTypeNameHash()(key.typeName));
+            MayaUsd::hash_combine(seed, key.isArrayPlug);
+            return seed;
+        }
+    };
+
+    using Entries = std::list<std::pair<Key, const Converter*>>;
+
+    static constexpr std::size_t maxEntries = 4096;
+
+    std::mutex                                          _mutex;
+    Entries                                             _entries; //!< Most recently used first
+    std::unordered_map<Key, Entries::iterator, KeyHash> _index;
+    size_t                                              _hitCount = 0;
+};
+
+ConverterLookupCache _converterLookupCache;
+
+//! \brief  Return true if the Usd type of the plug depends on its current data, in which case
+//! the converter found for its attribute cannot be cached.
+bool isDataDependentType(const MPlug& plug)
+{
+    MObject object = plug.attribute();
+    return object.hasFn(MFn::kTypedAttribute)
+        && MFnTypedAttribute(object).attrType() == MFnData::kNumeric;
+}
 } // namespace
 
 const Converter* Converter::find(const SdfValueTypeName& typeName, bool isArrayPlug)
@@ -1158,12 +1602,94 @@ const Converter* Converter::find(const SdfValueTypeName& typeName, bool isArrayP
 
 const Converter* Converter::find(const MPlug& plug, const PXR_NS::UsdAttribute& attr)
 {
+    const MObject          attribute = plug.attribute();
+    const SdfValueTypeName attrTypeName = attr.GetTypeName();
+    const bool             isArrayPlug = plug.isArray();
+
+    const Converter* converter = nullptr;
+    if (_converterLookupCache.find(attribute, attrTypeName, isArrayPlug, converter))
+        return converter;
+
     auto valueTypeName = getUsdTypeName(plug, false);
+    if (attrTypeName == valueTypeName)
+        converter = find(valueTypeName, isArrayPlug);
 
-    if (attr.GetTypeName() != valueTypeName)
-        return nullptr;
+    if (!isDataDependentType(plug))
+        _converterLookupCache.insert(attribute, attrTypeName, isArrayPlug, converter);
+
+    return converter;
+}
+
+size_t Converter::getLookupCacheHitCount() { return _converterLookupCache.hitCount(); }
+
+void BulkConverter::convert(const double* src, float* dst, size_t count)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= count; i += 4) {
+        UsdUfe::storeu4f(dst + i, UsdUfe::cvt4d_to_4f(UsdUfe::loadu4d(src + i)));
+    }
+#elif defined(__SSE__)
+    for (; i + 4 <= count; i += 4) {
+        const UsdUfe::f128 lo = UsdUfe::cvt2d_to_2f(UsdUfe::loadu2d(src + i));
+        const UsdUfe::f128 hi = UsdUfe::cvt2d_to_2f(UsdUfe::loadu2d(src + i + 2));
+        UsdUfe::storeu4f(dst + i, UsdUfe::movelh4f(lo, hi));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+void BulkConverter::convert(const double (*src)[4], GfVec3f* dst, size_t count)
+{
+    const double* srcData = src[0];
+    float*        dstData = dst->data();
+
+    // Each point is converted as 4 floats, the w component being overwritten by the next
+    // point. The last point is converted by the scalar loop to not write past the end.
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 1 < count; ++i) {
+        UsdUfe::storeu4f(dstData + i * 3, UsdUfe::cvt4d_to_4f(UsdUfe::loadu4d(srcData + i * 4)));
+    }
+#elif defined(__SSE__)
+    for (; i + 1 < count; ++i) {
+        const UsdUfe::f128 xy = UsdUfe::cvt2d_to_2f(UsdUfe::loadu2d(srcData + i * 4));
+        const UsdUfe::f128 zw = UsdUfe::cvt2d_to_2f(UsdUfe::loadu2d(srcData + i * 4 + 2));
+        UsdUfe::storeu4f(dstData + i * 3, UsdUfe::movelh4f(xy, zw));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i].Set(float(src[i][0]), float(src[i][1]), float(src[i][2]));
+    }
+}
+
+void BulkConverter::convert(const GfVec3f* src, double (*dst)[4], size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i][0] = src[i][0];
+        dst[i][1] = src[i][1];
+        dst[i][2] = src[i][2];
+        dst[i][3] = 1.0;
+    }
+}
 
-    return find(valueTypeName, plug.isArray());
+void BulkConverter::convert(const double (*src)[4], GfVec3d* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i].Set(src[i][0], src[i][1], src[i][2]);
+    }
+}
+
+void BulkConverter::convert(const GfVec3d* src, double (*dst)[4], size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i][0] = src[i][0];
+        dst[i][1] = src[i][1];
+        dst[i][2] = src[i][2];
+        dst[i][3] = 1.0;
+    }
 }
 
 SdfValueTypeName
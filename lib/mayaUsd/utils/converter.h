@@ -19,6 +19,8 @@
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/utils/userTaggedAttribute.h>
 
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
 #include <pxr/base/vt/value.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/valueTypeName.h>
@@ -37,6 +39,8 @@
 #include <maya/MPointArray.h>
 #include <maya/MString.h>
 
+#include <memory>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace MAYAUSD_NS_DEF {
@@ -158,6 +162,9 @@ public:
     //! \brief  Look for converter which allows translation for given pair of Maya's plug and
     //! Usd attribute. \return Valid pointer if conversion is supported.
     static const Converter* find(const MPlug& plug, const PXR_NS::UsdAttribute& attr);
+    //! \brief  Return the number of lookups of find(plug, attr) answered by its cache. Used by
+    //! tests.
+    static size_t getLookupCacheHitCount();
 
     //! \brief  Return sdf value type name this converter is registered for.
     const SdfValueTypeName& usdType() const { return _usdTypeName; }
@@ -322,6 +329,46 @@ private:
     VtValueToMDataHandleFn _vtValueToHandle { nullptr };
 };
 
+//! \brief  Bulk conversion of contiguous buffers, used by the array converters. The Maya arrays
+//! are copied to and from these buffers with their get() methods and constructors, since their
+//! storage is not guaranteed to be contiguous. Conversions from double to single precision are
+//! vectorized when SIMD instructions are available.
+struct MAYAUSD_CORE_PUBLIC BulkConverter final
+{
+    //! \brief  Convert \p count doubles to floats.
+    static void convert(const double* src, float* dst, size_t count);
+
+    //! \brief  Convert \p count homogeneous points, as returned by MPointArray::get(). The w
+    //! component is ignored, and set to 1 when converting to homogeneous points.
+    static void convert(const double (*src)[4], GfVec3f* dst, size_t count);
+    static void convert(const GfVec3f* src, double (*dst)[4], size_t count);
+    static void convert(const double (*src)[4], GfVec3d* dst, size_t count);
+    static void convert(const GfVec3d* src, double (*dst)[4], size_t count);
+
+    //! \brief  Read the points of \p src into \p dst.
+    template <class VEC3> static void read(const MPointArray& src, VtArray<VEC3>& dst)
+    {
+        dst.resize(src.length());
+        if (dst.empty())
+            return;
+
+        std::unique_ptr<double[][4]> points(new double[dst.size()][4]);
+        src.get(points.get());
+        convert(points.get(), dst.data(), dst.size());
+    }
+
+    //! \brief  Create an array of the points of \p src.
+    template <class VEC3> static MPointArray createPointArray(const VtArray<VEC3>& src)
+    {
+        if (src.empty())
+            return MPointArray();
+
+        std::unique_ptr<double[][4]> points(new double[src.size()][4]);
+        convert(src.cdata(), points.get(), src.size());
+        return MPointArray(points.get(), static_cast<unsigned int>(src.size()));
+    }
+};
+
 //! \brief  Declaration of base typed converter struct. Each supported type will specialize this
 //! struct and provide
 //!         two conversion methods. All specializations will be available in converter header
@@ -427,18 +474,14 @@ template <> struct TypedConverter<MIntArray, VtArray<int>>
 {
     static void convert(const VtArray<int>& src, MIntArray& dst)
     {
-        const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
-        }
+        dst = MIntArray(src.cdata(), static_cast<unsigned int>(src.size()));
     }
     static void convert(const MIntArray& src, VtArray<int>& dst)
     {
         const size_t srcSize = src.length();
         dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            dst[i] = src[i];
+        if (srcSize > 0) {
+            src.get(dst.data());
         }
     }
 };
@@ -448,19 +491,11 @@ template <> struct TypedConverter<MPointArray, VtArray<GfVec3f>>
 {
     static void convert(const VtArray<GfVec3f>& src, MPointArray& dst)
     {
-        const size_t srcSize = src.size();
-        dst.setLength(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
-        }
+        dst = BulkConverter::createPointArray(src);
     }
     static void convert(const MPointArray& src, VtArray<GfVec3f>& dst)
     {
-        const size_t srcSize = src.length();
-        dst.resize(srcSize);
-        for (size_t i = 0; i < srcSize; i++) {
-            TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
-        }
+        BulkConverter::read(src, dst);
     }
 };
 
@@ -47,11 +47,52 @@ std::string handlePythonException()
     return extract<std::string>(formatted);
 }
 
+// Copy the routing data filled by a Python edit router back into the C++ dictionary.
+void extractRoutingData(
+    const PXR_BOOST_PYTHON_NAMESPACE::dict& dictObject,
+    PXR_NS::VtDictionary&                   routingData)
+{
+    // Extract keys and values individually so that we can extract
+    // PXR_NS::UsdEditTarget correctly from PXR_NS::TfPyObjWrapper.
+    const PXR_BOOST_PYTHON_NAMESPACE::object items = dictObject.items();
+    for (PXR_BOOST_PYTHON_NAMESPACE::ssize_t i = 0; i < len(items); ++i) {
+
+        PXR_BOOST_PYTHON_NAMESPACE::extract<std::string> keyExtractor(items[i][0]);
+        if (!keyExtractor.check()) {
+            continue;
+        }
+
+        PXR_BOOST_PYTHON_NAMESPACE::extract<PXR_NS::VtValue> valueExtractor(items[i][1]);
+        if (!valueExtractor.check()) {
+            continue;
+        }
+
+        auto vtvalue = valueExtractor();
+
+        if (vtvalue.IsHolding<PXR_NS::TfPyObjWrapper>()) {
+            const auto wrapper = vtvalue.Get<PXR_NS::TfPyObjWrapper>();
+
+            PXR_NS::TfPyLock                                           lock;
+            PXR_BOOST_PYTHON_NAMESPACE::extract<PXR_NS::UsdEditTarget> editTargetExtractor(
+                wrapper.Get());
+            if (editTargetExtractor.check()) {
+                auto editTarget = editTargetExtractor();
+                routingData[keyExtractor()] = PXR_NS::VtValue(editTarget);
+            }
+        } else {
+            routingData[keyExtractor()] = vtvalue;
+        }
+    }
+}
+
 class PyEditRouter : public UsdUfe::EditRouter
 {
 public:
-    PyEditRouter(PyObject* pyCallable)
+    // When isBatch is true, the Python callable receives a list of contexts
+    // and a list of routing data dictionaries instead of a single one of each.
+    PyEditRouter(PyObject* pyCallable, bool isBatch = false)
         : _pyCb(pyCallable)
+        , _isBatch(isBatch)
     {
         if (_pyCb)
             Py_INCREF(_pyCb);
@@ -66,17 +107,50 @@ public:
 
     void operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData) override
     {
-        // Note: necessary to compile the TF_WARN macro as it refers to USD types without using
-        //       the namespace prefix.
-        PXR_NAMESPACE_USING_DIRECTIVE;
+        PXR_NS::TfPyLock pyLock;
+        if (!PyCallable_Check(_pyCb)) {
+            return;
+        }
+
+        if (_isBatch) {
+            std::vector<PXR_NS::VtDictionary> routingDatas(1, routingData);
+            callBatch({ context }, routingDatas);
+            routingData = routingDatas[0];
+        } else {
+            callSingle(context, routingData);
+        }
+    }
+
+    void routeBatch(
+        const std::vector<PXR_NS::VtDictionary>& contexts,
+        std::vector<PXR_NS::VtDictionary>&       routingData) override
+    {
+        routingData.resize(contexts.size());
 
+        // Take the Python lock and validate the callable once for the whole batch.
         PXR_NS::TfPyLock pyLock;
         if (!PyCallable_Check(_pyCb)) {
             return;
         }
-        PXR_BOOST_PYTHON_NAMESPACE::dict dictObject(routingData);
+
+        if (_isBatch) {
+            callBatch(contexts, routingData);
+        } else {
+            for (size_t i = 0; i < contexts.size(); ++i)
+                callSingle(contexts[i], routingData[i]);
+        }
+    }
+
+private:
+    // Call the Python callable, converting Python errors to C++ exceptions.
+    template <typename... Args> void call(const Args&... args)
+    {
+        // Note: necessary to compile the TF_WARN macro as it refers to USD types without using
+        //       the namespace prefix.
+        PXR_NAMESPACE_USING_DIRECTIVE;
+
         try {
-            call<void>(_pyCb, context, dictObject);
+            PXR_BOOST_PYTHON_NAMESPACE::call<void>(_pyCb, args...);
         } catch (const PXR_BOOST_PYTHON_NAMESPACE::error_already_set&) {
             const std::string errorMessage = handlePythonException();
             PXR_BOOST_PYTHON_NAMESPACE::handle_exception();
@@ -87,42 +161,38 @@ public:
             TF_WARN("%s", ex.what());
             throw;
         }
+    }
 
-        // Extract keys and values individually so that we can extract
-        // PXR_NS::UsdEditTarget correctly from PXR_NS::TfPyObjWrapper.
-        const PXR_BOOST_PYTHON_NAMESPACE::object items = dictObject.items();
-        for (PXR_BOOST_PYTHON_NAMESPACE::ssize_t i = 0; i < len(items); ++i) {
-
-            PXR_BOOST_PYTHON_NAMESPACE::extract<std::string> keyExtractor(items[i][0]);
-            if (!keyExtractor.check()) {
-                continue;
-            }
-
-            PXR_BOOST_PYTHON_NAMESPACE::extract<PXR_NS::VtValue> valueExtractor(items[i][1]);
-            if (!valueExtractor.check()) {
-                continue;
-            }
+    void callSingle(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
+    {
+        PXR_BOOST_PYTHON_NAMESPACE::dict dictObject(routingData);
+        call(context, dictObject);
+        extractRoutingData(dictObject, routingData);
+    }
 
-            auto vtvalue = valueExtractor();
+    void callBatch(
+        const std::vector<PXR_NS::VtDictionary>& contexts,
+        std::vector<PXR_NS::VtDictionary>&       routingData)
+    {
+        PXR_BOOST_PYTHON_NAMESPACE::list contextList;
+        PXR_BOOST_PYTHON_NAMESPACE::list dictList;
+        for (size_t i = 0; i < contexts.size(); ++i) {
+            contextList.append(contexts[i]);
+            dictList.append(PXR_BOOST_PYTHON_NAMESPACE::dict(routingData[i]));
+        }
 
-            if (vtvalue.IsHolding<PXR_NS::TfPyObjWrapper>()) {
-                const auto wrapper = vtvalue.Get<PXR_NS::TfPyObjWrapper>();
+        call(contextList, dictList);
 
-                PXR_NS::TfPyLock                                           lock;
-                PXR_BOOST_PYTHON_NAMESPACE::extract<PXR_NS::UsdEditTarget> editTargetExtractor(
-                    wrapper.Get());
-                if (editTargetExtractor.check()) {
-                    auto editTarget = editTargetExtractor();
-                    routingData[keyExtractor()] = PXR_NS::VtValue(editTarget);
-                }
-            } else {
-                routingData[keyExtractor()] = vtvalue;
-            }
+        for (size_t i = 0; i < contexts.size(); ++i) {
+            PXR_BOOST_PYTHON_NAMESPACE::extract<PXR_BOOST_PYTHON_NAMESPACE::dict> dictExtractor(
+                dictList[i]);
+            if (dictExtractor.check())
+                extractRoutingData(dictExtractor(), routingData[i]);
         }
     }
 
-private:
     PyObject* _pyCb;
+    bool      _isBatch;
 };
 
 UsdUfe::OperationEditRouterContext*
@@ -181,6 +251,12 @@ void wrapEditRouter()
                 operation, std::make_shared<PyEditRouter>(editRouter));
         });
 
+    def(
+        "registerBatchEditRouter", +[](const PXR_NS::TfToken& operation, PyObject* editRouter) {
+            return UsdUfe::registerEditRouter(
+                operation, std::make_shared<PyEditRouter>(editRouter, true));
+        });
+
     def("registerStageLayerEditRouter", &registerStageLayerEditRouterFromLayerName);
     def("registerStageLayerEditRouter", &registerStageLayerEditRouterFromLayer);
 
@@ -190,6 +266,14 @@ void wrapEditRouter()
 
     def("clearAllEditRouters", &UsdUfe::clearAllEditRouters);
 
+    def("clearEditRouterCache", &UsdUfe::clearEditRouterCache);
+
+    def(
+        "getEditRouterLayers",
+        +[](const PXR_NS::TfToken& operation, const std::vector<PXR_NS::UsdPrim>& prims) {
+            return UsdUfe::getEditRouterLayers(operation, prims);
+        });
+
     using OpThis = UsdUfe::OperationEditRouterContext;
     class_<OpThis, PXR_BOOST_PYTHON_NAMESPACE::noncopyable>("OperationEditRouterContext", no_init)
         .def("__init__", make_constructor(OperationEditRouterContextInit));
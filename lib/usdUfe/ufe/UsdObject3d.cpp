@@ -17,10 +17,10 @@
 
 #include <usdUfe/ufe/UsdUndoVisibleCommand.h>
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/bboxCacheService.h>
 #include <usdUfe/utils/editRouter.h>
 #include <usdUfe/utils/editRouterContext.h>
 
-#include <pxr/usd/usdGeom/bboxCache.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
 #include <ufe/attributes.h>
@@ -88,9 +88,10 @@ Ufe::BBox3d UsdObject3d::boundingBox() const
     purposes.emplace_back(PXR_NS::UsdGeomTokens->default_);
 
     // UsdGeomImageable::ComputeUntransformedBound() just calls
-    // UsdGeomBBoxCache, so do this here as well.
+    // UsdGeomBBoxCache, so do this here as well. Use the shared cache
+    // so that repeated queries on the same subtrees are not recomputed.
     auto time = getTime(path);
-    auto bbox = PXR_NS::UsdGeomBBoxCache(time, purposes).ComputeUntransformedBound(_prim);
+    auto bbox = BBoxCacheService::instance().computeUntransformedBound(_prim, time, purposes);
 
     // Adjust extents for this runtime.
     adjustBBoxExtents(bbox, time);
@@ -31,6 +31,8 @@
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <optional>
+
 namespace USDUFE_NS_DEF {
 
 // Ensure that UsdUndoDuplicateCommand is properly setup.
@@ -87,6 +89,18 @@ UsdUndoDuplicateCommand::Ptr UsdUndoDuplicateCommand::create(
 {
     return std::make_shared<UsdUndoDuplicateCommand>(srcItem, dstParentItem);
 }
+
+UsdUndoDuplicateCommand::Ptr UsdUndoDuplicateCommand::create(
+    const UsdSceneItem::Ptr&      srcItem,
+    const UsdSceneItem::Ptr&      dstParentItem,
+    const PXR_NS::SdfLayerHandle& routedLayer)
+{
+    auto cmd = std::make_shared<UsdUndoDuplicateCommand>(srcItem, dstParentItem);
+    cmd->_isRouted = true;
+    cmd->_routedLayer = routedLayer;
+    return cmd;
+}
+
 UsdSceneItem::Ptr UsdUndoDuplicateCommand::duplicatedItem() const
 {
     Ufe::Path ufeSrcPath;
@@ -112,7 +126,12 @@ void UsdUndoDuplicateCommand::execute()
     auto path = prim.GetPath();
     auto stage = prim.GetStage();
 
-    OperationEditRouterContext ctx(EditRoutingTokens->RouteDuplicate, prim);
+    // Use the layer routed by the caller, if any, rather than routing again.
+    std::optional<OperationEditRouterContext> ctx;
+    if (_isRouted)
+        ctx.emplace(stage, _routedLayer);
+    else
+        ctx.emplace(EditRoutingTokens->RouteDuplicate, prim);
 
     // The loaded state of a model is controlled by the load rules of the stage.
     // When duplicating a node, we want the new node to be in the same loaded
@@ -21,6 +21,7 @@
 #include <usdUfe/ufe/UsdSceneItem.h>
 #include <usdUfe/undo/UsdUndoableItem.h>
 
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
 
 #include <ufe/path.h>
@@ -51,6 +52,13 @@ public:
     //! Create a UsdUndoDuplicateCommand from a SceneItem and its parent destination.
     static Ptr create(const UsdSceneItem::Ptr& srcItem, const UsdSceneItem::Ptr& dstParentItem);
 
+    //! Create a UsdUndoDuplicateCommand using a layer already routed by the caller, for
+    //! example with getEditRouterLayers. A null layer keeps the edit target of the stage.
+    static Ptr create(
+        const UsdSceneItem::Ptr&      srcItem,
+        const UsdSceneItem::Ptr&      dstParentItem,
+        const PXR_NS::SdfLayerHandle& routedLayer);
+
     UsdSceneItem::Ptr duplicatedItem() const;
     UFE_V4(Ufe::SceneItem::Ptr sceneItem() const override { return duplicatedItem(); })
 
@@ -67,6 +75,9 @@ private:
     PXR_NS::SdfPath         _usdDstPath;
     PXR_NS::UsdStageWeakPtr _dstStage;
     PXR_NS::UsdStageWeakPtr _srcStage;
+
+    bool                   _isRouted = false;
+    PXR_NS::SdfLayerHandle _routedLayer;
 }; // UsdUndoDuplicateCommand
 
 } // namespace USDUFE_NS_DEF
@@ -18,7 +18,9 @@
 
 #include <usdUfe/ufe/UsdUndoDuplicateCommand.h>
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/base/tokens.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/utils/editRouter.h>
 
 #include <ufe/hierarchy.h>
 
@@ -64,8 +66,19 @@ void UsdUndoDuplicateSelectionCommand::execute()
 {
     UsdUndoBlock undoBlock(&_undoableItem);
 
+    // Route all the duplicates with a single call to the edit router. The
+    // duplicate commands use the routed layers instead of routing again.
+    std::vector<PXR_NS::UsdPrim> srcPrims;
+    srcPrims.reserve(_sourceItems.size());
     for (auto&& usdItem : _sourceItems) {
-        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, _dstParentItem);
+        srcPrims.push_back(usdItem->prim());
+    }
+    const auto dstLayers = getEditRouterLayers(EditRoutingTokens->RouteDuplicate, srcPrims);
+
+    for (size_t i = 0; i < _sourceItems.size(); ++i) {
+        const auto& usdItem = _sourceItems[i];
+
+        auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, _dstParentItem, dstLayers[i]);
         duplicateCmd->execute();
 
         _duplicatedItemsMap.emplace(usdItem, downcast(duplicateCmd->duplicatedItem()));
@@ -0,0 +1,612 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdUndoLog.h"
+
+#include <usdUfe/undo/UsdUndoStateDelegate.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/fastCompression.h>
+#include <pxr/base/vt/array.h>
+
+#include <unordered_set>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    USDUFE_UNDO_COMPRESSION_THRESHOLD,
+    0,
+    "Size in bytes above which array values kept for undo are compressed. "
+    "Zero disables the compression.");
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Array types that can be compressed. The index in this list is the type
+// identifier stored with the compressed data.
+enum CompressedType : uint8_t
+{
+    FloatArray,
+    DoubleArray,
+    IntArray,
+    Vec2fArray,
+    Vec3fArray,
+    Vec3dArray,
+    Vec4fArray,
+    QuatfArray,
+    Matrix4dArray
+};
+
+template <class T>
+bool compressArray(const VtValue& value, std::size_t threshold, std::vector<char>& bytes)
+{
+    const VtArray<T>& array = value.UncheckedGet<VtArray<T>>();
+    const std::size_t numBytes = array.size() * sizeof(T);
+    if (numBytes < threshold || numBytes > TfFastCompression::GetMaxInputSize())
+        return false;
+
+    bytes.resize(TfFastCompression::GetCompressedBufferSize(numBytes));
+    const std::size_t compressedSize = TfFastCompression::CompressToBuffer(
+        reinterpret_cast<const char*>(array.cdata()), bytes.data(), numBytes);
+
+    // Only keep the compressed data if it is actually smaller.
+    if (compressedSize == 0 || compressedSize >= numBytes)
+        return false;
+
+    bytes.resize(compressedSize);
+    bytes.shrink_to_fit();
+    return true;
+}
+
+template <class T>
+bool decompressArray(const std::vector<char>& bytes, std::size_t count, VtValue& value)
+{
+    VtArray<T>        array(count);
+    const std::size_t numBytes = count * sizeof(T);
+    if (TfFastCompression::DecompressFromBuffer(
+            bytes.data(), reinterpret_cast<char*>(array.data()), numBytes)
+        != numBytes)
+        return false;
+
+    value = VtValue::Take(array);
+    return true;
+}
+
+bool compressValue(
+    const VtValue&     value,
+    uint8_t&           type,
+    std::size_t&       count,
+    std::vector<char>& bytes)
+{
+    static const std::size_t threshold = TfGetEnvSetting(USDUFE_UNDO_COMPRESSION_THRESHOLD);
+    if (threshold == 0 || !value.IsArrayValued())
+        return false;
+
+    count = value.GetArraySize();
+
+#define USDUFE_TRY_COMPRESS(ElemType, TypeId)                    \
+    if (value.IsHolding<VtArray<ElemType>>()) {                  \
+        type = TypeId;                                           \
+        return compressArray<ElemType>(value, threshold, bytes); \
+    }
+
+    USDUFE_TRY_COMPRESS(float, FloatArray)
+    USDUFE_TRY_COMPRESS(double, DoubleArray)
+    USDUFE_TRY_COMPRESS(int, IntArray)
+    USDUFE_TRY_COMPRESS(GfVec2f, Vec2fArray)
+    USDUFE_TRY_COMPRESS(GfVec3f, Vec3fArray)
+    USDUFE_TRY_COMPRESS(GfVec3d, Vec3dArray)
+    USDUFE_TRY_COMPRESS(GfVec4f, Vec4fArray)
+    USDUFE_TRY_COMPRESS(GfQuatf, QuatfArray)
+    USDUFE_TRY_COMPRESS(GfMatrix4d, Matrix4dArray)
+
+#undef USDUFE_TRY_COMPRESS
+
+    return false;
+}
+
+bool decompressValue(
+    uint8_t                  type,
+    std::size_t              count,
+    const std::vector<char>& bytes,
+    VtValue&                 value)
+{
+    switch (type) {
+    case FloatArray: return decompressArray<float>(bytes, count, value);
+    case DoubleArray: return decompressArray<double>(bytes, count, value);
+    case IntArray: return decompressArray<int>(bytes, count, value);
+    case Vec2fArray: return decompressArray<GfVec2f>(bytes, count, value);
+    case Vec3fArray: return decompressArray<GfVec3f>(bytes, count, value);
+    case Vec3dArray: return decompressArray<GfVec3d>(bytes, count, value);
+    case Vec4fArray: return decompressArray<GfVec4f>(bytes, count, value);
+    case QuatfArray: return decompressArray<GfQuatf>(bytes, count, value);
+    case Matrix4dArray: return decompressArray<GfMatrix4d>(bytes, count, value);
+    }
+
+    TF_CODING_ERROR("Unknown compressed undo value type.");
+    return false;
+}
+
+// Find the index of a value in a deduplicated table, adding it if needed.
+// The lookup map is rebuilt lazily when it was released by compact().
+template <class T, class Map> uint32_t dedupIndex(const T& value, std::vector<T>& table, Map& map)
+{
+    if (map.size() != table.size()) {
+        map.clear();
+        for (std::size_t i = 0; i < table.size(); ++i)
+            map.emplace(table[i], static_cast<uint32_t>(i));
+    }
+
+    auto inserted = map.emplace(value, static_cast<uint32_t>(table.size()));
+    if (inserted.second)
+        table.push_back(value);
+    return inserted.first->second;
+}
+
+} // namespace
+
+namespace USDUFE_NS_DEF {
+
+UsdUndoLog::UsdUndoLog(const UsdUndoLog& other) { append(other); }
+
+UsdUndoLog& UsdUndoLog::operator=(const UsdUndoLog& other)
+{
+    if (this != &other) {
+        clear();
+        append(other);
+    }
+    return *this;
+}
+
+void UsdUndoLog::locateRecord(std::size_t index, std::size_t& chunk, std::size_t& offset)
+{
+    // Chunk k starts at record firstChunkSize * (2^k - 1).
+    std::size_t scaledIndex = index / firstChunkSize + 1;
+    chunk = 0;
+    while (scaledIndex >>= 1)
+        ++chunk;
+    offset = index - firstChunkSize * ((std::size_t(1) << chunk) - 1);
+}
+
+UsdUndoLog::Record&
+UsdUndoLog::addRecord(Op op, UsdUndoStateDelegate* delegate, const SdfPath& path)
+{
+    std::size_t chunk, offset;
+    locateRecord(_size, chunk, offset);
+    if (chunk == _chunks.size()) {
+        _chunks.emplace_back();
+        _chunks.back().reserve(firstChunkSize << chunk);
+    }
+
+    _chunks[chunk].emplace_back();
+    Record& record = _chunks[chunk].back();
+    ++_size;
+
+    record.op = op;
+    record.flags = 0;
+    record.delegate = delegate ? indexOf(delegate) : noIndex;
+    record.path = path.IsEmpty() ? noIndex : indexOf(path);
+    record.token = noIndex;
+    record.extra = noIndex;
+    record.payload = noIndex;
+    record.time = 0.0;
+    return record;
+}
+
+UsdUndoLog::Record& UsdUndoLog::recordAt(std::size_t index)
+{
+    std::size_t chunk, offset;
+    locateRecord(index, chunk, offset);
+    return _chunks[chunk][offset];
+}
+
+const UsdUndoLog::Record& UsdUndoLog::recordAt(std::size_t index) const
+{
+    std::size_t chunk, offset;
+    locateRecord(index, chunk, offset);
+    return _chunks[chunk][offset];
+}
+
+void UsdUndoLog::truncate(std::size_t size)
+{
+    if (size >= _size)
+        return;
+
+    std::size_t chunk, offset;
+    locateRecord(size, chunk, offset);
+    if (offset == 0) {
+        _chunks.resize(chunk);
+    } else {
+        _chunks.resize(chunk + 1);
+        _chunks.back().resize(offset);
+    }
+    _size = size;
+}
+
+uint32_t UsdUndoLog::indexOf(UsdUndoStateDelegate* delegate)
+{
+    return dedupIndex(delegate, _delegates, _delegateIndices);
+}
+
+uint32_t UsdUndoLog::indexOf(const SdfPath& path) { return dedupIndex(path, _paths, _pathIndices); }
+
+uint32_t UsdUndoLog::indexOf(const TfToken& token)
+{
+    return dedupIndex(token, _tokens, _tokenIndices);
+}
+
+void UsdUndoLog::storeValue(Record& record, const VtValue& value)
+{
+    CompressedValue compressed;
+    if (compressValue(value, compressed.type, compressed.count, compressed.bytes)) {
+        record.flags |= Compressed;
+        record.payload = static_cast<uint32_t>(_compressedValues.size());
+        _compressedValues.push_back(std::move(compressed));
+    } else {
+        record.payload = static_cast<uint32_t>(_values.size());
+        _values.push_back(value);
+    }
+}
+
+VtValue
+UsdUndoLog::valueOf(const Record& record, const std::vector<VtValue>& decompressedValues) const
+{
+    if (record.flags & Compressed)
+        return decompressedValues[record.payload];
+    return _values[record.payload];
+}
+
+void UsdUndoLog::addSetField(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        path,
+    const TfToken&        fieldName,
+    const VtValue&        inverse)
+{
+    Record& record = addRecord(Op::SetField, delegate, path);
+    record.token = indexOf(fieldName);
+    storeValue(record, inverse);
+}
+
+void UsdUndoLog::addSetFieldDictValueByKey(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        path,
+    const TfToken&        fieldName,
+    const TfToken&        keyPath,
+    const VtValue&        inverse)
+{
+    Record& record = addRecord(Op::SetFieldDictValueByKey, delegate, path);
+    record.token = indexOf(fieldName);
+    record.extra = indexOf(keyPath);
+    storeValue(record, inverse);
+}
+
+void UsdUndoLog::addSetTimeSample(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        path,
+    double                time,
+    const VtValue&        inverse)
+{
+    Record& record = addRecord(Op::SetTimeSample, delegate, path);
+    record.time = time;
+    storeValue(record, inverse);
+}
+
+void UsdUndoLog::addCreateSpec(UsdUndoStateDelegate* delegate, const SdfPath& path, bool inert)
+{
+    Record& record = addRecord(Op::CreateSpec, delegate, path);
+    if (inert)
+        record.flags |= Inert;
+}
+
+void UsdUndoLog::addDeleteSpec(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        path,
+    bool                  inert,
+    SdfSpecType           deletedSpecType,
+    const SdfDataRefPtr&  deletedData)
+{
+    Record& record = addRecord(Op::DeleteSpec, delegate, path);
+    if (inert)
+        record.flags |= Inert;
+    record.extra = static_cast<uint32_t>(deletedSpecType);
+    record.payload = static_cast<uint32_t>(_deletedData.size());
+    _deletedData.push_back(deletedData);
+}
+
+void UsdUndoLog::addMoveSpec(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        oldPath,
+    const SdfPath&        newPath)
+{
+    Record& record = addRecord(Op::MoveSpec, delegate, oldPath);
+    record.extra = indexOf(newPath);
+}
+
+void UsdUndoLog::addPushChild(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        parentPath,
+    const TfToken&        fieldName,
+    const TfToken&        value)
+{
+    Record& record = addRecord(Op::PushTokenChild, delegate, parentPath);
+    record.token = indexOf(fieldName);
+    record.extra = indexOf(value);
+}
+
+void UsdUndoLog::addPushChild(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        parentPath,
+    const TfToken&        fieldName,
+    const SdfPath&        value)
+{
+    Record& record = addRecord(Op::PushPathChild, delegate, parentPath);
+    record.token = indexOf(fieldName);
+    record.extra = indexOf(value);
+}
+
+void UsdUndoLog::addPopChild(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        parentPath,
+    const TfToken&        fieldName,
+    const TfToken&        oldValue)
+{
+    Record& record = addRecord(Op::PopTokenChild, delegate, parentPath);
+    record.token = indexOf(fieldName);
+    record.extra = indexOf(oldValue);
+}
+
+void UsdUndoLog::addPopChild(
+    UsdUndoStateDelegate* delegate,
+    const SdfPath&        parentPath,
+    const TfToken&        fieldName,
+    const SdfPath&        oldValue)
+{
+    Record& record = addRecord(Op::PopPathChild, delegate, parentPath);
+    record.token = indexOf(fieldName);
+    record.extra = indexOf(oldValue);
+}
+
+void UsdUndoLog::addInvertFunc(InvertFunc func)
+{
+    Record& record = addRecord(Op::InvertFunc, nullptr, SdfPath());
+    record.payload = static_cast<uint32_t>(_invertFuncs.size());
+    _invertFuncs.push_back(std::move(func));
+}
+
+void UsdUndoLog::append(const UsdUndoLog& other)
+{
+    for (std::size_t i = 0; i < other._size; ++i) {
+        const Record& src = other.recordAt(i);
+        const SdfPath path = (src.path == noIndex) ? SdfPath() : other._paths[src.path];
+        UsdUndoStateDelegate* delegate
+            = (src.delegate == noIndex) ? nullptr : other._delegates[src.delegate];
+
+        Record& dst = addRecord(src.op, delegate, path);
+        dst.flags = src.flags & Inert;
+        dst.time = src.time;
+        if (src.token != noIndex)
+            dst.token = indexOf(other._tokens[src.token]);
+
+        switch (src.op) {
+        case Op::SetFieldDictValueByKey:
+        case Op::PushTokenChild:
+        case Op::PopTokenChild: dst.extra = indexOf(other._tokens[src.extra]); break;
+        case Op::MoveSpec:
+        case Op::PushPathChild:
+        case Op::PopPathChild: dst.extra = indexOf(other._paths[src.extra]); break;
+        default: dst.extra = src.extra; break;
+        }
+
+        switch (src.op) {
+        case Op::SetField:
+        case Op::SetFieldDictValueByKey:
+        case Op::SetTimeSample:
+            if (src.flags & Compressed) {
+                dst.flags |= Compressed;
+                dst.payload = static_cast<uint32_t>(_compressedValues.size());
+                _compressedValues.push_back(other._compressedValues[src.payload]);
+            } else {
+                dst.payload = static_cast<uint32_t>(_values.size());
+                _values.push_back(other._values[src.payload]);
+            }
+            break;
+        case Op::DeleteSpec:
+            dst.payload = static_cast<uint32_t>(_deletedData.size());
+            _deletedData.push_back(other._deletedData[src.payload]);
+            break;
+        case Op::InvertFunc:
+            dst.payload = static_cast<uint32_t>(_invertFuncs.size());
+            _invertFuncs.push_back(other._invertFuncs[src.payload]);
+            break;
+        default: break;
+        }
+    }
+}
+
+bool UsdUndoLog::invert() const
+{
+    // Decompress all the values before inverting any edit, so that a value
+    // that cannot be decompressed does not leave the layers half restored.
+    std::vector<VtValue> decompressedValues(_compressedValues.size());
+    for (std::size_t i = 0; i < _compressedValues.size(); ++i) {
+        const CompressedValue& compressed = _compressedValues[i];
+        if (!decompressValue(
+                compressed.type, compressed.count, compressed.bytes, decompressedValues[i])) {
+            TF_RUNTIME_ERROR("Failed to decompress an undo value, the edits are not inverted.");
+            return false;
+        }
+    }
+
+    for (std::size_t i = _size; i-- > 0;) {
+        const Record&         record = recordAt(i);
+        UsdUndoStateDelegate* delegate
+            = (record.delegate == noIndex) ? nullptr : _delegates[record.delegate];
+        const SdfPath& path = (record.path == noIndex) ? SdfPath::EmptyPath() : _paths[record.path];
+        const bool     inert = (record.flags & Inert) != 0;
+
+        switch (record.op) {
+        case Op::SetField:
+            delegate->invertSetField(path, _tokens[record.token], valueOf(record, decompressedValues));
+            break;
+        case Op::SetFieldDictValueByKey:
+            delegate->invertSetFieldDictValueByKey(
+                path, _tokens[record.token], _tokens[record.extra], valueOf(record, decompressedValues));
+            break;
+        case Op::SetTimeSample:
+            delegate->invertSetTimeSample(path, record.time, valueOf(record, decompressedValues));
+            break;
+        case Op::CreateSpec: delegate->invertCreateSpec(path, inert); break;
+        case Op::DeleteSpec:
+            delegate->invertDeleteSpec(
+                path,
+                inert,
+                static_cast<SdfSpecType>(record.extra),
+                _deletedData[record.payload]);
+            break;
+        case Op::MoveSpec: delegate->invertMoveSpec(path, _paths[record.extra]); break;
+        case Op::PushTokenChild:
+            delegate->invertPushTokenChild(path, _tokens[record.token], _tokens[record.extra]);
+            break;
+        case Op::PushPathChild:
+            delegate->invertPushPathChild(path, _tokens[record.token], _paths[record.extra]);
+            break;
+        case Op::PopTokenChild:
+            delegate->invertPopTokenChild(path, _tokens[record.token], _tokens[record.extra]);
+            break;
+        case Op::PopPathChild:
+            delegate->invertPopPathChild(path, _tokens[record.token], _paths[record.extra]);
+            break;
+        case Op::InvertFunc: _invertFuncs[record.payload](); break;
+        }
+    }
+
+    return true;
+}
+
+void UsdUndoLog::coalesce()
+{
+    // Key identifying what a value record restores. The indices are
+    // deduplicated, so comparing them is enough. The operation does not need
+    // to be part of the key: set field records have no extra index, dictionary
+    // records have one and time sample records have no field name.
+    struct ValueKey
+    {
+        explicit ValueKey(const Record& record)
+            : delegate(record.delegate)
+            , path(record.path)
+            , token(record.token)
+            , extra(record.extra)
+            , time(record.time)
+        {
+        }
+
+        bool operator==(const ValueKey& other) const
+        {
+            return delegate == other.delegate && path == other.path && token == other.token
+                && extra == other.extra && time == other.time;
+        }
+
+        uint32_t delegate;
+        uint32_t path;
+        uint32_t token;
+        uint32_t extra;
+        double   time;
+    };
+
+    struct ValueKeyHash
+    {
+        std::size_t operator()(const ValueKey& key) const
+        {
+            std::size_t    hash = std::hash<double>()(key.time);
+            const uint32_t indices[] = { key.delegate, key.path, key.token, key.extra };
+            for (uint32_t index : indices)
+                hash ^= index + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    std::unordered_set<ValueKey, ValueKeyHash> seenKeys;
+
+    std::vector<VtValue>         keptValues;
+    std::vector<CompressedValue> keptCompressedValues;
+
+    std::size_t keptCount = 0;
+    for (std::size_t i = 0; i < _size; ++i) {
+        Record record = recordAt(i);
+
+        const bool isValueRecord = record.op == Op::SetField
+            || record.op == Op::SetFieldDictValueByKey || record.op == Op::SetTimeSample;
+
+        if (isValueRecord) {
+            // Since the inverse edits are replayed in reverse order, the earliest
+            // record of a given value is the one that restores the original value.
+            // The later ones are overwritten by it and are redundant.
+            if (!seenKeys.insert(ValueKey(record)).second)
+                continue;
+
+            if (record.flags & Compressed) {
+                keptCompressedValues.push_back(std::move(_compressedValues[record.payload]));
+                record.payload = static_cast<uint32_t>(keptCompressedValues.size() - 1);
+            } else {
+                keptValues.push_back(std::move(_values[record.payload]));
+                record.payload = static_cast<uint32_t>(keptValues.size() - 1);
+            }
+        } else {
+            // Structural edits may depend on the intermediate values, so only
+            // coalesce value edits that are not separated by them.
+            seenKeys.clear();
+        }
+
+        recordAt(keptCount) = record;
+        ++keptCount;
+    }
+
+    truncate(keptCount);
+    _values = std::move(keptValues);
+    _compressedValues = std::move(keptCompressedValues);
+}
+
+void UsdUndoLog::compact()
+{
+    _delegateIndices = {};
+    _pathIndices = {};
+    _tokenIndices = {};
+
+    // Only the last chunk can be partially used.
+    if (!_chunks.empty())
+        _chunks.back().shrink_to_fit();
+    _chunks.shrink_to_fit();
+
+    _delegates.shrink_to_fit();
+    _paths.shrink_to_fit();
+    _tokens.shrink_to_fit();
+    _values.shrink_to_fit();
+    _compressedValues.shrink_to_fit();
+    _deletedData.shrink_to_fit();
+    _invertFuncs.shrink_to_fit();
+}
+
+void UsdUndoLog::clear() { *this = UsdUndoLog(); }
+
+} // namespace USDUFE_NS_DEF
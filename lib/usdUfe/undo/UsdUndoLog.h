@@ -0,0 +1,226 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_UNDO_UNDOLOG_H
+#define USDUFE_UNDO_UNDOLOG_H
+
+#include <usdUfe/base/api.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/data.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/types.h>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace USDUFE_NS_DEF {
+
+class UsdUndoStateDelegate;
+
+//! \brief Compact log of inverse edits.
+/*!
+    Stores the inverse of every authoring operation recorded by the
+    UsdUndoStateDelegate as a small fixed-size tagged record, instead of
+    one heap-allocated closure per edit. Records are allocated in chunks of
+    geometrically increasing size, so that a log of a few edits stays small,
+    paths and tokens are stored once per log and referenced by index, and
+    large array values can optionally be compressed, see the environment
+    variable USDUFE_UNDO_COMPRESSION_THRESHOLD.
+
+    Arbitrary inverse functions are still supported for edits that are not
+    recorded by the state delegate.
+*/
+class USDUFE_PUBLIC UsdUndoLog
+{
+public:
+    using InvertFunc = std::function<void()>;
+
+    UsdUndoLog() = default;
+    ~UsdUndoLog() = default;
+
+    UsdUndoLog(const UsdUndoLog&);
+    UsdUndoLog& operator=(const UsdUndoLog&);
+
+    UsdUndoLog(UsdUndoLog&&) = default;
+    UsdUndoLog& operator=(UsdUndoLog&&) = default;
+
+    // Record the inverse of the authoring operations of the state delegate.
+    void addSetField(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& path,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::VtValue& inverse);
+    void addSetFieldDictValueByKey(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& path,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::TfToken& keyPath,
+        const PXR_NS::VtValue& inverse);
+    void addSetTimeSample(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& path,
+        double                 time,
+        const PXR_NS::VtValue& inverse);
+    void addCreateSpec(UsdUndoStateDelegate* delegate, const PXR_NS::SdfPath& path, bool inert);
+    void addDeleteSpec(
+        UsdUndoStateDelegate*        delegate,
+        const PXR_NS::SdfPath&       path,
+        bool                         inert,
+        PXR_NS::SdfSpecType          deletedSpecType,
+        const PXR_NS::SdfDataRefPtr& deletedData);
+    void addMoveSpec(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& oldPath,
+        const PXR_NS::SdfPath& newPath);
+    void addPushChild(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& parentPath,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::TfToken& value);
+    void addPushChild(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& parentPath,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::SdfPath& value);
+    void addPopChild(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& parentPath,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::TfToken& oldValue);
+    void addPopChild(
+        UsdUndoStateDelegate*  delegate,
+        const PXR_NS::SdfPath& parentPath,
+        const PXR_NS::TfToken& fieldName,
+        const PXR_NS::SdfPath& oldValue);
+
+    // Record an arbitrary inverse function.
+    void addInvertFunc(InvertFunc func);
+
+    // Append all the records of the other log after the records of this log.
+    void append(const UsdUndoLog& other);
+
+    // Invoke all inverse edits, in the reverse order of their recording.
+    // Returns false, without applying any edit, if a compressed value
+    // cannot be decompressed.
+    bool invert() const;
+
+    // Remove the value edits that are made redundant by an earlier edit of
+    // the same field or time sample, keeping only the one that restores
+    // the original value.
+    void coalesce();
+
+    // Release the memory only needed while recording. Called once the log
+    // is transferred to an undoable item.
+    void compact();
+
+    void clear();
+
+    std::size_t size() const { return _size; }
+    bool        empty() const { return _size == 0; }
+
+    // Number of values stored compressed.
+    std::size_t compressedValueCount() const { return _compressedValues.size(); }
+
+private:
+    enum class Op : uint8_t
+    {
+        SetField,
+        SetFieldDictValueByKey,
+        SetTimeSample,
+        CreateSpec,
+        DeleteSpec,
+        MoveSpec,
+        PushTokenChild,
+        PushPathChild,
+        PopTokenChild,
+        PopPathChild,
+        InvertFunc
+    };
+
+    enum Flags : uint8_t
+    {
+        Inert = 1 << 0,
+        Compressed = 1 << 1
+    };
+
+    // The meaning of the indices depends on the operation:
+    // - path is an index in _paths,
+    // - token is an index in _tokens (field name),
+    // - extra is an index in _tokens (key path, child name), in _paths
+    //   (new path, child path) or the deleted spec type,
+    // - payload is an index in _values, _compressedValues, _deletedData or _invertFuncs.
+    struct Record
+    {
+        Op       op;
+        uint8_t  flags;
+        uint32_t delegate;
+        uint32_t path;
+        uint32_t token;
+        uint32_t extra;
+        uint32_t payload;
+        double   time;
+    };
+
+    // Array value compressed with TfFastCompression.
+    struct CompressedValue
+    {
+        uint8_t           type;
+        std::size_t       count;
+        std::vector<char> bytes;
+    };
+
+    // Chunk k holds firstChunkSize << k records.
+    static constexpr std::size_t firstChunkSize = 16;
+    static constexpr uint32_t    noIndex = ~uint32_t(0);
+
+    static void locateRecord(std::size_t index, std::size_t& chunk, std::size_t& offset);
+
+    Record&       addRecord(Op op, UsdUndoStateDelegate* delegate, const PXR_NS::SdfPath& path);
+    Record&       recordAt(std::size_t index);
+    const Record& recordAt(std::size_t index) const;
+    void          truncate(std::size_t size);
+
+    uint32_t indexOf(UsdUndoStateDelegate* delegate);
+    uint32_t indexOf(const PXR_NS::SdfPath& path);
+    uint32_t indexOf(const PXR_NS::TfToken& token);
+    void     storeValue(Record& record, const PXR_NS::VtValue& value);
+
+    PXR_NS::VtValue
+    valueOf(const Record& record, const std::vector<PXR_NS::VtValue>& decompressedValues) const;
+
+    std::vector<std::vector<Record>> _chunks;
+    std::size_t                      _size { 0 };
+
+    std::vector<UsdUndoStateDelegate*> _delegates;
+    std::vector<PXR_NS::SdfPath>       _paths;
+    std::vector<PXR_NS::TfToken>       _tokens;
+    std::vector<PXR_NS::VtValue>       _values;
+    std::vector<CompressedValue>       _compressedValues;
+    std::vector<PXR_NS::SdfDataRefPtr> _deletedData;
+    std::vector<InvertFunc>            _invertFuncs;
+
+    // Deduplication indices, only kept while recording.
+    std::unordered_map<UsdUndoStateDelegate*, uint32_t>                         _delegateIndices;
+    std::unordered_map<PXR_NS::SdfPath, uint32_t, PXR_NS::SdfPath::Hash>        _pathIndices;
+    std::unordered_map<PXR_NS::TfToken, uint32_t, PXR_NS::TfToken::HashFunctor> _tokenIndices;
+};
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_UNDO_UNDOLOG_H
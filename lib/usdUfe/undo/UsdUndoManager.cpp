@@ -43,26 +43,38 @@ void UsdUndoManager::trackLayerStates(const SdfLayerHandle& layer)
     }
 }
 
-void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func)
+void UsdUndoManager::addInverse(UsdUndoLog::InvertFunc func)
+{
+    if (UsdUndoLog* undoLog = recordingLog())
+        undoLog->addInvertFunc(std::move(func));
+}
+
+UsdUndoLog* UsdUndoManager::recordingLog()
 {
     if (UsdUndoBlock::depth() == 0) {
         TF_CODING_ERROR("Collecting invert functions outside of undoblock is not allowed!");
-        return;
+        return nullptr;
     }
 
-    _invertFuncs.emplace_back(func);
+    return &_undoLog;
 }
 
 void UsdUndoManager::transferEdits(UsdUndoableItem& undoableItem, bool extraEdits)
 {
+    // Only the earliest inverse of a value edited multiple times in the
+    // block is needed, drop the others.
+    _undoLog.coalesce();
+
     // transfer the edits
     if (extraEdits) {
-        undoableItem._invertFuncs.insert(
-            undoableItem._invertFuncs.begin(), _invertFuncs.begin(), _invertFuncs.end());
-        _invertFuncs.clear();
+        // The new edits go before the edits already in the item.
+        _undoLog.append(undoableItem._undoLog);
+        undoableItem._undoLog = std::move(_undoLog);
     } else {
-        undoableItem._invertFuncs = std::move(_invertFuncs);
+        undoableItem._undoLog = std::move(_undoLog);
     }
+    _undoLog.clear();
+    undoableItem._undoLog.compact();
 }
 
 } // namespace USDUFE_NS_DEF
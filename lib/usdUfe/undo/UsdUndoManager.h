@@ -33,7 +33,7 @@ namespace USDUFE_NS_DEF {
 /*!
     The UndoManager is responsible for :
     1- tracking layer state changes from UsdUndoStateDelegate
-    2- collecting InvertFunc() in every state change
+    2- collecting inverse edits in every state change
     3- transferring collected edits into an UsdUndoableItem
 */
 class USDUFE_PUBLIC UsdUndoManager
@@ -53,15 +53,16 @@ private:
     UsdUndoManager() = default;
     ~UsdUndoManager() = default;
 
-    void addInverse(UsdUndoableItem::InvertFunc func);
-    void transferEdits(UsdUndoableItem& undoableItem, bool extraEdits);
+    void        addInverse(UsdUndoLog::InvertFunc func);
+    UsdUndoLog* recordingLog();
+    void        transferEdits(UsdUndoableItem& undoableItem, bool extraEdits);
 
 private:
-    UsdUndoableItem::InvertFuncs _invertFuncs;
+    UsdUndoLog _undoLog;
 };
 
 //! \brief Helper struct which exists only to provide controlled,
-//!        deliberate access to UsdUndoManager addInverse/transferEdits
+//!        deliberate access to UsdUndoManager addInverse/recordingLog/transferEdits
 //!        private methods.
 class USDUFE_PUBLIC UsdUndoManagerAccessor
 {
@@ -71,11 +72,17 @@ public:
     ~UsdUndoManagerAccessor() = delete;
     USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdUndoManagerAccessor);
 
-    static void addInverse(UsdUndoableItem::InvertFunc func)
+    static void addInverse(UsdUndoLog::InvertFunc func)
     {
         auto& undoManager = UsdUfe::UsdUndoManager::instance();
         undoManager.addInverse(func);
     }
+    // Returns the log receiving the inverse edits, or null outside of an undo block.
+    static UsdUndoLog* recordingLog()
+    {
+        auto& undoManager = UsdUfe::UsdUndoManager::instance();
+        return undoManager.recordingLog();
+    }
     static void transferEdits(UsdUndoableItem& undoableItem, bool extraEdits = false)
     {
         auto& undoManager = UsdUfe::UsdUndoManager::instance();
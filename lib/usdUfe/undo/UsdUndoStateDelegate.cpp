@@ -344,8 +344,8 @@ void UsdUndoStateDelegate::_OnSetField(
 
     const VtValue inverseValue = _layer->GetField(path, fieldName);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addSetField(this, path, fieldName, inverseValue);
 }
 
 void UsdUndoStateDelegate::_OnSetField(
@@ -372,8 +372,8 @@ void UsdUndoStateDelegate::_OnSetField(
     const VtValue inverseValue = _layer->GetField(path, fieldName);
 
     // add invert
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addSetField(this, path, fieldName, inverseValue);
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKey(
@@ -426,8 +426,8 @@ void UsdUndoStateDelegate::_OnCreateSpec(const SdfPath& path, SdfSpecType specTy
 
     _deletedByUndoCreate.erase(path);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertCreateSpec, this, path, inert));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addCreateSpec(this, path, inert);
 }
 
 void UsdUndoStateDelegate::_OnDeleteSpec(const SdfPath& path, bool inert)
@@ -458,8 +458,8 @@ void UsdUndoStateDelegate::_OnDeleteSpec(const SdfPath& path, bool inert)
 
     const SdfSpecType deletedSpecType = _GetLayer()->GetSpecType(path);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertDeleteSpec, this, path, inert, deletedSpecType, deletedData));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addDeleteSpec(this, path, inert, deletedSpecType, deletedData);
 }
 
 void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& newPath)
@@ -480,8 +480,8 @@ void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& ne
         return;
     }
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertMoveSpec, this, oldPath, newPath));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addMoveSpec(this, oldPath, newPath);
 }
 
 void UsdUndoStateDelegate::_OnPushChild(
@@ -505,8 +505,8 @@ void UsdUndoStateDelegate::_OnPushChild(
         return;
     }
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertPushTokenChild, this, parentPath, fieldName, value));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addPushChild(this, parentPath, fieldName, value);
 }
 
 void UsdUndoStateDelegate::_OnPushChild(
@@ -530,8 +530,8 @@ void UsdUndoStateDelegate::_OnPushChild(
         return;
     }
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertPushPathChild, this, parentPath, fieldName, value));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addPushChild(this, parentPath, fieldName, value);
 }
 
 void UsdUndoStateDelegate::_OnPopChild(
@@ -555,8 +555,8 @@ void UsdUndoStateDelegate::_OnPopChild(
         return;
     }
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertPopTokenChild, this, parentPath, fieldName, oldValue));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addPopChild(this, parentPath, fieldName, oldValue);
 }
 
 void UsdUndoStateDelegate::_OnPopChild(
@@ -580,8 +580,8 @@ void UsdUndoStateDelegate::_OnPopChild(
         return;
     }
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertPopPathChild, this, parentPath, fieldName, oldValue));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addPopChild(this, parentPath, fieldName, oldValue);
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
@@ -611,13 +611,8 @@ void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
 
     const VtValue inverseValue = _layer->GetFieldDictValueByKey(path, fieldName, keyPath);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertSetFieldDictValueByKey,
-        this,
-        path,
-        fieldName,
-        keyPath,
-        inverseValue));
+    if (UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog())
+        undoLog->addSetFieldDictValueByKey(this, path, fieldName, keyPath, inverseValue);
 }
 
 void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time)
@@ -632,21 +627,20 @@ void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time
     TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
         .Msg("Setting time sample '%f' for spec '%s'\n", time, path.GetText());
 
+    UsdUndoLog* undoLog = UsdUfe::UsdUndoManagerAccessor::recordingLog();
+    if (!undoLog) {
+        return;
+    }
+
     if (!_GetLayer()->HasField(path, SdfFieldKeys->TimeSamples)) {
-        UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-            &UsdUndoStateDelegate::invertSetField,
-            this,
-            path,
-            SdfFieldKeys->TimeSamples,
-            VtValue()));
+        undoLog->addSetField(this, path, SdfFieldKeys->TimeSamples, VtValue());
 
     } else {
         VtValue oldValue;
 
         _GetLayer()->QueryTimeSample(path, time, &oldValue);
 
-        UsdUfe::UsdUndoManagerAccessor::addInverse(
-            std::bind(&UsdUndoStateDelegate::invertSetTimeSample, this, path, time, oldValue));
+        undoLog->addSetTimeSample(this, path, time, oldValue);
     }
 }
 
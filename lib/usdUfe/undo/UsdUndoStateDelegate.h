@@ -37,8 +37,8 @@ TF_DECLARE_WEAK_AND_REF_PTRS(UsdUndoStateDelegate);
 /*!
     The state delegate is invoked on every authoring operation on a layer.
 
-    There exist exactly one invert function for every authoring operation. These invert functions
-   are collected by UsdUndoManager::addInverse() call which then will be transfered to an
+    There exist exactly one invert function for every authoring operation. These inverse edits
+   are recorded in the UsdUndoManager undo log which then will be transfered to an
    UsdUndoableItem object when UsdUndoBlock expires.
 */
 class USDUFE_PUBLIC UsdUndoStateDelegate : public SdfLayerStateDelegateBase
@@ -54,6 +54,8 @@ public:
     static void notifyInvert();
 
 private:
+    friend class UsdUndoLog;
+
     void invertSetField(const SdfPath& path, const TfToken& fieldName, const VtValue& inverse);
     void invertCreateSpec(const SdfPath& path, bool inert);
     void invertDeleteSpec(
@@ -37,15 +37,20 @@ void UsdUndoableItem::doInvert()
     // Signal so that any per-invert tracking state can be updated.
     UsdUndoStateDelegate::notifyInvert();
 
-    UsdUndoBlock undoBlock(this);
-
-    // call invert functions in reverse order
+    // The undo block replaces the log of this item with the inverse of the
+    // inverted edits, keep the current log in case they cannot be inverted.
+    UsdUndoLog undoLog = std::move(_undoLog);
+    bool       inverted = false;
     {
+        UsdUndoBlock undoBlock(this);
+
+        // call invert functions in reverse order
         SdfChangeBlock changeBlock;
-        for (auto it = _invertFuncs.rbegin(); it != _invertFuncs.rend(); ++it) {
-            (*it)();
-        }
+        inverted = undoLog.invert();
     }
+
+    if (!inverted)
+        _undoLog = std::move(undoLog);
 }
 
 } // namespace USDUFE_NS_DEF
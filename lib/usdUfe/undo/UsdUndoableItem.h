@@ -18,22 +18,23 @@
 #define USDUFE_UNDO_UNDOABLE_ITEM_H
 
 #include <usdUfe/base/api.h>
-
-#include <functional>
-#include <vector>
+#include <usdUfe/undo/UsdUndoLog.h>
 
 namespace USDUFE_NS_DEF {
 
 //! \brief UsdUndoableItem
 /*!
-    This class stores the list of inverse edit functions that are invoked
-    on undo() / redo() call. This is the object that must be placed in DCC's undo stack.
+    This class stores the log of inverse edits that are invoked on undo() / redo()
+    call. This is the object that must be placed in DCC's undo stack.
 */
 class USDUFE_PUBLIC UsdUndoableItem
 {
 public:
-    using InvertFunc = std::function<void()>;
-    using InvertFuncs = std::vector<InvertFunc>;
+    //! \deprecated The inverse edits are now kept in a UsdUndoLog, use UsdUndoLog::InvertFunc.
+    using InvertFunc [[deprecated("Use UsdUndoLog::InvertFunc")]] = UsdUndoLog::InvertFunc;
+    //! \deprecated The inverse edits are now kept in a UsdUndoLog.
+    using InvertFuncs [[deprecated("Use std::vector<UsdUndoLog::InvertFunc>")]]
+        = std::vector<UsdUndoLog::InvertFunc>;
 
     // default constructor/destructor
     UsdUndoableItem() = default;
@@ -50,14 +51,14 @@ public:
     void undo();
     void redo();
 
-    std::size_t getEditCount() const { return _invertFuncs.size(); }
+    std::size_t getEditCount() const { return _undoLog.size(); }
 
 private:
     friend class UsdUndoManager;
 
     void doInvert();
 
-    InvertFuncs _invertFuncs;
+    UsdUndoLog _undoLog;
 };
 
 } // namespace USDUFE_NS_DEF
@@ -0,0 +1,245 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "bboxCacheService.h"
+
+#include <pxr/usd/sdf/path.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace {
+
+// Check if a property change can affect the bounds of prims.
+bool canAffectBounds(const PXR_NS::SdfPath& path)
+{
+    if (!path.IsPropertyPath())
+        return true;
+
+    // These namespaces hold shading and binding data that never contribute
+    // to extents or transforms. The widths of points and curves are the
+    // exception, they are authored as a primvar and change the extent.
+    static const std::string ignoredPrefixes[]
+        = { "primvars:", "material:", "inputs:", "outputs:", "collection:" };
+    static const std::string widthsPrimvar = "primvars:widths";
+
+    const std::string& name = path.GetName();
+    if (name == widthsPrimvar)
+        return true;
+
+    for (const std::string& prefix : ignoredPrefixes)
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            return false;
+
+    return true;
+}
+
+// Distance in time of a cache from the requested time, used to pick the cache
+// to evict. The caches at the default time are a bucket of their own: they are
+// never evicted for a numeric time, and are always kept over the numeric ones
+// when the default time is requested.
+double timeDistance(const PXR_NS::UsdTimeCode& cacheTime, const PXR_NS::UsdTimeCode& time)
+{
+    if (cacheTime.IsDefault())
+        return time.IsDefault() ? 0.0 : -1.0;
+    if (time.IsDefault())
+        return std::numeric_limits<double>::infinity();
+    return std::abs(cacheTime.GetValue() - time.GetValue());
+}
+
+} // namespace
+
+namespace USDUFE_NS_DEF {
+
+bool BBoxCacheService::CacheKey::operator<(const CacheKey& other) const
+{
+    if (time != other.time)
+        return time < other.time;
+    return purposes < other.purposes;
+}
+
+/*static*/
+BBoxCacheService& BBoxCacheService::instance()
+{
+    static BBoxCacheService service;
+    return service;
+}
+
+BBoxCacheService::BBoxCacheService()
+{
+    auto me = PXR_NS::TfCreateWeakPtr(this);
+    _objectsChangedKey = PXR_NS::TfNotice::Register(me, &BBoxCacheService::onObjectsChanged);
+}
+
+BBoxCacheService::~BBoxCacheService() { PXR_NS::TfNotice::Revoke(_objectsChangedKey); }
+
+BBoxCacheService::StageEntryPtr BBoxCacheService::getStageEntry(const PXR_NS::UsdStagePtr& stage)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    StageEntryPtr& entry = _stageCaches[stage];
+    if (!entry)
+        entry = std::make_shared<StageEntry>();
+    return entry;
+}
+
+/*static*/
+PXR_NS::UsdGeomBBoxCache& BBoxCacheService::getCache(
+    StageEntry&                  entry,
+    const PXR_NS::UsdTimeCode&   time,
+    const PXR_NS::TfTokenVector& purposes)
+{
+    CacheKey key { time, purposes };
+    std::sort(key.purposes.begin(), key.purposes.end());
+
+    CacheMap& caches = entry.caches;
+    auto      cacheIter = caches.find(key);
+    if (cacheIter != caches.end())
+        return *cacheIter->second;
+
+    // Keep the number of caches bounded. Drop the one furthest in time
+    // from the requested time, since playback moves monotonically.
+    if (caches.size() >= maxCachesPerStage) {
+        auto furthest = caches.begin();
+        double furthestDistance = timeDistance(furthest->first.time, time);
+        for (auto iter = std::next(caches.begin()); iter != caches.end(); ++iter) {
+            const double distance = timeDistance(iter->first.time, time);
+            if (distance > furthestDistance) {
+                furthest = iter;
+                furthestDistance = distance;
+            }
+        }
+        caches.erase(furthest);
+    }
+
+    auto cache = std::make_unique<PXR_NS::UsdGeomBBoxCache>(time, key.purposes);
+    auto inserted = caches.emplace(std::move(key), std::move(cache));
+    return *inserted.first->second;
+}
+
+/*static*/
+PXR_NS::UsdGeomXformCache&
+BBoxCacheService::getXformCache(StageEntry& entry, const PXR_NS::UsdTimeCode& time)
+{
+    XformCacheMap& caches = entry.xformCaches;
+    auto           cacheIter = caches.find(time);
+    if (cacheIter != caches.end())
+        return *cacheIter->second;
+
+    if (caches.size() >= maxCachesPerStage) {
+        auto furthest = caches.begin();
+        double furthestDistance = timeDistance(furthest->first, time);
+        for (auto iter = std::next(caches.begin()); iter != caches.end(); ++iter) {
+            const double distance = timeDistance(iter->first, time);
+            if (distance > furthestDistance) {
+                furthest = iter;
+                furthestDistance = distance;
+            }
+        }
+        caches.erase(furthest);
+    }
+
+    auto inserted = caches.emplace(time, std::make_unique<PXR_NS::UsdGeomXformCache>(time));
+    return *inserted.first->second;
+}
+
+PXR_NS::GfBBox3d BBoxCacheService::computeUntransformedBound(
+    const PXR_NS::UsdPrim&       prim,
+    const PXR_NS::UsdTimeCode&   time,
+    const PXR_NS::TfTokenVector& purposes)
+{
+    if (!prim)
+        return {};
+
+    StageEntryPtr               entry = getStageEntry(prim.GetStage());
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    return getCache(*entry, time, purposes).ComputeUntransformedBound(prim);
+}
+
+PXR_NS::GfBBox3d BBoxCacheService::computeWorldBound(
+    const PXR_NS::UsdPrim&       prim,
+    const PXR_NS::UsdTimeCode&   time,
+    const PXR_NS::TfTokenVector& purposes)
+{
+    if (!prim)
+        return {};
+
+    StageEntryPtr               entry = getStageEntry(prim.GetStage());
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    return getCache(*entry, time, purposes).ComputeWorldBound(prim);
+}
+
+PXR_NS::GfMatrix4d BBoxCacheService::computeRelativeTransform(
+    const PXR_NS::UsdPrim&     prim,
+    const PXR_NS::UsdPrim&     ancestor,
+    const PXR_NS::UsdTimeCode& time)
+{
+    if (!prim || !ancestor)
+        return PXR_NS::GfMatrix4d(1.0);
+
+    StageEntryPtr               entry = getStageEntry(prim.GetStage());
+    std::lock_guard<std::mutex> lock(entry->mutex);
+
+    bool resetXformStack = false;
+    return getXformCache(*entry, time).ComputeRelativeTransform(prim, ancestor, &resetXformStack);
+}
+
+void BBoxCacheService::clearStage(const PXR_NS::UsdStagePtr& stage)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stageCaches.erase(stage);
+}
+
+void BBoxCacheService::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stageCaches.clear();
+}
+
+void BBoxCacheService::onObjectsChanged(
+    const PXR_NS::UsdNotice::ObjectsChanged& notice,
+    const PXR_NS::UsdStageWeakPtr&           sender)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Take the opportunity to drop the caches of expired stages.
+    for (auto iter = _stageCaches.begin(); iter != _stageCaches.end();) {
+        if (iter->first.IsExpired())
+            iter = _stageCaches.erase(iter);
+        else
+            ++iter;
+    }
+
+    auto stageIter = _stageCaches.find(sender);
+    if (stageIter == _stageCaches.end())
+        return;
+
+    bool affectsBounds = !notice.GetResyncedPaths().empty();
+    if (!affectsBounds) {
+        for (const PXR_NS::SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+            if (canAffectBounds(path)) {
+                affectsBounds = true;
+                break;
+            }
+        }
+    }
+
+    if (affectsBounds)
+        _stageCaches.erase(stageIter);
+}
+
+} // namespace USDUFE_NS_DEF
@@ -0,0 +1,150 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_BBOXCACHESERVICE_H
+#define USDUFE_BBOXCACHESERVICE_H
+
+#include <usdUfe/base/api.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace USDUFE_NS_DEF {
+
+//! \brief Shared bounding box cache service.
+/*!
+    Keeps one UsdGeomBBoxCache per stage, time and set of purposes so that
+    repeated bounding box queries (frame-selected, manipulators, Outliner,
+    proxy shape bounds) reuse the bounds already computed for the same
+    subtrees instead of recomputing them every time.
+
+    The caches of a stage are discarded when it sends an ObjectsChanged
+    notice that touches a path which can affect bounds. Changes that only
+    affect primvars, material bindings, shading inputs and outputs or
+    metadata of properties are ignored.
+
+    Each stage has its own lock, held while its bounds are computed, so that
+    queries on different stages run concurrently.
+ */
+class USDUFE_PUBLIC BBoxCacheService : public PXR_NS::TfWeakBase
+{
+public:
+    //! Retrieve the unique instance of the service.
+    static BBoxCacheService& instance();
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(BBoxCacheService);
+
+    //! Compute the bound of the prim in its own local space, like
+    //! UsdGeomBBoxCache::ComputeUntransformedBound().
+    PXR_NS::GfBBox3d computeUntransformedBound(
+        const PXR_NS::UsdPrim&       prim,
+        const PXR_NS::UsdTimeCode&   time,
+        const PXR_NS::TfTokenVector& purposes);
+
+    //! Compute the bound of the prim in world space, like
+    //! UsdGeomBBoxCache::ComputeWorldBound().
+    PXR_NS::GfBBox3d computeWorldBound(
+        const PXR_NS::UsdPrim&       prim,
+        const PXR_NS::UsdTimeCode&   time,
+        const PXR_NS::TfTokenVector& purposes);
+
+    //! Compute the transform of the prim relative to one of its ancestors,
+    //! like UsdGeomXformCache::ComputeRelativeTransform().
+    PXR_NS::GfMatrix4d computeRelativeTransform(
+        const PXR_NS::UsdPrim&     prim,
+        const PXR_NS::UsdPrim&     ancestor,
+        const PXR_NS::UsdTimeCode& time);
+
+    //! Discard all cached bounds of the given stage.
+    void clearStage(const PXR_NS::UsdStagePtr& stage);
+
+    //! Discard all cached bounds.
+    void clear();
+
+private:
+    BBoxCacheService();
+    ~BBoxCacheService();
+
+    // Key identifying a bbox cache. The purposes are kept sorted so that
+    // queries with the same purposes in a different order share the cache.
+    struct CacheKey
+    {
+        PXR_NS::UsdTimeCode   time;
+        PXR_NS::TfTokenVector purposes;
+
+        bool operator<(const CacheKey& other) const;
+    };
+
+    using CacheMap = std::map<CacheKey, std::unique_ptr<PXR_NS::UsdGeomBBoxCache>>;
+    using XformCacheMap
+        = std::map<PXR_NS::UsdTimeCode, std::unique_ptr<PXR_NS::UsdGeomXformCache>>;
+
+    // Caches of a stage. The UsdGeom caches are not thread safe, they are
+    // only used with the mutex of their stage entry locked.
+    struct StageEntry
+    {
+        std::mutex    mutex;
+        CacheMap      caches;
+        XformCacheMap xformCaches;
+    };
+
+    using StageEntryPtr = std::shared_ptr<StageEntry>;
+    using StageCacheMap = std::map<PXR_NS::UsdStagePtr, StageEntryPtr>;
+
+    // Find or create the entry of the stage. An entry discarded by a stage
+    // change stays valid for the computations already using it.
+    StageEntryPtr getStageEntry(const PXR_NS::UsdStagePtr& stage);
+
+    // Find or create the bbox cache for the time and purposes.
+    // Must be called with the mutex of the entry locked.
+    static PXR_NS::UsdGeomBBoxCache& getCache(
+        StageEntry&                  entry,
+        const PXR_NS::UsdTimeCode&   time,
+        const PXR_NS::TfTokenVector& purposes);
+
+    // Find or create the xform cache for the time.
+    // Must be called with the mutex of the entry locked.
+    static PXR_NS::UsdGeomXformCache&
+    getXformCache(StageEntry& entry, const PXR_NS::UsdTimeCode& time);
+
+    void onObjectsChanged(
+        const PXR_NS::UsdNotice::ObjectsChanged& notice,
+        const PXR_NS::UsdStageWeakPtr&           sender);
+
+    // Maximum number of caches kept per stage. During playback, every frame
+    // would otherwise add a new cache.
+    static constexpr size_t maxCachesPerStage = 8;
+
+    // Only protects the map of stage entries, not the computations.
+    std::mutex            _mutex;
+    StageCacheMap         _stageCaches;
+    PXR_NS::TfNotice::Key _objectsChangedKey;
+};
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_BBOXCACHESERVICE_H
@@ -19,15 +19,22 @@
 
 #include <pxr/base/tf/callContext.h>
 #include <pxr/base/tf/diagnosticLite.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/payloads.h>
 #include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/gprim.h>
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 #if PXR_VERSION < 2508
 #include <pxr/usd/usd/usdFileFormat.h>
 #else
@@ -48,6 +55,172 @@ UsdUfe::EditRouters& getRegisteredEditRouters()
     return registeredEditRouters;
 }
 
+// Cache of the layers computed by the batched edit routing functions.
+//
+// The results are kept per stage. Most routers route relative to the edit
+// target and can depend on anything else in the stage, for example layer
+// muting, so the results of a stage are discarded when its edit target
+// changes or when it sends an ObjectsChanged notice. Each discard starts a
+// new generation, results computed during an older generation are not kept.
+// The cache is shared between threads and guarded by a mutex, which is never
+// held while calling an edit router.
+class RoutingCache : public PXR_NS::TfWeakBase
+{
+public:
+    struct Key
+    {
+        PXR_NS::TfToken operation;
+        PXR_NS::SdfPath primPath;
+        PXR_NS::TfToken attrName;
+
+        bool operator==(const Key& other) const
+        {
+            return operation == other.operation && primPath == other.primPath
+                && attrName == other.attrName;
+        }
+    };
+
+    static RoutingCache& instance()
+    {
+        static RoutingCache routingCache;
+        return routingCache;
+    }
+
+    // Look up a previously cached routing result. Returns false if there are none.
+    bool find(const PXR_NS::UsdStagePtr& stage, const Key& key, PXR_NS::SdfLayerHandle& layer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto stageIter = _stages.find(stage);
+        if (stageIter == _stages.end())
+            return false;
+
+        const auto& layers = stageIter->second.layers;
+        const auto  layerIter = layers.find(key);
+        if (layerIter == layers.end())
+            return false;
+
+        layer = layerIter->second;
+        return true;
+    }
+
+    // Retrieve the current generation of the results of the stage.
+    size_t generation(const PXR_NS::UsdStagePtr& stage)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stages[stage].generation;
+    }
+
+    // Keep a routing result, unless the results of the stage were discarded
+    // since the given generation.
+    void insert(
+        const PXR_NS::UsdStagePtr&    stage,
+        size_t                        generation,
+        const Key&                    key,
+        const PXR_NS::SdfLayerHandle& layer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        StageEntry& entry = _stages[stage];
+        if (entry.generation == generation)
+            entry.layers[key] = layer;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& stageEntry : _stages)
+            discard(stageEntry.second);
+    }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = key.primPath.GetHash();
+            hash ^= key.operation.Hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= key.attrName.Hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct StageEntry
+    {
+        size_t                                                   generation = 0;
+        std::unordered_map<Key, PXR_NS::SdfLayerHandle, KeyHash> layers;
+    };
+
+    RoutingCache()
+    {
+        auto me = PXR_NS::TfCreateWeakPtr(this);
+        _objectsChangedKey = PXR_NS::TfNotice::Register(me, &RoutingCache::onObjectsChanged);
+        _editTargetChangedKey = PXR_NS::TfNotice::Register(me, &RoutingCache::onEditTargetChanged);
+    }
+
+    ~RoutingCache()
+    {
+        PXR_NS::TfNotice::Revoke(_objectsChangedKey);
+        PXR_NS::TfNotice::Revoke(_editTargetChangedKey);
+    }
+
+    static void discard(StageEntry& entry)
+    {
+        entry.layers.clear();
+        ++entry.generation;
+    }
+
+    void discardStage(const PXR_NS::UsdStageWeakPtr& sender)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Take the opportunity to drop the results of expired stages.
+        for (auto iter = _stages.begin(); iter != _stages.end();) {
+            if (iter->first.IsExpired())
+                iter = _stages.erase(iter);
+            else
+                ++iter;
+        }
+
+        const auto stageIter = _stages.find(sender);
+        if (stageIter != _stages.end())
+            discard(stageIter->second);
+    }
+
+    void onObjectsChanged(
+        const PXR_NS::UsdNotice::ObjectsChanged&,
+        const PXR_NS::UsdStageWeakPtr& sender)
+    {
+        discardStage(sender);
+    }
+
+    void onEditTargetChanged(
+        const PXR_NS::UsdNotice::StageEditTargetChanged&,
+        const PXR_NS::UsdStageWeakPtr& sender)
+    {
+        discardStage(sender);
+    }
+
+    std::mutex                                _mutex;
+    std::map<PXR_NS::UsdStagePtr, StageEntry> _stages;
+    PXR_NS::TfNotice::Key                     _objectsChangedKey;
+    PXR_NS::TfNotice::Key                     _editTargetChangedKey;
+};
+
+// Look up a previously cached routing result. Returns false if there are none.
+bool findCachedLayer(
+    const PXR_NS::TfToken&  operation,
+    const PXR_NS::UsdPrim&  prim,
+    const PXR_NS::TfToken&  attrName,
+    PXR_NS::SdfLayerHandle& layer)
+{
+    if (!prim)
+        return false;
+
+    return RoutingCache::instance().find(
+        prim.GetStage(), { operation, prim.GetPath(), attrName }, layer);
+}
+
 void editTargetLayer(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
 {
     // We expect a prim in the context.
@@ -70,6 +243,15 @@ namespace USDUFE_NS_DEF {
 
 EditRouter::~EditRouter() { }
 
+void EditRouter::routeBatch(
+    const std::vector<PXR_NS::VtDictionary>& contexts,
+    std::vector<PXR_NS::VtDictionary>&       routingData)
+{
+    routingData.resize(contexts.size());
+    for (size_t i = 0; i < contexts.size(); ++i)
+        (*this)(contexts[i], routingData[i]);
+}
+
 CxxEditRouter::~CxxEditRouter() { }
 
 void CxxEditRouter::operator()(
@@ -149,6 +331,7 @@ EditRouters defaultEditRouters()
 void registerEditRouter(const PXR_NS::TfToken& operation, const EditRouter::Ptr& editRouter)
 {
     getRegisteredEditRouters()[operation] = editRouter;
+    clearEditRouterCache();
 }
 
 void registerStageLayerEditRouter(
@@ -168,6 +351,7 @@ void registerStageLayerEditRouter(
     }
 
     layerRouter->setLayerForStage(stage, layer);
+    clearEditRouterCache();
 }
 
 bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
@@ -191,10 +375,17 @@ bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
         return false;
 
     editRouters.erase(pos);
+    clearEditRouterCache();
     return true;
 }
 
-void clearAllEditRouters() { getRegisteredEditRouters().clear(); }
+void clearAllEditRouters()
+{
+    getRegisteredEditRouters().clear();
+    clearEditRouterCache();
+}
+
+void clearEditRouterCache() { RoutingCache::instance().clear(); }
 
 void restoreAllDefaultEditRouters()
 {
@@ -237,6 +428,11 @@ getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim
     if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter))
         return layerRouter->getLayerForStage(prim.GetStage());
 
+    // Use the result of a previous batched routing, if any.
+    PXR_NS::SdfLayerHandle cachedLayer;
+    if (findCachedLayer(operation, prim, PXR_NS::TfToken(), cachedLayer))
+        return cachedLayer;
+
     PXR_NS::VtDictionary context;
     PXR_NS::VtDictionary routingData;
     context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
@@ -265,6 +461,11 @@ getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrN
     if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter))
         return layerRouter->getLayerForStage(prim.GetStage());
 
+    // Use the result of a previous batched routing, if any.
+    PXR_NS::SdfLayerHandle cachedLayer;
+    if (findCachedLayer(attrOp, prim, attrName, cachedLayer))
+        return cachedLayer;
+
     PXR_NS::VtDictionary context;
     PXR_NS::VtDictionary routingData;
     context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
@@ -280,6 +481,98 @@ getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrN
     return _extractLayer(found->second);
 }
 
+namespace {
+
+std::vector<PXR_NS::SdfLayerHandle> routeRequests(
+    const PXR_NS::TfToken&    operation,
+    const EditRouterRequests& requests,
+    bool                      withAttrName)
+{
+    std::vector<PXR_NS::SdfLayerHandle> layers(requests.size());
+
+    const EditRouter::Ptr dstEditRouter = getEditRouter(operation);
+    if (!dstEditRouter)
+        return layers;
+
+    // Optimize the case where we have a per-stage layer routing.
+    if (auto layerRouter = std::dynamic_pointer_cast<LayerPerStageEditRouter>(dstEditRouter)) {
+        for (size_t i = 0; i < requests.size(); ++i)
+            if (requests[i].prim)
+                layers[i] = layerRouter->getLayerForStage(requests[i].prim.GetStage());
+        return layers;
+    }
+
+    // Gather the requests that are not already cached, so that the router
+    // only gets called for new ones. The generation of the results of each
+    // stage is taken before routing, so that results computed while the
+    // stage changed are not kept.
+    RoutingCache&                     routingCache = RoutingCache::instance();
+    std::vector<size_t>               pending;
+    std::vector<size_t>               generations;
+    std::vector<PXR_NS::VtDictionary> contexts;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const EditRouterRequest& request = requests[i];
+        if (!request.prim)
+            continue;
+
+        const PXR_NS::TfToken attrName = withAttrName ? request.attrName : PXR_NS::TfToken();
+        if (findCachedLayer(operation, request.prim, attrName, layers[i]))
+            continue;
+
+        PXR_NS::VtDictionary context;
+        context[EditRoutingTokens->Prim] = PXR_NS::VtValue(request.prim);
+        context[EditRoutingTokens->Operation] = operation;
+        if (withAttrName)
+            context[operation] = PXR_NS::VtValue(request.attrName);
+        contexts.push_back(std::move(context));
+        pending.push_back(i);
+        generations.push_back(routingCache.generation(request.prim.GetStage()));
+    }
+
+    if (contexts.empty())
+        return layers;
+
+    std::vector<PXR_NS::VtDictionary> routingData;
+    dstEditRouter->routeBatch(contexts, routingData);
+
+    for (size_t i = 0; i < pending.size() && i < routingData.size(); ++i) {
+        const EditRouterRequest& request = requests[pending[i]];
+
+        const auto found = routingData[i].find(EditRoutingTokens->Layer);
+        if (found != routingData[i].end())
+            layers[pending[i]] = _extractLayer(found->second);
+
+        const PXR_NS::TfToken attrName = withAttrName ? request.attrName : PXR_NS::TfToken();
+        routingCache.insert(
+            request.prim.GetStage(),
+            generations[i],
+            { operation, request.prim.GetPath(), attrName },
+            layers[pending[i]]);
+    }
+
+    return layers;
+}
+
+} // namespace
+
+std::vector<PXR_NS::SdfLayerHandle>
+getEditRouterLayers(const PXR_NS::TfToken& operation, const std::vector<PXR_NS::UsdPrim>& prims)
+{
+    EditRouterRequests requests;
+    requests.reserve(prims.size());
+    for (const PXR_NS::UsdPrim& prim : prims)
+        requests.push_back({ prim, PXR_NS::TfToken() });
+
+    return routeRequests(operation, requests, false);
+}
+
+std::vector<PXR_NS::SdfLayerHandle> getAttrEditRouterLayers(const EditRouterRequests& requests)
+{
+    static const PXR_NS::TfToken attrOp(EditRoutingTokens->RouteAttribute);
+
+    return routeRequests(attrOp, requests, true);
+}
+
 PXR_NS::SdfLayerHandle getPrimMetadataEditRouterLayer(
     const PXR_NS::UsdPrim& prim,
     const PXR_NS::TfToken& metadataName,
@@ -27,6 +27,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace USDUFE_NS_DEF {
 
@@ -44,6 +45,15 @@ public:
     // so that acceptable defaults can be left unchanged.
     virtual void operator()(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary& routingData)
         = 0;
+
+    // Compute the routing data for a batch of contexts in a single call.
+    // The routing data vector is resized to match the contexts.  The default
+    // implementation calls the single-context operator for each entry, routers
+    // that have a high per-call cost (for example Python callables) should
+    // override it to amortize that cost over the whole batch.
+    virtual void routeBatch(
+        const std::vector<PXR_NS::VtDictionary>& contexts,
+        std::vector<PXR_NS::VtDictionary>&       routingData);
 };
 
 // Wrap an argument edit router callback for storage in the edit router map.
@@ -92,6 +102,16 @@ private:
 using EditRouters
     = PXR_NS::TfHashMap<PXR_NS::TfToken, EditRouter::Ptr, PXR_NS::TfToken::HashFunctor>;
 
+// A single request in a batch of edit routing requests. The attribute name is
+// only used for the "attribute" operation.
+struct EditRouterRequest
+{
+    PXR_NS::UsdPrim prim;
+    PXR_NS::TfToken attrName;
+};
+
+using EditRouterRequests = std::vector<EditRouterRequest>;
+
 // Utility function that returns a layer for the argument operation.
 // If no edit router exists for that operation, a nullptr is returned.
 // The edit router is given the prim in the context with key "prim", and is
@@ -111,6 +131,32 @@ USDUFE_PUBLIC
 PXR_NS::SdfLayerHandle
 getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName);
 
+// Retrieve the layers for a batch of operations on prims. The edit router is
+// invoked once for the whole batch, with one context per request.  The results
+// are cached per stage, so that edit router contexts created afterward for the
+// same prims do not invoke the edit router again, until the edit target of the
+// stage changes or the stage is edited.  The returned vector is parallel to
+// the requests; entries are null when there is no edit router for the
+// operation or when the router did not give a layer.
+// Commands acting on many prims should route them all up front with this
+// function and apply the results with the OperationEditRouterContext and
+// AttributeEditRouterContext constructors taking a stage and a layer.
+USDUFE_PUBLIC
+std::vector<PXR_NS::SdfLayerHandle>
+getEditRouterLayers(const PXR_NS::TfToken& operation, const std::vector<PXR_NS::UsdPrim>& prims);
+
+// Retrieve the layers for a batch of attribute operations. See getEditRouterLayers().
+USDUFE_PUBLIC
+std::vector<PXR_NS::SdfLayerHandle> getAttrEditRouterLayers(const EditRouterRequests& requests);
+
+// Discard the cached routing results of the batched edit routing functions.
+// The cache is automatically discarded when edit routers are registered,
+// restored or cleared, and per stage when its edit target changes or when it
+// is edited. Callers that know the routing of a router changed for another
+// reason, for example a Python router depending on Python state, should call this.
+USDUFE_PUBLIC
+void clearEditRouterCache();
+
 // Retrieve the layer for the prim metadata operation. If no edit router for the
 // "primMetadata" operation is found, a nullptr is returned.
 USDUFE_PUBLIC
@@ -130,6 +130,12 @@ void initEventSystem()
 }
 \endcode
 
+The binding may optionally override compilePython / executeCompiledPython, so that python callbacks are only parsed
+the first time they are triggered, and releaseCompiledPython, to free the compiled code once the callback is
+unregistered. Overriding setScriptPayloads lets EventDispatcher::triggerEventBatch execute the script callbacks once
+for a whole batch of events. The Maya binding exposes the payloads of a batch to the scripts as the python list
+AL_eventPayloads, and the MEL global string array $AL_eventPayloads.
+
 \subsection globalEventsC Global Events in C++
 
 The following code sample provides a simple example of how the C++ api works in practice.
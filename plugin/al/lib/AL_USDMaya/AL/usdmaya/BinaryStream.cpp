@@ -0,0 +1,141 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usdmaya/BinaryStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace AL {
+namespace usdmaya {
+
+//----------------------------------------------------------------------------------------------------------------------
+void BinaryStreamWriter::writeUInt(uint64_t value)
+{
+    while (value >= 0x80) {
+        m_bytes.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    m_bytes.push_back(uint8_t(value));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void BinaryStreamWriter::writeString(const std::string& str)
+{
+    writeUInt(str.size());
+    m_bytes.insert(m_bytes.end(), str.begin(), str.end());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void BinaryStreamWriter::writePrefixedString(const std::string& str, const std::string& previous)
+{
+    const size_t maxShared = std::min(str.size(), previous.size());
+    size_t       shared = 0;
+    while (shared < maxShared && str[shared] == previous[shared]) {
+        ++shared;
+    }
+    writeUInt(shared);
+    writeUInt(str.size() - shared);
+    m_bytes.insert(m_bytes.end(), str.begin() + shared, str.end());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void BinaryStreamWriter::toIntArray(MIntArray& data) const
+{
+    const size_t numWords = (m_bytes.size() + sizeof(int) - 1) / sizeof(int);
+    data.setLength(uint32_t(numWords + 1));
+    data[0] = int(m_bytes.size());
+
+    std::vector<int> words(numWords, 0);
+    if (!m_bytes.empty()) {
+        std::memcpy(words.data(), m_bytes.data(), m_bytes.size());
+    }
+    for (size_t i = 0; i < numWords; ++i) {
+        data[uint32_t(i + 1)] = words[i];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+BinaryStreamReader::BinaryStreamReader(const MIntArray& data)
+{
+    if (data.length() == 0 || data[0] < 0) {
+        return;
+    }
+
+    const size_t numBytes = size_t(data[0]);
+    const size_t numWords = data.length() - 1;
+    if (numBytes > numWords * sizeof(int)) {
+        return;
+    }
+
+    std::vector<int> words(numWords);
+    for (size_t i = 0; i < numWords; ++i) {
+        words[i] = data[uint32_t(i + 1)];
+    }
+    m_bytes.resize(numBytes);
+    if (numBytes) {
+        std::memcpy(m_bytes.data(), words.data(), numBytes);
+    }
+    m_valid = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool BinaryStreamReader::readUInt(uint64_t& value)
+{
+    value = 0;
+    for (uint32_t shift = 0; m_valid && shift < 64; shift += 7) {
+        if (m_offset == m_bytes.size()) {
+            break;
+        }
+        const uint8_t byte = m_bytes[m_offset++];
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    m_valid = false;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool BinaryStreamReader::readString(std::string& str)
+{
+    uint64_t length;
+    if (!readUInt(length) || length > m_bytes.size() - m_offset) {
+        m_valid = false;
+        return false;
+    }
+    str.assign(reinterpret_cast<const char*>(m_bytes.data() + m_offset), size_t(length));
+    m_offset += size_t(length);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool BinaryStreamReader::readPrefixedString(std::string& str)
+{
+    uint64_t shared, length;
+    if (!readUInt(shared) || !readUInt(length) || shared > str.size()
+        || length > m_bytes.size() - m_offset) {
+        m_valid = false;
+        return false;
+    }
+    str.resize(size_t(shared));
+    str.append(reinterpret_cast<const char*>(m_bytes.data() + m_offset), size_t(length));
+    m_offset += size_t(length);
+    return true;
+}
+
+} // namespace usdmaya
+} // namespace AL
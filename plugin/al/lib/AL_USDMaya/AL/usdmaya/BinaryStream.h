@@ -0,0 +1,114 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+//----------------------------------------------------------------------------------------------------------------------
+/// \file   BinaryStream.h
+/// \brief  Compact binary encoding of the data the nodes store in the Maya file.
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "AL/usdmaya/Api.h"
+
+#include <maya/MIntArray.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace AL {
+namespace usdmaya {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Writes integers and strings into a byte stream that can be stored on an int array
+///         attribute, which Maya keeps as raw binary data in the scene file.
+///         Integers are written with a variable length, so that small values only take one byte.
+///         Sorted paths are written with prefix compression: only the number of leading characters
+///         shared with the previous path, and the remaining characters, are written.
+/// \ingroup usdmaya
+//----------------------------------------------------------------------------------------------------------------------
+class BinaryStreamWriter
+{
+public:
+    /// \brief  write an unsigned integer
+    /// \param  value the value to write
+    AL_USDMAYA_PUBLIC
+    void writeUInt(uint64_t value);
+
+    /// \brief  write a string
+    /// \param  str the string to write
+    AL_USDMAYA_PUBLIC
+    void writeString(const std::string& str);
+
+    /// \brief  write a string as the difference with the previous one
+    /// \param  str the string to write
+    /// \param  previous the string previously written with this method, empty for the first one
+    AL_USDMAYA_PUBLIC
+    void writePrefixedString(const std::string& str, const std::string& previous);
+
+    /// \brief  copy the stream into an int array, prefixed with the number of bytes written
+    /// \param  data the returned int array
+    AL_USDMAYA_PUBLIC
+    void toIntArray(MIntArray& data) const;
+
+    /// \brief  returns the number of bytes written
+    size_t size() const { return m_bytes.size(); }
+
+private:
+    std::vector<uint8_t> m_bytes;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Reads the data written by a BinaryStreamWriter.
+///         Every read method returns false once the end of the stream has been passed, or the data
+///         is malformed, so that a corrupted attribute can not crash the loading of a scene.
+/// \ingroup usdmaya
+//----------------------------------------------------------------------------------------------------------------------
+class BinaryStreamReader
+{
+public:
+    /// \brief  ctor
+    /// \param  data the int array filled by BinaryStreamWriter::toIntArray
+    AL_USDMAYA_PUBLIC
+    explicit BinaryStreamReader(const MIntArray& data);
+
+    /// \brief  read an unsigned integer
+    /// \param  value the returned value
+    /// \return false if the stream is invalid
+    AL_USDMAYA_PUBLIC
+    bool readUInt(uint64_t& value);
+
+    /// \brief  read a string
+    /// \param  str the returned string
+    /// \return false if the stream is invalid
+    AL_USDMAYA_PUBLIC
+    bool readString(std::string& str);
+
+    /// \brief  read a string written with BinaryStreamWriter::writePrefixedString
+    /// \param  str holds the previous string read with this method, and is replaced with the new one
+    /// \return false if the stream is invalid
+    AL_USDMAYA_PUBLIC
+    bool readPrefixedString(std::string& str);
+
+    /// \brief  returns true if the stream holds data, and no read has failed so far
+    bool isValid() const { return m_valid; }
+
+private:
+    std::vector<uint8_t> m_bytes;
+    size_t               m_offset = 0;
+    bool                 m_valid = false;
+};
+
+} // namespace usdmaya
+} // namespace AL
@@ -462,6 +462,7 @@ void Global::onPluginLoad()
         = manager.registerCallback(preFileExport, "BeforeExport", "usdmaya_preFileExport", 0x1000);
     m_postExport
         = manager.registerCallback(postFileExport, "AfterExport", "usdmaya_postFileExport", 0x1000);
+    fileio::translators::TranslatorContext::registerNodeNameCallbacks();
 
     TF_DEBUG(ALUSDMAYA_EVENTS).Msg("Registering USD plugins\n");
     // Let USD know about the additional plugins
@@ -495,6 +496,7 @@ void Global::onPluginUnload()
     manager.unregisterCallback(m_postRead);
     manager.unregisterCallback(m_preExport);
     manager.unregisterCallback(m_postExport);
+    fileio::translators::TranslatorContext::removeNodeNameCallbacks();
     StageCache::removeCallbacks();
 
     AL::maya::event::MayaEventManager::freeInstance();
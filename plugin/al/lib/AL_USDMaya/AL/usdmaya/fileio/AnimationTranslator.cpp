@@ -18,16 +18,172 @@
 
 #include "AL/usdmaya/fileio/translators/DgNodeTranslator.h"
 #include "AL/usdmaya/fileio/translators/TransformTranslator.h"
+#include "AL/usdmaya/utils/AttributeType.h"
 #include "AL/usdmaya/utils/MeshUtils.h"
 
+#include <pxr/usd/sdf/changeBlock.h>
+
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
 
+#include <tbb/task_group.h>
+
+#include <functional>
+#include <vector>
+
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue getClippingRange(const MPlug& nearPlug, const MPlug& farPlug)
+{
+    MDistance nearDistance;
+    MDistance farDistance;
+    if (nearPlug.getValue(nearDistance) != MStatus::kSuccess
+        || farPlug.getValue(farDistance) != MStatus::kSuccess) {
+        return VtValue();
+    }
+    return VtValue(GfVec2f(
+        static_cast<float>(nearDistance.as(MDistance::kCentimeters)),
+        static_cast<float>(farDistance.as(MDistance::kCentimeters))));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue getMeshPoints(const MDagPath& path)
+{
+    MStatus      status;
+    MFnMesh      fnMesh(path, &status);
+    const float* pointsData = status ? fnMesh.getRawPoints(&status) : nullptr;
+    if (!status) {
+        MGlobal::displayError(
+            MString("Unable to access mesh vertices on mesh: ") + path.fullPathName());
+        return VtValue();
+    }
+    const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
+    return VtValue(VtArray<GfVec3f>(vecData, vecData + fnMesh.numVertices()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue getWorldSpaceMatrix(const MDagPath& path)
+{
+    const MMatrix mat = path.inclusiveMatrix();
+    return VtValue(GfMatrix4d(mat.matrix));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// A component of a plug whose value is computed from an anim curve, or is constant when no curve
+// is given.
+struct CurveComponent
+{
+    MObject curve;
+    double  value;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+bool getCurveComponent(const MPlug& plug, CurveComponent& component)
+{
+    if (plug.isArray() || plug.isCompound()) {
+        return false;
+    }
+    if (!plug.isDestination()) {
+        component = CurveComponent { MObject::kNullObj, plug.asDouble() };
+        return true;
+    }
+    component = CurveComponent {
+        AL::usdmaya::utils::AnimationTranslator::getDrivingAnimCurve(plug), 0.0
+    };
+    return !component.curve.isNull();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Returns true if the value of the plug only depends on the anim curves keyframing it, or its
+// children, against time.
+bool getCurveComponents(const MPlug& plug, std::vector<CurveComponent>& components)
+{
+    if (plug.isArray()) {
+        return false;
+    }
+    if (!plug.isCompound()) {
+        components.resize(1);
+        return getCurveComponent(plug, components[0]);
+    }
+    if (plug.isDestination()) {
+        return false;
+    }
+    components.resize(plug.numChildren());
+    for (uint32_t i = 0, n = plug.numChildren(); i < n; ++i) {
+        if (!getCurveComponent(plug.child(i), components[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Evaluates the components at all of the sample times, and converts them to the USD type.
+// Returns false if the USD type is not handled here.
+bool evaluateCurveComponents(
+    const std::vector<CurveComponent>& components,
+    AL::usdmaya::utils::UsdDataType    type,
+    double                             scale,
+    const std::vector<double>&         times,
+    std::vector<VtValue>&              samples)
+{
+    using AL::usdmaya::utils::UsdDataType;
+
+    size_t numComponents = 0;
+    switch (type) {
+    case UsdDataType::kFloat:
+    case UsdDataType::kDouble: numComponents = 1; break;
+    case UsdDataType::kVec3f:
+    case UsdDataType::kVec3d: numComponents = 3; break;
+    default: return false;
+    }
+    if (components.size() != numComponents) {
+        return false;
+    }
+
+    const size_t        numSamples = times.size();
+    std::vector<double> values(numSamples * numComponents);
+    for (size_t c = 0; c < numComponents; ++c) {
+        if (components[c].curve.isNull()) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                values[i * numComponents + c] = components[c].value * scale;
+            }
+            continue;
+        }
+        MFnAnimCurve curve(components[c].curve);
+        for (size_t i = 0; i < numSamples; ++i) {
+            double value = 0.0;
+            curve.evaluate(MTime(times[i]), value);
+            values[i * numComponents + c] = value * scale;
+        }
+    }
+
+    samples.resize(numSamples);
+    const double* v = values.data();
+    for (size_t i = 0; i < numSamples; ++i, v += numComponents) {
+        switch (type) {
+        case UsdDataType::kFloat: samples[i] = VtValue(float(v[0])); break;
+        case UsdDataType::kDouble: samples[i] = VtValue(v[0]); break;
+        case UsdDataType::kVec3f:
+            samples[i] = VtValue(GfVec3f(float(v[0]), float(v[1]), float(v[2])));
+            break;
+        case UsdDataType::kVec3d: samples[i] = VtValue(GfVec3d(v[0], v[1], v[2])); break;
+        default: break;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
@@ -35,89 +191,167 @@ namespace fileio {
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
-    auto const startAttrib = m_animatedPlugs.begin();
-    auto const endAttrib = m_animatedPlugs.end();
-    auto const startAttribScaled = m_scaledAnimatedPlugs.begin();
-    auto const endAttribScaled = m_scaledAnimatedPlugs.end();
-    auto const startTransformAttrib = m_animatedTransformPlugs.begin();
-    auto const endTransformAttrib = m_animatedTransformPlugs.end();
-    auto const startMultiAttrib = m_animatedMultiPlugs.begin();
-    auto const endMultiAttrib = m_animatedMultiPlugs.end();
-    auto const startMesh = m_animatedMeshes.begin();
-    auto const endMesh = m_animatedMeshes.end();
-    auto const startWSM = m_worldSpaceOutputs.begin();
-    auto const endWSM = m_worldSpaceOutputs.end();
-
-    if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
-        || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
-        || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
-        double increment = 1.0 / std::max(1U, params.m_subSamples);
-        for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
-            MAnimControl::setCurrentTime(t);
-            UsdTimeCode timeCode(t);
-            for (auto it = startAttrib; it != endAttrib; ++it) {
-                /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
-                ///         maya::Dg
-                ///         usdmaya::Dg
-                ///         usdmaya::fileio::translator::Dg
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode, params.m_mergeOffsetParentMatrix);
-            }
-            for (auto it = startAttribScaled; it != endAttribScaled; ++it) {
-                /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
-                ///         maya::Dg
-                ///         usdmaya::Dg
-                ///         usdmaya::fileio::translator::Dg
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first,
-                    it->second.attr,
-                    it->second.scale,
-                    timeCode,
-                    params.m_mergeOffsetParentMatrix);
-            }
-            for (auto it = startTransformAttrib; it != endTransformAttrib; ++it) {
-                translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode);
-            }
-            for (auto it = startMultiAttrib; it != endMultiAttrib; ++it) {
-                // Note: so far there is only one attribute need to be treated specially
-                //       we do this special handling for this particular attribute atm,
-                //       will see if we need to generalize once have more requests
-                if (it->first.GetName() == UsdGeomTokens->clippingRange && it->second.size() == 2) {
-                    const auto& plugs(it->second);
-                    MDistance   nearDistance;
-                    MDistance   farDistance;
-                    if (plugs[0].getValue(nearDistance) == MStatus::kSuccess
-                        && plugs[1].getValue(farDistance) == MStatus::kSuccess) {
-                        GfVec2f clippingRange {
-                            static_cast<float>(nearDistance.as(MDistance::kCentimeters)),
-                            static_cast<float>(farDistance.as(MDistance::kCentimeters))
-                        };
-                        it->first.Set(clippingRange, timeCode);
-                    }
-                }
-            }
-            for (auto it = startMesh; it != endMesh; ++it) {
-                UsdGeomMesh                           mesh(it->second.GetPrim());
-                AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
-                context.copyVertexData(timeCode);
-            }
-            for (auto nodeAnim : m_animatedNodes) {
-                nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
+    std::vector<double> times;
+    double              increment = 1.0 / std::max(1U, params.m_subSamples);
+    for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
+        times.push_back(t);
+    }
+
+    // Plugs that are only keyframed against time are computed by evaluating their anim curves at
+    // all of the sample times, rather than by evaluating the DG at each frame. When the offset
+    // parent matrix is merged, the values of transform attributes also depend on that matrix, so
+    // those are left to the DG.
+    struct CurveChannel
+    {
+        UsdAttribute         attribute;
+        std::vector<VtValue> samples;
+    };
+    std::vector<CurveChannel>   curveChannels;
+    std::vector<CurveComponent> components;
+
+    const bool mergeOffsetMatrix = params.m_mergeOffsetParentMatrix;
+    auto       addCurveChannel = [&](const MPlug& plug, const UsdAttribute& attribute, float scale) {
+        if (mergeOffsetMatrix && plug.node().hasFn(MFn::kTransform)) {
+            return false;
+        }
+        if (!getCurveComponents(plug, components)) {
+            return false;
+        }
+        CurveChannel channel { attribute, {} };
+        if (!evaluateCurveComponents(
+                components,
+                usdmaya::utils::getAttributeType(attribute.GetTypeName()),
+                scale,
+                times,
+                channel.samples)) {
+            return false;
+        }
+        curveChannels.push_back(std::move(channel));
+        return true;
+    };
+
+    // The other animated attributes are split into the sampling of maya, which has to happen on the
+    // main thread, and the authoring of the samples into USD. Each channel samples its maya data
+    // into a VtValue that is ready to be set on the USD attribute.
+    struct AnimatedChannel
+    {
+        UsdAttribute             attribute;
+        std::function<VtValue()> sample;
+    };
+    std::vector<AnimatedChannel> channels;
+
+    for (const auto& it : m_animatedPlugs) {
+        if (addCurveChannel(it.first, it.second, 1.0f)) {
+            continue;
+        }
+        /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
+        ///         maya::Dg
+        ///         usdmaya::Dg
+        ///         usdmaya::fileio::translator::Dg
+        const MPlug            plug = it.first;
+        const SdfValueTypeName typeName = it.second.GetTypeName();
+        channels.push_back({ it.second, [plug, typeName, mergeOffsetMatrix]() {
+                                return translators::TransformTranslator::getAttributeValue(
+                                    plug, typeName, mergeOffsetMatrix);
+                            } });
+    }
+    for (const auto& it : m_scaledAnimatedPlugs) {
+        if (addCurveChannel(it.first, it.second.attr, it.second.scale)) {
+            continue;
+        }
+        const MPlug            plug = it.first;
+        const SdfValueTypeName typeName = it.second.attr.GetTypeName();
+        const float            scale = it.second.scale;
+        channels.push_back({ it.second.attr, [plug, typeName, scale, mergeOffsetMatrix]() {
+                                return translators::TransformTranslator::getAttributeValue(
+                                    plug, typeName, scale, mergeOffsetMatrix);
+                            } });
+    }
+    for (const auto& it : m_animatedTransformPlugs) {
+        // visibility is the only transform attribute that is exported here
+        if (it.second.GetName() == UsdGeomTokens->visibility) {
+            const MPlug plug = it.first;
+            channels.push_back({ it.second, [plug]() {
+                                    return translators::TransformTranslator::getVisibilityValue(
+                                        plug);
+                                } });
+        }
+    }
+    for (const auto& it : m_animatedMultiPlugs) {
+        // Note: so far there is only one attribute need to be treated specially
+        //       we do this special handling for this particular attribute atm,
+        //       will see if we need to generalize once have more requests
+        if (it.first.GetName() == UsdGeomTokens->clippingRange && it.second.size() == 2) {
+            const MPlug nearPlug = it.second[0];
+            const MPlug farPlug = it.second[1];
+            channels.push_back(
+                { it.first, [nearPlug, farPlug]() { return getClippingRange(nearPlug, farPlug); } });
+        }
+    }
+    for (const auto& it : m_animatedMeshes) {
+        UsdAttribute pointsAttr = UsdGeomMesh(it.second.GetPrim()).GetPointsAttr();
+        if (!pointsAttr) {
+            continue;
+        }
+        const MDagPath path = it.first;
+        channels.push_back({ pointsAttr, [path]() { return getMeshPoints(path); } });
+    }
+    for (const auto& it : m_worldSpaceOutputs) {
+        const MDagPath path = it.first;
+        channels.push_back({ it.second, [path]() { return getWorldSpaceMatrix(path); } });
+    }
+
+    if (channels.empty() && m_animatedNodes.empty()) {
+        // nothing needs the DG to be evaluated, so the current time is left untouched
+        SdfChangeBlock changeBlock;
+        for (size_t i = 0, n = times.size(); i < n; ++i) {
+            const UsdTimeCode timeCode(times[i]);
+            for (const CurveChannel& channel : curveChannels) {
+                channel.attribute.Set(channel.samples[i], timeCode);
             }
-            for (auto it = startWSM; it != endWSM; ++it) {
-                MMatrix mat = it->first.inclusiveMatrix();
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif
-                it->second.Set(*(const GfMatrix4d*)&mat, timeCode);
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
+        }
+        return;
+    }
+
+    // While maya evaluates and samples a frame, the samples of the previous frame are written into
+    // USD by a single background task, as a layer may only be edited by one thread at a time.
+    std::vector<VtValue> samples(channels.size());
+    std::vector<VtValue> authoredSamples(channels.size());
+    size_t               authoredIndex = 0;
+    tbb::task_group      authoring;
+    const auto           authorSamples = [&]() {
+        SdfChangeBlock    changeBlock;
+        const UsdTimeCode timeCode(times[authoredIndex]);
+        for (size_t i = 0, n = channels.size(); i < n; ++i) {
+            if (!authoredSamples[i].IsEmpty()) {
+                channels[i].attribute.Set(authoredSamples[i], timeCode);
             }
         }
+        for (const CurveChannel& channel : curveChannels) {
+            channel.attribute.Set(channel.samples[authoredIndex], timeCode);
+        }
+    };
+
+    for (size_t index = 0, numTimes = times.size(); index < numTimes; ++index) {
+        MAnimControl::setCurrentTime(times[index]);
+        UsdTimeCode timeCode(times[index]);
+        for (size_t i = 0, n = channels.size(); i < n; ++i) {
+            samples[i] = channels[i].sample();
+        }
+
+        authoring.wait();
+
+        // the custom translators read from maya and write into USD, so they are run here, once the
+        // previous frame has been authored.
+        for (auto nodeAnim : m_animatedNodes) {
+            nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
+        }
+
+        samples.swap(authoredSamples);
+        authoredIndex = index;
+        authoring.run(authorSamples);
     }
+    authoring.wait();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -43,7 +43,11 @@ class AnimationTranslator : public usdmaya::utils::AnimationTranslator
 {
 public:
     /// \brief  After the scene has been exported, call this method to export the animation data on
-    /// various attributes \param  params the export options
+    ///         various attributes. Plugs that are only keyframed against time are sampled by
+    ///         evaluating their anim curves. The other attributes are sampled by stepping through
+    ///         the frames on the calling thread, while the samples of the previous frame are
+    ///         written into USD in the background.
+    /// \param  params the export options
     AL_USDMAYA_PUBLIC
     void exportAnimation(const ExporterParams& params);
 
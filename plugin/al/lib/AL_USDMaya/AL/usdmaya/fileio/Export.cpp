@@ -26,10 +26,16 @@
 #include "AL/usdmaya/utils/MeshUtils.h"
 #include "AL/usdmaya/utils/Utils.h"
 
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/nurbsCurves.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/xformOp.h>
 
 #include <maya/MAnimControl.h>
 #include <maya/MArgDatabase.h>
@@ -40,6 +46,12 @@
 #include <maya/MPlugArray.h>
 #include <maya/MSyntax.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <unordered_map>
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
@@ -120,6 +132,84 @@ static inline SdfPath makeMasterPath(UsdPrim instancesPrim, const MDagPath& dagP
     return SdfPath(usdPath);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// the attributes of a mesh prim that describe its geometry, i.e. everything except its transform
+/// and visibility, sorted by name.
+static std::vector<SdfAttributeSpecHandle> getGeometryAttributes(const SdfPrimSpecHandle& primSpec)
+{
+    std::vector<SdfAttributeSpecHandle> attributes;
+    for (const SdfAttributeSpecHandle& attribute : primSpec->GetAttributes()) {
+        const TfToken& name = attribute->GetNameToken();
+        if (name != UsdGeomTokens->xformOpOrder && name != UsdGeomTokens->visibility
+            && !UsdGeomXformOp::IsXformOp(name)) {
+            attributes.push_back(attribute);
+        }
+    }
+    std::sort(
+        attributes.begin(),
+        attributes.end(),
+        [](const SdfAttributeSpecHandle& a, const SdfAttributeSpecHandle& b) {
+            return a->GetNameToken() < b->GetNameToken();
+        });
+    return attributes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static inline void hashCombine(size_t& hash, size_t value)
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// hashes the names, types, default values and time samples of the attributes
+static size_t
+hashAttributes(const SdfLayerHandle& layer, const std::vector<SdfAttributeSpecHandle>& attributes)
+{
+    size_t hash = attributes.size();
+    for (const SdfAttributeSpecHandle& attribute : attributes) {
+        hashCombine(hash, attribute->GetNameToken().Hash());
+        hashCombine(hash, attribute->GetTypeName().GetHash());
+        if (attribute->HasDefaultValue()) {
+            hashCombine(hash, attribute->GetDefaultValue().GetHash());
+        }
+        const SdfPath& path = attribute->GetPath();
+        for (const double time : layer->ListTimeSamplesForPath(path)) {
+            VtValue value;
+            layer->QueryTimeSample(path, time, &value);
+            hashCombine(hash, std::hash<double>()(time));
+            hashCombine(hash, value.GetHash());
+        }
+    }
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// returns true if all of the fields authored on the attributes (values, time samples,
+/// interpolation, ...) are identical
+static bool equalAttributes(
+    const std::vector<SdfAttributeSpecHandle>& a,
+    const std::vector<SdfAttributeSpecHandle>& b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0, n = a.size(); i < n; ++i) {
+        if (a[i]->GetNameToken() != b[i]->GetNameToken()) {
+            return false;
+        }
+        const std::vector<TfToken> fields = a[i]->ListFields();
+        if (fields != b[i]->ListFields()) {
+            return false;
+        }
+        for (const TfToken& field : fields) {
+            if (a[i]->GetField(field) != b[i]->GetField(field)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Internal USD exporter implementation
 //----------------------------------------------------------------------------------------------------------------------
@@ -253,13 +343,101 @@ struct Export::Impl
         }
     }
 
-    void
-    doExport(const char* const filename, bool toFilter = false, SdfPath defaultPrim = SdfPath())
+    void deduplicateMeshes()
     {
-        setDefaultPrimIfOnlyOneRoot(defaultPrim);
-        if (toFilter) {
-            filterSample();
+        struct MeshSpec
+        {
+            SdfPrimSpecHandle                   primSpec;
+            std::vector<SdfAttributeSpecHandle> attributes;
+            size_t                              hash;
+        };
+
+        // Meshes that reference a prototype (instanced shapes) are left as they are.
+        SdfLayerHandle        layer = m_stage->GetRootLayer();
+        std::vector<MeshSpec> meshes;
+        for (const UsdPrim& prim : m_stage->Traverse()) {
+            if (!prim.IsA<UsdGeomMesh>() || prim.HasAuthoredReferences()) {
+                continue;
+            }
+            SdfPrimSpecHandle primSpec = layer->GetPrimAtPath(prim.GetPath());
+            if (!primSpec) {
+                continue;
+            }
+            MeshSpec mesh { primSpec, getGeometryAttributes(primSpec), 0 };
+            if (!mesh.attributes.empty()) {
+                meshes.push_back(std::move(mesh));
+            }
+        }
+
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, meshes.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    meshes[i].hash = hashAttributes(layer, meshes[i].attributes);
+                }
+            });
+
+        // group the meshes with identical geometry, in the order they were exported
+        std::vector<std::vector<size_t>>                 groups;
+        std::unordered_map<size_t, std::vector<size_t>> groupsByHash;
+        for (size_t i = 0, n = meshes.size(); i < n; ++i) {
+            std::vector<size_t>& candidates = groupsByHash[meshes[i].hash];
+            auto it = std::find_if(candidates.begin(), candidates.end(), [&](size_t group) {
+                return equalAttributes(meshes[groups[group][0]].attributes, meshes[i].attributes);
+            });
+            if (it != candidates.end()) {
+                groups[*it].push_back(i);
+            } else {
+                candidates.push_back(groups.size());
+                groups.push_back({ i });
+            }
+        }
+
+        if (!m_instancesPrim) {
+            createInstancesPrim();
+        }
+        const SdfPath instancesPath = m_instancesPrim.GetPath();
+
+        // The geometry of each group is moved onto a prototype, which the meshes then reference.
+        // The transform and visibility of each mesh stay where they are.
+        SdfChangeBlock changeBlock;
+        for (const std::vector<size_t>& group : groups) {
+            if (group.size() < 2) {
+                continue;
+            }
+            const MeshSpec&   source = meshes[group[0]];
+            const std::string name
+                = TfMakeValidIdentifier(source.primSpec->GetPath().GetString().substr(1));
+            SdfPath prototypePath = instancesPath.AppendChild(TfToken(name));
+            for (int suffix = 1; layer->GetPrimAtPath(prototypePath); ++suffix) {
+                prototypePath = instancesPath.AppendChild(
+                    TfToken(TfStringPrintf("%s_%d", name.c_str(), suffix)));
+            }
+
+            SdfPrimSpecHandle prototype = SdfCreatePrimInLayer(layer, prototypePath);
+            prototype->SetSpecifier(SdfSpecifierDef);
+            prototype->SetTypeName(source.primSpec->GetTypeName().GetString());
+            for (const SdfAttributeSpecHandle& attribute : source.attributes) {
+                SdfCopySpec(
+                    layer,
+                    attribute->GetPath(),
+                    layer,
+                    prototypePath.AppendProperty(attribute->GetNameToken()));
+            }
+
+            for (const size_t index : group) {
+                const MeshSpec& mesh = meshes[index];
+                for (const SdfAttributeSpecHandle& attribute : mesh.attributes) {
+                    mesh.primSpec->RemoveProperty(attribute);
+                }
+                mesh.primSpec->GetReferenceList().Prepend(SdfReference("", prototypePath));
+            }
         }
+    }
+
+    void doExport(const char* const filename, SdfPath defaultPrim = SdfPath())
+    {
+        setDefaultPrimIfOnlyOneRoot(defaultPrim);
         m_stage->GetRootLayer()->Save();
         m_nodeMap.clear();
     }
@@ -1023,8 +1201,16 @@ void Export::doExport()
         MAnimControl::setCurrentTime(oldCurTime);
     }
 
+    // duplicate meshes are found after the samples have been filtered, so that they are compared
+    // on the data that will be saved.
+    if (m_params.m_filterSample) {
+        m_impl->filterSample();
+    }
+    if (m_params.m_deduplicateMeshes) {
+        m_impl->deduplicateMeshes();
+    }
     m_impl->processInstances();
-    m_impl->doExport(m_params.m_fileName.asChar(), m_params.m_filterSample, defaultPrim);
+    m_impl->doExport(m_params.m_fileName.asChar(), defaultPrim);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1138,6 +1324,11 @@ MStatus ExportCommand::doIt(const MArgList& args)
             argData.getFlagArgument("fs", 0, m_params.m_filterSample),
             "ALUSDExport: Unable to fetch \"filter sample\" argument");
     }
+    if (argData.isFlagSet("dm", &status)) {
+        AL_MAYA_CHECK_ERROR(
+            argData.getFlagArgument("dm", 0, m_params.m_deduplicateMeshes),
+            "ALUSDExport: Unable to fetch \"deduplicate meshes\" argument");
+    }
     if (argData.isFlagSet("eac", &status)) {
         AL_MAYA_CHECK_ERROR(
             argData.getFlagArgument("eac", 0, m_params.m_extensiveAnimationCheck),
@@ -1273,6 +1464,8 @@ MSyntax ExportCommand::createSyntax()
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-fs", "-filterSample", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
+    status = syntax.addFlag("-dm", "-deduplicateMeshes", MSyntax::kBoolean);
+    AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-eac", "-extensiveAnimationCheck", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ss", "-subSamples", MSyntax::kUnsigned);
@@ -1318,6 +1511,9 @@ ExportCommand Overview:
 
   The exporter can remove samples that contain the same data for adjacent samples
     1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -fs
+
+  Meshes with identical geometry can be written once, and referenced by each of the duplicates
+    1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -dm 1
 )";
 
 //----------------------------------------------------------------------------------------------------------------------
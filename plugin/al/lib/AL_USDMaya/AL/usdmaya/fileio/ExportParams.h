@@ -60,6 +60,8 @@ struct ExporterParams
     bool m_animation = false;        ///< if true, animation will be exported.
     bool m_useTimelineRange = false; ///< if true, then the export uses Maya's timeline range.
     bool m_filterSample = false; ///< if true, duplicate sample of attribute will be filtered out
+    bool m_deduplicateMeshes = false; ///< if true, meshes with identical geometry will be written
+                                      ///< once, and referenced by each of the duplicates
     bool m_exportInWorldSpace = false; ///< if true, transform will be baked at the root prim,
                                        ///< children under the root will be untouched.
     AnimationTranslator* m_animTranslator
@@ -71,6 +71,8 @@ static constexpr const char* const kSubSamples
     = "Sub Samples"; ///< specify the number of sub samples to export
 static constexpr const char* const kFilterSample
     = "Filter Sample"; ///< export filter sample option name
+static constexpr const char* const kDeduplicateMeshes
+    = "Deduplicate Meshes"; ///< export identical meshes once option name
 static constexpr const char* const kExportAtWhichTime
     = "Export At Which Time"; ///< which time code should be used for default values?
 static constexpr const char* const kExportInWorldSpace
@@ -119,6 +121,8 @@ static MStatus specifyOptions(AL::maya::utils::FileTranslatorOptions& options)
         return MS::kFailure;
     if (!options.addBool(kFilterSample, defaultValues.m_filterSample))
         return MS::kFailure;
+    if (!options.addBool(kDeduplicateMeshes, defaultValues.m_deduplicateMeshes))
+        return MS::kFailure;
     if (!options.addEnum(kExportAtWhichTime, timelineLevel, defaultValues.m_exportAtWhichTime))
         return MS::kFailure;
     if (!options.addBool(kExportInWorldSpace, defaultValues.m_exportInWorldSpace))
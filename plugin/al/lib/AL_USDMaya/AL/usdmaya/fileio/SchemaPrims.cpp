@@ -15,10 +15,54 @@
 //
 #include "AL/usdmaya/fileio/SchemaPrims.h"
 
+#include "AL/usdmaya/Metadata.h"
+
 #include <pxr/usd/usd/schemaBase.h>
 
 #include <maya/MFnDagNode.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+using AL::usdmaya::fileio::TranslatorKey;
+
+struct FoundPrim
+{
+    UsdPrim       prim;
+    TranslatorKey key;
+};
+
+// The hierarchy is split until there are enough subtrees to keep the workers busy, or until this
+// depth is reached.
+const size_t _minSubtreeCount = 64;
+const int    _maxSplitDepth = 4;
+
+// The children visited by TransformIterator, which walks through the prototypes of the instances
+UsdPrimSiblingRange getTraversedChildren(const UsdPrim& prim)
+{
+    return prim.IsInstance() ? prim.GetPrototype().GetChildren() : prim.GetChildren();
+}
+
+void collectPrim(const UsdPrim& prim, std::vector<FoundPrim>& found)
+{
+    found.push_back(FoundPrim { prim, TranslatorKey(prim) });
+}
+
+void collectSubtree(const UsdPrim& prim, std::vector<FoundPrim>& found)
+{
+    collectPrim(prim, found);
+    for (const UsdPrim& child : getTraversedChildren(prim)) {
+        collectSubtree(child, found);
+    }
+}
+
+} // namespace
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
@@ -84,6 +128,13 @@ bool importSchemaPrim(
     return true;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TranslatorKey::TranslatorKey(const UsdPrim& prim)
+    : typeName(prim.GetTypeName())
+{
+    prim.GetMetadata(Metadata::assetType, &assetType);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 SchemaPrimsUtils::SchemaPrimsUtils(fileio::translators::TranslatorManufacture& manufacture)
     : m_manufacture(manufacture)
@@ -103,6 +154,63 @@ fileio::translators::TranslatorRefPtr SchemaPrimsUtils::isSchemaPrim(const UsdPr
     return m_manufacture.get(prim);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+std::vector<UsdPrim> SchemaPrimsUtils::findSchemaPrims(const UsdPrim& startPrim, bool importAll)
+{
+    // Split the hierarchy into prims visited on their own, and subtrees walked by the workers,
+    // listed in traversal order so that concatenating the results gives the serial order.
+    struct TraversalItem
+    {
+        UsdPrim prim;
+        bool    subtree;
+    };
+    std::vector<TraversalItem> items { { startPrim, true } };
+    for (int depth = 0; depth < _maxSplitDepth && items.size() < _minSubtreeCount; ++depth) {
+        std::vector<TraversalItem> split;
+        for (const TraversalItem& item : items) {
+            split.push_back({ item.prim, false });
+            if (item.subtree) {
+                for (const UsdPrim& child : getTraversedChildren(item.prim)) {
+                    split.push_back({ child, true });
+                }
+            }
+        }
+        items.swap(split);
+    }
+
+    std::vector<std::vector<FoundPrim>> found(items.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, items.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                if (items[i].subtree) {
+                    collectSubtree(items[i].prim, found[i]);
+                } else {
+                    collectPrim(items[i].prim, found[i]);
+                }
+            }
+        });
+
+    // The translators may be implemented in python, so they are looked up on this thread, once per
+    // translator key.
+    std::unordered_map<TranslatorKey, bool, TranslatorKeyHash> importable;
+    std::vector<UsdPrim>                                       prims;
+    for (const auto& group : found) {
+        for (const FoundPrim& foundPrim : group) {
+            auto it = importable.find(foundPrim.key);
+            if (it == importable.end()) {
+                translators::TranslatorRefPtr translator = m_manufacture.get(foundPrim.prim);
+                const bool isImportable
+                    = translator && (translator->importableByDefault() || importAll);
+                it = importable.emplace(foundPrim.key, isImportable).first;
+            }
+            if (it->second) {
+                prims.push_back(foundPrim.prim);
+            }
+        }
+    }
+    return prims;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 } // namespace fileio
 } // namespace usdmaya
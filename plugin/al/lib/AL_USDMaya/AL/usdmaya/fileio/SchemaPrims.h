@@ -24,6 +24,9 @@
 #include <pxr/base/tf/token.h>
 #include <pxr/pxr.h>
 
+#include <string>
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -35,6 +38,42 @@ extern const TfToken ALSchemaType;
 extern const TfToken ALExcludedPrimSchema;
 extern const TfToken assetType;
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  The translator of a prim only depends on its assettype metadata and its type name (see
+///         TranslatorManufacture::get), so prims sharing a key can share the translator lookup.
+///         The key is read from the prim without touching the translators, so it can be built from
+///         any thread.
+/// \ingroup   fileio
+//----------------------------------------------------------------------------------------------------------------------
+struct TranslatorKey
+{
+    /// \brief  ctor
+    TranslatorKey() = default;
+
+    /// \brief  ctor
+    /// \param  prim the prim to read the key of
+    explicit TranslatorKey(const UsdPrim& prim);
+
+    std::string assetType;
+    TfToken     typeName;
+
+    bool operator==(const TranslatorKey& other) const
+    {
+        return typeName == other.typeName && assetType == other.assetType;
+    }
+};
+
+/// \brief  hash functor for TranslatorKey
+struct TranslatorKeyHash
+{
+    size_t operator()(const TranslatorKey& key) const
+    {
+        const size_t hash = TfToken::HashFunctor()(key.typeName);
+        return hash
+            ^ (std::hash<std::string>()(key.assetType) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  a method called to import a schema prim into maya
 /// \param  usdPrim the usd prim to be imported into Maya
@@ -71,6 +110,15 @@ public:
     /// \return the corresponding translator of the schema prim
     fileio::translators::TranslatorRefPtr isSchemaPrim(const UsdPrim& prim);
 
+    /// \brief  finds the prims under a prim that have a translator, in the order of a
+    ///         TransformIterator started at that prim. The hierarchy is walked in parallel, and
+    ///         the translator is only looked up once for all the prims sharing a type.
+    /// \param  startPrim the prim from which the traversal starts, included in the results
+    /// \param  importAll if false, only the prims whose translator is importable by default are
+    ///         returned
+    /// \return the prims found
+    std::vector<UsdPrim> findSchemaPrims(const UsdPrim& startPrim, bool importAll);
+
     /// \brief  returns true if the prim specified requires a transform when importing custom nodes
     /// into the maya scene \param  prim the USD prim to check \return true if the prim requires a
     /// parent transform on import, false otherwise
@@ -1006,40 +1006,29 @@ MStatus TransformTranslator::copyAttributes(
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void TransformTranslator::copyAttributeValue(
-    const MPlug&       plug,
-    UsdAttribute&      usdAttr,
-    const UsdTimeCode& timeCode)
+VtValue TransformTranslator::getVisibilityValue(const MPlug& plug)
 {
-    MObject              node = plug.node();
-    MObject              attribute = plug.attribute();
-    static const TfToken visToken = UsdGeomTokens->visibility;
-    if (usdAttr.GetName() == visToken) {
-        bool value;
-        getBool(node, attribute, value);
-        usdAttr.Set(value ? UsdGeomTokens->inherited : UsdGeomTokens->invisible, timeCode);
-    }
+    bool value;
+    getBool(plug.node(), plug.attribute(), value);
+    return VtValue(value ? UsdGeomTokens->inherited : UsdGeomTokens->invisible);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void TransformTranslator::copyAttributeValue(
-    const MPlug&       attr,
-    UsdAttribute&      usdAttr,
-    const UsdTimeCode& timeCode,
-    bool               mergeOffsetMatrix)
+VtValue TransformTranslator::getAttributeValue(
+    const MPlug&            attr,
+    const SdfValueTypeName& typeName,
+    bool                    mergeOffsetMatrix)
 {
     double value[3];
     if (mergeOffsetMatrix && extractOffsetMatrixComponent(attr, value)) {
-        if (usdAttr.GetTypeName() == SdfValueTypeNames->Float3) {
-            usdAttr.Set(
-                GfVec3f(
-                    static_cast<float>(value[0]),
-                    static_cast<float>(value[1]),
-                    static_cast<float>(value[2])),
-                timeCode);
-        } else if (usdAttr.GetTypeName() == SdfValueTypeNames->Double3) {
-            usdAttr.Set(GfVec3d(value[0], value[1], value[2]), timeCode);
-        } else if (usdAttr.GetTypeName() == SdfValueTypeNames->Matrix4d) {
+        if (typeName == SdfValueTypeNames->Float3) {
+            return VtValue(GfVec3f(
+                static_cast<float>(value[0]),
+                static_cast<float>(value[1]),
+                static_cast<float>(value[2])));
+        } else if (typeName == SdfValueTypeNames->Double3) {
+            return VtValue(GfVec3d(value[0], value[1], value[2]));
+        } else if (typeName == SdfValueTypeNames->Matrix4d) {
             // Notice that the only case for this Matrix4d type is "shear"
             GfMatrix4d shearMatrix(
                 1.0f,
@@ -1058,20 +1047,21 @@ void TransformTranslator::copyAttributeValue(
                 0.0f,
                 0.0f,
                 1.0f);
-            usdAttr.Set(shearMatrix, timeCode);
+            return VtValue(shearMatrix);
         }
-        return;
+        return VtValue();
     }
 
-    usdmaya::utils::DgNodeHelper::copyAttributeValue(attr, usdAttr, timeCode);
+    return usdmaya::utils::DgNodeHelper::getAttributeValue(
+        attr, usdmaya::utils::getAttributeType(typeName));
 }
 
-void TransformTranslator::copyAttributeValue(
-    const MPlug&       attr,
-    UsdAttribute&      usdAttr,
-    const float        scale,
-    const UsdTimeCode& timeCode,
-    bool               mergeOffsetMatrix)
+//----------------------------------------------------------------------------------------------------------------------
+VtValue TransformTranslator::getAttributeValue(
+    const MPlug&            attr,
+    const SdfValueTypeName& typeName,
+    const float             scale,
+    bool                    mergeOffsetMatrix)
 {
     // Notice that "rotate" is the only one we supported at the moment,
     // The rotation order is ignored, due to it's been created at the
@@ -1079,20 +1069,58 @@ void TransformTranslator::copyAttributeValue(
     // order for non-default time code values.
     double value[3];
     if (mergeOffsetMatrix && extractOffsetMatrixComponent(attr, value)) {
-        if (usdAttr.GetTypeName() == SdfValueTypeNames->Float3) {
-            usdAttr.Set(
-                GfVec3f(
-                    static_cast<float>(value[0] * scale),
-                    static_cast<float>(value[1] * scale),
-                    static_cast<float>(value[2] * scale)),
-                timeCode);
-        } else if (usdAttr.GetTypeName() == SdfValueTypeNames->Double3) {
-            usdAttr.Set(GfVec3d(value[0] * scale, value[1] * scale, value[2] * scale), timeCode);
+        if (typeName == SdfValueTypeNames->Float3) {
+            return VtValue(GfVec3f(
+                static_cast<float>(value[0] * scale),
+                static_cast<float>(value[1] * scale),
+                static_cast<float>(value[2] * scale)));
+        } else if (typeName == SdfValueTypeNames->Double3) {
+            return VtValue(GfVec3d(value[0] * scale, value[1] * scale, value[2] * scale));
         }
-        return;
+        return VtValue();
     }
 
-    translators::DgNodeTranslator::copyAttributeValue(attr, usdAttr, scale, timeCode);
+    return usdmaya::utils::DgNodeHelper::getAttributeValue(
+        attr, usdmaya::utils::getAttributeType(typeName), scale);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TransformTranslator::copyAttributeValue(
+    const MPlug&       plug,
+    UsdAttribute&      usdAttr,
+    const UsdTimeCode& timeCode)
+{
+    static const TfToken visToken = UsdGeomTokens->visibility;
+    if (usdAttr.GetName() == visToken) {
+        usdAttr.Set(getVisibilityValue(plug), timeCode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TransformTranslator::copyAttributeValue(
+    const MPlug&       attr,
+    UsdAttribute&      usdAttr,
+    const UsdTimeCode& timeCode,
+    bool               mergeOffsetMatrix)
+{
+    const VtValue value = getAttributeValue(attr, usdAttr.GetTypeName(), mergeOffsetMatrix);
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TransformTranslator::copyAttributeValue(
+    const MPlug&       attr,
+    UsdAttribute&      usdAttr,
+    const float        scale,
+    const UsdTimeCode& timeCode,
+    bool               mergeOffsetMatrix)
+{
+    const VtValue value = getAttributeValue(attr, usdAttr.GetTypeName(), scale, mergeOffsetMatrix);
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -126,6 +126,39 @@ public:
         const UsdTimeCode& timeCode,
         bool               mergeOffsetMatrix);
 
+    /// \brief  returns the value of the maya visibility plug, as the USD visibility token
+    /// \param  attr the visibility plug to read
+    /// \return UsdGeomTokens->inherited or UsdGeomTokens->invisible
+    AL_USDMAYA_PUBLIC
+    static VtValue getVisibilityValue(const MPlug& attr);
+
+    /// \brief  returns the value of the maya plug, converted to the USD type the value will be
+    ///         written to. This only reads from maya, so it can be used to sample a plug while
+    ///         the USD data is authored elsewhere.
+    /// \param  attr the maya plug to read
+    /// \param  typeName the type of the USD attribute the value is intended for
+    /// \param  mergeOffsetMatrix flag if needs to merge offset parent matrix
+    /// \return the value, or an empty VtValue if the plug could not be converted
+    AL_USDMAYA_PUBLIC
+    static VtValue getAttributeValue(
+        const MPlug&            attr,
+        const SdfValueTypeName& typeName,
+        bool                    mergeOffsetMatrix);
+
+    /// \brief  returns the value of the maya plug, converted to the USD type the value will be
+    ///         written to, and multiplied by the scale
+    /// \param  attr the maya plug to read
+    /// \param  typeName the type of the USD attribute the value is intended for
+    /// \param  scale additional scale value to apply to the value
+    /// \param  mergeOffsetMatrix flag if needs to merge offset parent matrix
+    /// \return the value, or an empty VtValue if the plug could not be converted
+    AL_USDMAYA_PUBLIC
+    static VtValue getAttributeValue(
+        const MPlug&            attr,
+        const SdfValueTypeName& typeName,
+        float                   scale,
+        bool                    mergeOffsetMatrix);
+
 private:
     static MStatus processMetaData(const UsdPrim& from, MObject& to, const ImporterParams& params);
 
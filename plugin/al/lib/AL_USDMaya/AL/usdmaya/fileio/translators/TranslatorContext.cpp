@@ -15,10 +15,15 @@
 //
 #include "AL/usdmaya/fileio/translators/TranslatorContext.h"
 
+#include "AL/usdmaya/BinaryStream.h"
 #include "AL/usdmaya/DebugCodes.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 
+#include <maya/MCallbackIdArray.h>
+#include <maya/MDGMessage.h>
+#include <maya/MDagMessage.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MNodeMessage.h>
 #include <maya/MProfiler.h>
 #include <maya/MSelectionList.h>
 
@@ -44,6 +49,31 @@ bool isDescendantPath(const SdfPathSet& affectedPaths, const SdfPath& path)
     return false;
 }
 
+// Incremented whenever a Maya node is renamed, reparented or deleted, since the node names written
+// by the binary serialisation of any context may have changed.
+uint64_t         _nodeNamesGeneration = 1;
+MCallbackIdArray _nodeNameCallbacks;
+
+void onNodeNameChanged(MObject&, const MString&, void*) { ++_nodeNamesGeneration; }
+
+void onDagChanged(MDagMessage::DagMessage, MDagPath&, MDagPath&, void*) { ++_nodeNamesGeneration; }
+
+void onNodeRemoved(MObject&, void*) { ++_nodeNamesGeneration; }
+
+// header of the binary serialisation ("ALTC"), followed by the version of the encoding
+const uint64_t _binaryMagic = 0x43544c41;
+const uint64_t _binaryVersion = 1;
+
+MObject getNodeFromName(const char* name)
+{
+    MObject        obj;
+    MSelectionList sl;
+    if (sl.add(name)) {
+        sl.getDependNode(0, obj);
+    }
+    return obj;
+}
+
 } // namespace
 
 namespace AL {
@@ -62,6 +92,35 @@ UsdStageRefPtr TranslatorContext::getUsdStage() const
     return UsdStageRefPtr();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TranslatorContext::PrimLookup& TranslatorContext::insertLookup(PrimLookup&& lookup)
+{
+    const SdfPath path = lookup.path();
+    auto          inserted = m_primMapping.emplace(path, std::move(lookup));
+    if (inserted.second) {
+        m_primIndex.emplace(path, &inserted.first->second);
+        ++m_generation;
+    }
+    return inserted.first->second;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TranslatorContext::PrimLookups::iterator TranslatorContext::eraseLookup(PrimLookups::iterator it)
+{
+    m_primIndex.erase(it->first);
+    ++m_generation;
+    return m_primMapping.erase(it);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::setUniqueKey(PrimLookup& lookup, std::size_t key)
+{
+    if (lookup.uniqueKey() != key) {
+        lookup.setUniqueKey(key);
+        ++m_generation;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void TranslatorContext::validatePrims()
 {
@@ -69,12 +128,13 @@ void TranslatorContext::validatePrims()
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Validate prims");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::validatePrims ** VALIDATE PRIMS **\n");
-    for (auto it : m_primMapping) {
-        if (it.objectHandle().isValid() && it.objectHandle().isAlive()) {
+    for (const auto& it : m_primMapping) {
+        const PrimLookup& lookup = it.second;
+        if (lookup.objectHandle().isValid() && lookup.objectHandle().isAlive()) {
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
                     "TranslatorContext::validatePrims ** VALID HANDLE DETECTED %s **\n",
-                    it.path().GetText());
+                    lookup.path().GetText());
         }
     }
 }
@@ -87,7 +147,7 @@ bool TranslatorContext::getTransform(const SdfPath& path, MObjectHandle& object)
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getTransform %s\n", path.GetText());
     auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (it) {
         if (!it->objectHandle().isValid()) {
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg("TranslatorContext::getTransform - invalid handle\n");
@@ -107,20 +167,21 @@ void TranslatorContext::updatePrimTypes(const SdfPathSet& affectedPaths)
 
     auto stage = m_proxyShape->usdStage();
     for (auto it = m_primMapping.begin(); it != m_primMapping.end();) {
-        SdfPath path(it->path());
+        SdfPath path(it->first);
         UsdPrim prim = stage->GetPrimAtPath(path);
         bool    modifiedIt = false;
         if (!prim) {
             // Check if the registered prim path is affected
             if (isDescendantPath(affectedPaths, path)) {
-                it = m_primMapping.erase(it);
+                it = eraseLookup(it);
                 modifiedIt = true;
             }
         } else {
             std::string translatorId
                 = m_proxyShape->translatorManufacture().generateTranslatorId(prim);
-            if (it->translatorId() != translatorId) {
-                it->translatorId() = translatorId;
+            if (it->second.translatorId() != translatorId) {
+                it->second.setTranslatorId(translatorId);
+                ++m_generation;
                 ++it;
                 modifiedIt = true;
             }
@@ -140,7 +201,7 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObject '%s' \n", path.GetText());
 
     auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (it) {
         const MTypeId zero(0);
         if (zero != typeId) {
             for (auto temp : it->createdNodes()) {
@@ -188,7 +249,7 @@ bool TranslatorContext::getMObject(const SdfPath& path, MObjectHandle& object, M
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObject '%s' \n", path.GetText());
 
     auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (it) {
         const MTypeId zero(0);
         if (MFn::kInvalid != type) {
             for (auto temp : it->createdNodes()) {
@@ -234,7 +295,7 @@ bool TranslatorContext::getMObjects(const SdfPath& path, MObjectHandleArray& ret
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext::getMObjects: %s\n", path.GetText());
     auto it = find(path);
-    if (it != m_primMapping.end()) {
+    if (it) {
         returned = it->createdNodes();
         return true;
     }
@@ -252,18 +313,18 @@ void TranslatorContext::registerItem(const UsdPrim& prim, MObjectHandle object)
             "TranslatorContext::registerItem adding entry %s[%s]\n",
             prim.GetPath().GetText(),
             object.object().apiTypeStr());
-    auto iter = findLocation(prim.GetPath());
-    if (iter == m_primMapping.end() || iter->path() != prim.GetPath()) {
+    PrimLookup* lookup = find(prim.GetPath());
+    if (!lookup) {
         // We keep around this legacy plugin identification by type only to allow tests which don't
         // create a proxy shape to run..
         std::string translatorId = m_proxyShape
             ? m_proxyShape->translatorManufacture().generateTranslatorId(prim)
             : "schematype:" + prim.GetTypeName().GetString();
 
-        iter
-            = m_primMapping.insert(iter, PrimLookup(prim.GetPath(), translatorId, object.object()));
+        lookup = &insertLookup(PrimLookup(prim.GetPath(), translatorId, object.object()));
     } else {
-        iter->setNode(object.object());
+        lookup->setNode(object.object());
+        ++m_generation;
     }
 
     if (object.object() == MObject::kNullObj) {
@@ -277,7 +338,7 @@ void TranslatorContext::registerItem(const UsdPrim& prim, MObjectHandle object)
             .Msg(
                 "TranslatorContext::registerItem primPath=%s translatorId=%s to MObject type %s\n",
                 prim.GetPath().GetText(),
-                iter->translatorId().c_str(),
+                lookup->translatorId().c_str(),
                 object.object().apiTypeStr());
     }
 }
@@ -294,22 +355,23 @@ void TranslatorContext::insertItem(const UsdPrim& prim, MObjectHandle object)
             prim.GetPath().GetText(),
             object.object().apiTypeStr());
 
-    auto iter = findLocation(prim.GetPath());
-    if (iter == m_primMapping.end() || iter->path() != prim.GetPath()) {
+    PrimLookup* lookup = find(prim.GetPath());
+    if (!lookup) {
         // We keep around this legacy plugin identification by type only to allow tests which don't
         // create a proxy shape to run..
         std::string translatorId = m_proxyShape
             ? m_proxyShape->translatorManufacture().generateTranslatorId(prim)
             : "schematype:" + prim.GetTypeName().GetString();
 
-        iter = m_primMapping.insert(iter, PrimLookup(prim.GetPath(), translatorId, MObject()));
+        lookup = &insertLookup(PrimLookup(prim.GetPath(), translatorId, MObject()));
     }
 
     if (object.object() == MObject::kNullObj) {
         return;
     }
 
-    iter->createdNodes().push_back(object);
+    lookup->createdNodes().push_back(object);
+    ++m_generation;
 
     if (object.object() == MObject::kNullObj) {
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
@@ -322,7 +384,7 @@ void TranslatorContext::insertItem(const UsdPrim& prim, MObjectHandle object)
             .Msg(
                 "TranslatorContext::insertItem primPath=%s translatorId=%s to MObject type %s\n",
                 prim.GetPath().GetText(),
-                iter->translatorId().c_str(),
+                lookup->translatorId().c_str(),
                 object.object().apiTypeStr());
     }
 }
@@ -336,7 +398,7 @@ void TranslatorContext::removeItems(const SdfPath& path)
     TF_DEBUG(ALUSDMAYA_TRANSLATORS)
         .Msg("TranslatorContext::removeItems remove under primPath=%s\n", path.GetText());
     auto it = find(path);
-    if (it != m_primMapping.end() && it->path() == path) {
+    if (it) {
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg("TranslatorContext::removeItems removing path=%s\n", it->path().GetText());
         MDGModifier        modifier1;
@@ -415,7 +477,10 @@ void TranslatorContext::removeItems(const SdfPath& path)
             }
             AL_MAYA_CHECK_ERROR2(status, "failed to delete dag nodes");
         }
-        m_primMapping.erase(it);
+        auto mapping = m_primMapping.find(path);
+        if (mapping != m_primMapping.end()) {
+            eraseLookup(mapping);
+        }
     }
     validatePrims();
 }
@@ -440,17 +505,11 @@ MString TranslatorContext::serialise() const
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Serialise");
 
     TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext:serialise\n");
-    std::ostringstream oss;
-    for (auto& path : m_excludedGeometry) {
-        oss << path.first.GetString() << ",";
-    }
+    serialiseExcludedGeometry();
 
-    m_proxyShape->excludedTranslatedGeometryPlug().setString(MString(oss.str().c_str()));
-
-    oss.str("");
-    oss.clear();
-
-    for (auto it : m_primMapping) {
+    std::ostringstream oss;
+    for (const auto& entry : m_primMapping) {
+        const PrimLookup& it = entry.second;
         oss << it.path() << "=" << it.translatorId() << ",";
         oss << getNodeName(it.object());
         for (uint32_t i = 0; i < it.createdNodes().size(); ++i) {
@@ -517,21 +576,193 @@ void TranslatorContext::deserialise(const MString& string)
             lookup.createdNodes().push_back(obj);
         }
 
-        // Check for any prim lookup duplicates.
+        // Duplicates of a prim lookup are ignored.
         // This assumes lookups have 1:1 mapping of prim to translator, and that
         // multiple translators can not be registered against the same prim type.
-        auto iter
-            = std::find_if(m_primMapping.begin(), m_primMapping.end(), [&](const PrimLookup& p) {
-                  return p.path() == lookup.path();
-              });
-        if (iter == m_primMapping.end())
-            m_primMapping.push_back(lookup);
+        insertLookup(std::move(lookup));
+    }
+
+    deserialiseExcludedGeometry();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::serialiseBinary(MIntArray& data) const
+{
+    MProfilingScope profilerScope(
+        _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Serialise binary");
+
+    TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext:serialiseBinary\n");
+    serialiseExcludedGeometry();
+
+    // only a handful of translators are used by all the prims, so the ids are written once and the
+    // mappings refer to them by index
+    std::vector<std::string>                  translatorIds;
+    std::unordered_map<std::string, uint64_t> translatorIndices;
+    for (const auto& entry : m_primMapping) {
+        std::string translatorId = entry.second.translatorId();
+        if (translatorIndices.emplace(translatorId, translatorIds.size()).second) {
+            translatorIds.push_back(std::move(translatorId));
+        }
+    }
+
+    BinaryStreamWriter writer;
+    writer.writeUInt(_binaryMagic);
+    writer.writeUInt(_binaryVersion);
+    writer.writeUInt(translatorIds.size());
+    for (const auto& translatorId : translatorIds) {
+        writer.writeString(translatorId);
+    }
+
+    // the mappings are sorted by path, and the nodes of neighbouring prims usually share their
+    // parents, so both compress well against the previous entry
+    writer.writeUInt(m_primMapping.size());
+    std::string previousPath;
+    std::string previousNodeName;
+    for (const auto& entry : m_primMapping) {
+        const PrimLookup&  lookup = entry.second;
+        const std::string& path = lookup.path().GetString();
+        writer.writePrefixedString(path, previousPath);
+        previousPath = path;
+
+        writer.writeUInt(translatorIndices[lookup.translatorId()]);
+
+        std::string nodeName = getNodeName(lookup.object()).asChar();
+        writer.writePrefixedString(nodeName, previousNodeName);
+        previousNodeName = std::move(nodeName);
+
+        writer.writeUInt(lookup.createdNodes().size());
+        for (const auto& node : lookup.createdNodes()) {
+            nodeName = getNodeName(node.object()).asChar();
+            writer.writePrefixedString(nodeName, previousNodeName);
+            previousNodeName = std::move(nodeName);
+        }
+        writer.writeUInt(lookup.uniqueKey());
+    }
+
+    writer.toIntArray(data);
+    m_serialisedGeneration = m_generation;
+    m_serialisedNodeNamesGeneration = _nodeNamesGeneration;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool TranslatorContext::deserialiseBinary(const MIntArray& data)
+{
+    MProfilingScope profilerScope(
+        _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Deserialise binary");
+
+    TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorContext:deserialiseBinary\n");
+    BinaryStreamReader reader(data);
+    uint64_t           magic = 0, version = 0;
+    if (!reader.readUInt(magic) || magic != _binaryMagic || !reader.readUInt(version)
+        || version != _binaryVersion) {
+        return false;
+    }
+
+    uint64_t numTranslatorIds = 0;
+    reader.readUInt(numTranslatorIds);
+    std::vector<std::string> translatorIds;
+    for (uint64_t i = 0; i < numTranslatorIds && reader.isValid(); ++i) {
+        std::string translatorId;
+        if (reader.readString(translatorId)) {
+            translatorIds.push_back(std::move(translatorId));
+        }
+    }
+
+    // decode everything before touching the mappings, so that corrupted data is ignored as a whole
+    uint64_t numLookups = 0;
+    reader.readUInt(numLookups);
+    std::vector<PrimLookup> lookups;
+    std::string             path;
+    std::string             nodeName;
+    for (uint64_t i = 0; i < numLookups && reader.isValid(); ++i) {
+        uint64_t translatorIndex = 0;
+        if (!reader.readPrefixedString(path) || !reader.readUInt(translatorIndex)
+            || translatorIndex >= translatorIds.size() || !reader.readPrefixedString(nodeName)) {
+            break;
+        }
+        PrimLookup lookup(
+            SdfPath(path), translatorIds[translatorIndex], getNodeFromName(nodeName.c_str()));
+
+        uint64_t numCreatedNodes = 0;
+        reader.readUInt(numCreatedNodes);
+        for (uint64_t j = 0; j < numCreatedNodes && reader.readPrefixedString(nodeName); ++j) {
+            lookup.createdNodes().push_back(getNodeFromName(nodeName.c_str()));
+        }
+
+        uint64_t uniqueKey = 0;
+        if (reader.readUInt(uniqueKey)) {
+            lookup.setUniqueKey(std::size_t(uniqueKey));
+            lookups.push_back(std::move(lookup));
+        }
+    }
+
+    if (!reader.isValid() || lookups.size() != numLookups) {
+        MGlobal::displayWarning("Ignoring corrupted serialised translator context");
+        return false;
+    }
+
+    const bool wasEmpty = m_primMapping.empty() && m_excludedGeometry.empty();
+    for (auto& lookup : lookups) {
+        // Duplicates of a prim lookup are ignored, as in deserialise.
+        insertLookup(std::move(lookup));
+    }
+    deserialiseExcludedGeometry();
+
+    // the context now matches the data it was read from, which can be kept until the next change
+    if (wasEmpty) {
+        m_serialisedGeneration = m_generation;
+        m_serialisedNodeNamesGeneration = _nodeNamesGeneration;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool TranslatorContext::isBinarySerialisationDirty() const
+{
+    return m_generation != m_serialisedGeneration
+        || _nodeNamesGeneration != m_serialisedNodeNamesGeneration;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::registerNodeNameCallbacks()
+{
+    if (_nodeNameCallbacks.length()) {
+        return;
     }
+    _nodeNameCallbacks.append(
+        MNodeMessage::addNameChangedCallback(MObject::kNullObj, onNodeNameChanged));
+    _nodeNameCallbacks.append(MDagMessage::addAllDagChangesCallback(onDagChanged));
+    _nodeNameCallbacks.append(MDGMessage::addNodeRemovedCallback(onNodeRemoved));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::removeNodeNameCallbacks()
+{
+    MMessage::removeCallbacks(_nodeNameCallbacks);
+    _nodeNameCallbacks.clear();
+    ++_nodeNamesGeneration;
+}
 
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::serialiseExcludedGeometry() const
+{
+    std::ostringstream oss;
+    for (auto& path : m_excludedGeometry) {
+        oss << path.first.GetString() << ",";
+    }
+
+    m_proxyShape->excludedTranslatedGeometryPlug().setString(MString(oss.str().c_str()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorContext::deserialiseExcludedGeometry()
+{
     SdfPathVector vec = m_proxyShape->getPrimPathsFromCommaJoinedString(
         m_proxyShape->excludedTranslatedGeometryPlug().asString());
     for (auto& it : vec) {
-        m_excludedGeometry.emplace(it, it);
+        if (m_excludedGeometry.emplace(it, it).second) {
+            ++m_generation;
+        }
     }
 }
 
@@ -548,14 +779,13 @@ void TranslatorContext::preRemoveEntry(
         .Msg("TranslatorContext::preRemoveEntry primPath=%s\n", primPath.GetText());
 
     PrimLookups::iterator end = m_primMapping.end();
-    PrimLookups::iterator range_begin
-        = std::lower_bound(m_primMapping.begin(), end, primPath, value_compare());
+    PrimLookups::iterator range_begin = m_primMapping.lower_bound(primPath);
     PrimLookups::iterator range_end = range_begin;
     for (; range_end != end; ++range_end) {
         // due to the joys of sorting, any child prims of this prim being destroyed should appear
         // next to each other (one would assume); So if compare does not find a match (the value is
         // something other than zero), we are no longer in the same prim root
-        const SdfPath& childPath = range_end->path();
+        const SdfPath& childPath = range_end->first;
 
         if (!childPath.HasPrefix(primPath)) {
             break;
@@ -568,10 +798,10 @@ void TranslatorContext::preRemoveEntry(
     // (which will guarentee the the itemsToRemove will be ordered such that the child prims will be
     // destroyed before their parents).
     auto iter = range_end;
-    itemsToRemove.reserve(itemsToRemove.size() + (range_end - range_begin));
+    itemsToRemove.reserve(itemsToRemove.size() + std::distance(range_begin, range_end));
     while (iter != range_begin) {
         --iter;
-        PrimLookup& node = *iter;
+        PrimLookup& node = iter->second;
 
         if (std::find(itemsToRemove.begin(), itemsToRemove.end(), node.path())
             != itemsToRemove.end()) {
@@ -608,8 +838,7 @@ void TranslatorContext::removeEntries(const SdfPathVector& itemsToRemove)
     auto iter = itemsToRemove.begin();
     while (iter != itemsToRemove.end()) {
         auto path = *iter;
-        auto node
-            = std::lower_bound(m_primMapping.begin(), m_primMapping.end(), path, value_compare());
+        auto node = m_primMapping.find(path);
         if (node == m_primMapping.end()) {
             ++iter;
             continue;
@@ -619,14 +848,14 @@ void TranslatorContext::removeEntries(const SdfPathVector& itemsToRemove)
 
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg("TranslatorContext::removeEntries removing: %s\n", iter->GetText());
-        if (node->objectHandle().isValid() && node->objectHandle().isAlive()) {
-            unloadPrim(path, node->object());
+        if (node->second.objectHandle().isValid() && node->second.objectHandle().isAlive()) {
+            unloadPrim(path, node->second.object());
         }
 
         // The item might already have been removed by a translator...
         if (primMappingSize == m_primMapping.size()) {
             // remove nodes from map
-            m_primMapping.erase(node);
+            eraseLookup(node);
         }
 
         if (isInTransformChain) {
@@ -646,7 +875,8 @@ void TranslatorContext::updateUniqueKeys()
         _translatorContextProfilerCategory, MProfiler::kColorE_L3, "Update unique keys");
 
     auto stage = getUsdStage();
-    for (auto& lookup : m_primMapping) {
+    for (auto& entry : m_primMapping) {
+        PrimLookup& lookup = entry.second;
         const auto& prim = stage->GetPrimAtPath(lookup.path());
         if (prim) {
             std::string translatorId = getTranslatorIdForPath(lookup.path());
@@ -660,7 +890,7 @@ void TranslatorContext::updateUniqueKeys()
                         "uniqueKey='%lu'\n",
                         lookup.path().GetText(),
                         key);
-                lookup.setUniqueKey(key);
+                setUniqueKey(lookup, key);
             }
         }
     }
@@ -685,7 +915,7 @@ void TranslatorContext::updateUniqueKey(const UsdPrim& prim)
     auto translator = m_proxyShape->translatorManufacture().getTranslatorFromId(translatorId);
     if (translator) {
         auto it = find(path);
-        if (it != m_primMapping.end() && it->path() == path) {
+        if (it) {
             auto key(translator->generateUniqueKey(prim));
             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                 .Msg(
@@ -694,7 +924,7 @@ void TranslatorContext::updateUniqueKey(const UsdPrim& prim)
                     path.GetText(),
                     key,
                     it->uniqueKey());
-            it->setUniqueKey(key);
+            setUniqueKey(*it, key);
         }
     }
 }
@@ -935,6 +1165,7 @@ bool TranslatorContext::addExcludedGeometry(const SdfPath& newPath)
             m_excludedGeometry.emplace(newPath, newPath);
         }
         m_isExcludedGeometryDirty = true;
+        ++m_generation;
         return true;
     }
     return false;
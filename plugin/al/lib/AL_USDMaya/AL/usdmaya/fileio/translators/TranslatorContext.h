@@ -28,12 +28,16 @@
 
 #include <maya/MDGModifier.h>
 #include <maya/MGlobal.h>
+#include <maya/MIntArray.h>
 #include <maya/MObject.h>
 #include <maya/MObjectArray.h>
 #include <maya/MObjectHandle.h>
 #include <maya/MPxData.h>
 
+#include <cstdint>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -248,9 +252,9 @@ public:
     /// \return the type name for that prim
     std::string getTranslatorIdForPath(SdfPath path) const
     {
-        const auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return it->translatorId();
+        const PrimLookup* lookup = find(path);
+        if (lookup) {
+            return lookup->translatorId();
         }
         TF_DEBUG(ALUSDMAYA_TRANSLATORS)
             .Msg(
@@ -284,6 +288,38 @@ public:
     AL_USDMAYA_PUBLIC
     void deserialise(const MString& string);
 
+    /// \brief  serialises the content of the translator context to a versioned binary encoding.
+    ///         Prim paths and node names are written relative to the previous ones, and translator
+    ///         ids are written once, so the data is much smaller and faster to parse than the string
+    ///         returned by serialise.
+    /// \param  data the returned binary data
+    AL_USDMAYA_PUBLIC
+    void serialiseBinary(MIntArray& data) const;
+
+    /// \brief  deserialises the data written by serialiseBinary back into the translator context
+    /// \param  data the binary data
+    /// \return false if the data is empty or was not written by a known version of serialiseBinary,
+    ///         in which case the context is left untouched
+    AL_USDMAYA_PUBLIC
+    bool deserialiseBinary(const MIntArray& data);
+
+    /// \brief  returns true if the mappings, or the names of any Maya node, may have changed since
+    ///         the context was last serialised or deserialised with the binary encoding. If not, the
+    ///         data previously written with serialiseBinary is still valid.
+    AL_USDMAYA_PUBLIC
+    bool isBinarySerialisationDirty() const;
+
+    /// \brief  Internal method.
+    ///         Installs the callbacks tracking the renaming, reparenting and deletion of Maya nodes,
+    ///         which change the node names written by serialiseBinary.
+    AL_USDMAYA_PUBLIC
+    static void registerNodeNameCallbacks();
+
+    /// \brief  Internal method.
+    ///         Removes the callbacks installed by registerNodeNameCallbacks.
+    AL_USDMAYA_PUBLIC
+    static void removeNodeNameCallbacks();
+
     /// \brief  debugging utility to help keep track of prims during a variant switch
     AL_USDMAYA_PUBLIC
     void validatePrims();
@@ -297,9 +333,9 @@ public:
     /// \return true if an entry is found that matches, false otherwise
     bool hasEntry(const SdfPath& path, const std::string& translatorId)
     {
-        auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return translatorId == it->translatorId();
+        const PrimLookup* lookup = find(path);
+        if (lookup) {
+            return translatorId == lookup->translatorId();
         }
         return false;
     }
@@ -327,9 +363,9 @@ public:
     /// \return unique key value
     std::size_t getUniqueKeyForPath(const SdfPath& path)
     {
-        auto it = find(path);
-        if (it != m_primMapping.end()) {
-            return it->uniqueKey();
+        const PrimLookup* lookup = find(path);
+        if (lookup) {
+            return lookup->uniqueKey();
         }
         return 0;
     }
@@ -382,6 +418,10 @@ public:
         /// \return the schema type stored for this prim
         std::string translatorId() const { return m_translatorId; }
 
+        /// \brief  set the translator id of the prim
+        /// \param  translatorId the translator id for this prim
+        void setTranslatorId(const std::string& translatorId) { m_translatorId = translatorId; }
+
         /// \brief  get the unique key of the prim
         /// \return the unique key for this prim
         const std::size_t uniqueKey() const { return m_uniqueKey; }
@@ -415,10 +455,13 @@ public:
         MObjectHandleArray m_createdNodes;
     };
 
-    /// a sorted array of prim mappings
-    typedef std::vector<PrimLookup> PrimLookups;
+    /// the prim mappings, ordered by path so that the mappings of a prim and its descendants are
+    /// contiguous
+    typedef std::map<SdfPath, PrimLookup> PrimLookups;
 
     /// comparison utility (for sorting array of pointers to node references based on their path)
+    /// \note  the mappings no longer use it since they are held in a map, it is kept because it is
+    ///        part of the public API, for code sorting or searching its own arrays of PrimLookup.
     struct value_compare
     {
         /// \brief  compare schema node ref to path
@@ -445,7 +488,12 @@ public:
     };
 
     /// \brief  This is used for testing only. Do not call.
-    void clearPrimMappings() { m_primMapping.clear(); }
+    void clearPrimMappings()
+    {
+        m_primMapping.clear();
+        m_primIndex.clear();
+        ++m_generation;
+    }
 
     /// \brief  add geometry to the exclusion list
     /// \param  newPath the path to add as an excluded translator path
@@ -467,6 +515,7 @@ public:
         }
         m_excludedGeometry.erase(newPath);
         m_isExcludedGeometryDirty = true;
+        ++m_generation;
         return true;
     }
 
@@ -488,37 +537,39 @@ private:
     /// MObject. \return true if the prim maps to a MObject inside the Maya Dag tree.
     bool isPrimInTransformChain(const SdfPath& path);
 
-    inline PrimLookups::iterator find(const SdfPath& path)
+    /// \brief  find the mapping of a prim in constant time
+    /// \param  path the prim path
+    /// \return the mapping, or nullptr if the prim has none
+    inline PrimLookup* find(const SdfPath& path)
     {
-        PrimLookups::iterator end = m_primMapping.end();
-        PrimLookups::iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        if (it != end) {
-            if (it->path() == path)
-                return it;
-        }
-        return end;
+        auto it = m_primIndex.find(path);
+        return it != m_primIndex.end() ? it->second : nullptr;
     }
 
-    inline PrimLookups::const_iterator find(const SdfPath& path) const
+    inline const PrimLookup* find(const SdfPath& path) const
     {
-        PrimLookups::const_iterator end = m_primMapping.end();
-        PrimLookups::const_iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        if (it != end) {
-            if (it->path() == path)
-                return it;
-        }
-        return end;
+        auto it = m_primIndex.find(path);
+        return it != m_primIndex.end() ? it->second : nullptr;
     }
 
-    inline PrimLookups::iterator findLocation(const SdfPath& path)
-    {
-        PrimLookups::iterator end = m_primMapping.end();
-        PrimLookups::iterator it
-            = std::lower_bound(m_primMapping.begin(), end, path, value_compare());
-        return it;
-    }
+    /// \brief  add a mapping, unless the prim already has one
+    /// \param  lookup the mapping to add
+    /// \return the mapping of the prim
+    PrimLookup& insertLookup(PrimLookup&& lookup);
+
+    /// \brief  remove the mapping of a prim
+    /// \param  it the mapping to remove
+    /// \return the mapping following the removed one
+    PrimLookups::iterator eraseLookup(PrimLookups::iterator it);
+
+    /// \brief  set the unique key of a mapping, tracking the change for the serialisation
+    void setUniqueKey(PrimLookup& lookup, std::size_t key);
+
+    /// \brief  writes the excluded geometry to the proxy shape
+    void serialiseExcludedGeometry() const;
+
+    /// \brief  reads the excluded geometry back from the proxy shape
+    void deserialiseExcludedGeometry();
 
     TranslatorContext(nodes::ProxyShape* proxyShape)
         : m_proxyShape(proxyShape)
@@ -532,10 +583,21 @@ private:
     // a dependency node
     PrimLookups m_primMapping;
 
+    // index of the mappings in m_primMapping by prim path, so that finding the mapping of a prim
+    // does not depend on the number of mappings
+    std::unordered_map<SdfPath, PrimLookup*, SdfPath::Hash> m_primIndex;
+
     // list of geometry that has been request to be excluded during the translation
     SdfInstanceMap m_excludedGeometry;
     bool           m_isExcludedGeometryDirty;
 
+    // incremented on every change of the mappings or of the excluded geometry, and compared with
+    // the value at the time of the last binary serialisation to skip re-serialising unchanged
+    // contexts
+    uint64_t         m_generation = 1;
+    mutable uint64_t m_serialisedGeneration = 0;
+    mutable uint64_t m_serialisedNodeNamesGeneration = 0;
+
 public:
     void setForceDefaultRead(bool forceDefaultRead) { m_forceDefaultRead = forceDefaultRead; }
 
@@ -22,6 +22,7 @@
 
 #include "AL/maya/utils/Utils.h"
 #include "AL/usd/transaction/TransactionManager.h"
+#include "AL/usdmaya/BinaryStream.h"
 #include "AL/usdmaya/Global.h"
 #include "AL/usdmaya/Metadata.h"
 #include "AL/usdmaya/StageCache.h"
@@ -29,7 +30,6 @@
 #include "AL/usdmaya/Version.h"
 #include "AL/usdmaya/cmds/ProxyShapePostLoadProcess.h"
 #include "AL/usdmaya/fileio/SchemaPrims.h"
-#include "AL/usdmaya/fileio/TransformIterator.h"
 #include "AL/usdmaya/nodes/Engine.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
@@ -54,6 +54,7 @@
 #include <maya/MEvaluationNode.h>
 #include <maya/MEventMessage.h>
 #include <maya/MFileIO.h>
+#include <maya/MFnIntArrayData.h>
 #include <maya/MFnPluginData.h>
 #include <maya/MFnReference.h>
 #include <maya/MGlobal.h>
@@ -98,6 +99,28 @@ bool hasNode(const MFnDependencyNode& fn)
     return result.length();
 }
 
+// version of the binary encoding of the transform references
+const uint64_t _transformRefsVersion = 1;
+
+/// \brief Returns the int array stored on a data attribute, empty if it was never set.
+MIntArray getIntArrayData(const MPlug& plug)
+{
+    MObject data = plug.asMObject();
+    if (data.isNull()) {
+        return MIntArray();
+    }
+    MFnIntArrayData fn(data);
+    return fn.array();
+}
+
+/// \brief Stores an int array on a data attribute.
+void setIntArrayData(MPlug plug, const MIntArray& array)
+{
+    MFnIntArrayData fn;
+    MObject         data = fn.create(array);
+    plug.setValue(data);
+}
+
 } // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -109,7 +132,14 @@ void ProxyShape::serialiseTranslatorContext()
     triggerEvent("PreSerialiseContext");
 
     context()->updateUniqueKeys();
-    serializedTrCtxPlug().setValue(context()->serialise());
+
+    // the data stored by a previous save is still valid if nothing changed since
+    if (context()->isBinarySerialisationDirty()) {
+        MIntArray data;
+        context()->serialiseBinary(data);
+        setIntArrayData(serializedTrCtxDataPlug(), data);
+        serializedTrCtxPlug().setString("");
+    }
 
     triggerEvent("PostSerialiseContext");
 }
@@ -122,9 +152,12 @@ void ProxyShape::deserialiseTranslatorContext()
 
     triggerEvent("PreDeserialiseContext");
 
-    MString value;
-    serializedTrCtxPlug().getValue(value);
-    context()->deserialise(value);
+    if (!context()->deserialiseBinary(getIntArrayData(serializedTrCtxDataPlug()))) {
+        // scenes saved by older versions only hold the string encoding
+        MString value;
+        serializedTrCtxPlug().getValue(value);
+        context()->deserialise(value);
+    }
 
     triggerEvent("PostDeserialiseContext");
 }
@@ -141,6 +174,7 @@ MObject ProxyShape::m_layers = MObject::kNullObj;
 MObject ProxyShape::m_serializedSessionLayer = MObject::kNullObj;
 MObject ProxyShape::m_sessionLayerName = MObject::kNullObj;
 MObject ProxyShape::m_serializedTrCtx = MObject::kNullObj;
+MObject ProxyShape::m_serializedTrCtxData = MObject::kNullObj;
 MObject ProxyShape::m_unloaded = MObject::kNullObj;
 MObject ProxyShape::m_ambient = MObject::kNullObj;
 MObject ProxyShape::m_diffuse = MObject::kNullObj;
@@ -148,6 +182,7 @@ MObject ProxyShape::m_specular = MObject::kNullObj;
 MObject ProxyShape::m_emission = MObject::kNullObj;
 MObject ProxyShape::m_shininess = MObject::kNullObj;
 MObject ProxyShape::m_serializedRefCounts = MObject::kNullObj;
+MObject ProxyShape::m_serializedRefCountsData = MObject::kNullObj;
 MObject ProxyShape::m_version = MObject::kNullObj;
 MObject ProxyShape::m_transformTranslate = MObject::kNullObj;
 MObject ProxyShape::m_transformRotate = MObject::kNullObj;
@@ -593,6 +628,11 @@ MStatus ProxyShape::initialise()
             kCached | kKeyable | kWritable | kAffectsAppearance | kStorable);
         m_serializedTrCtx
             = addStringAttr("serializedTrCtx", "srtc", kReadable | kWritable | kStorable | kHidden);
+        m_serializedTrCtxData = addDataAttr(
+            "serializedTrCtxData",
+            "srtcd",
+            MFnData::kIntArray,
+            kReadable | kWritable | kStorable | kHidden);
 
         addFrame("USD Timing Information");
         inheritTimeAttr(
@@ -640,6 +680,11 @@ MStatus ProxyShape::initialise()
 
         m_serializedRefCounts = addStringAttr(
             "serializedRefCounts", "strcs", kReadable | kWritable | kStorable | kHidden);
+        m_serializedRefCountsData = addDataAttr(
+            "serializedRefCountsData",
+            "strcsd",
+            MFnData::kIntArray,
+            kReadable | kWritable | kStorable | kHidden);
 
         m_version = addStringAttr("version", "vrs", getVersion(), kReadable | kStorable | kHidden);
 
@@ -993,6 +1038,12 @@ void ProxyShape::onTransactionNotice(
     TF_DEBUG(ALUSDMAYA_EVENTS)
         .Msg("ProxyShape::onTransactionNotice - transaction closed - processing changes\n");
 
+    // the notice only holds the paths edited during the transaction, so there is nothing to update
+    // when the edits cancelled each other out (unless a variant switch is pending)
+    if (!notice.AnyChanges() && !m_compositionHasChanged) {
+        return;
+    }
+
     processChangedObjects(notice.GetResyncedPaths(), notice.GetChangedInfoOnlyPaths());
     if (!m_requestedRedraw) {
         m_requestedRedraw = true;
@@ -1101,9 +1152,6 @@ std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
         _proxyShapeProfilerCategory, MProfiler::kColorE_L3, "Hunt for native nodes under prim");
 
     TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::huntForNativeNodesUnderPrim\n");
-    std::vector<UsdPrim>     prims;
-    fileio::SchemaPrimsUtils utils(manufacture);
-
     const UsdPrim prim = m_stage->GetPrimAtPath(startPath);
     if (!prim.IsValid()) {
         MString errorString;
@@ -1112,22 +1160,11 @@ std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
             startPath.GetString().c_str(),
             proxyTransformPath.fullPathName());
         MGlobal::displayError(errorString);
-        return prims;
+        return std::vector<UsdPrim>();
     }
 
-    fileio::TransformIterator it(prim, proxyTransformPath);
-    for (; !it.done(); it.next()) {
-        UsdPrim prim = it.prim();
-        if (!prim.IsValid()) {
-            continue;
-        }
-
-        fileio::translators::TranslatorRefPtr trans = utils.isSchemaPrim(prim);
-        if (trans && (trans->importableByDefault() || importAll)) {
-            prims.push_back(prim);
-        }
-    }
-    return prims;
+    fileio::SchemaPrimsUtils utils(manufacture);
+    return utils.findSchemaPrims(prim, importAll);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1815,8 +1852,9 @@ void ProxyShape::serialiseTransformRefs()
     TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::serialiseTransformRefs\n");
     triggerEvent("PreSerialiseTransformRefs");
 
-    std::ostringstream oss;
-    for (auto iter : m_requiredPaths) {
+    std::vector<std::pair<std::string, const TransformReferenceMap::value_type*>> refs;
+    refs.reserve(m_requiredPaths.size());
+    for (const auto& iter : m_requiredPaths) {
         MStatus       status;
         MObjectHandle handle(iter.second.node());
 
@@ -1825,17 +1863,73 @@ void ProxyShape::serialiseTransformRefs()
             if (status && hasNode(fn)) {
                 MDagPath path;
                 fn.getPath(path);
-                oss << path.fullPathName() << " " << iter.first.GetText() << " "
-                    << uint32_t(iter.second.required()) << " " << uint32_t(iter.second.selected())
-                    << " " << uint32_t(iter.second.refCount()) << ";";
+                refs.emplace_back(path.fullPathName().asChar(), &iter);
             }
         }
     }
-    serializedRefCountsPlug().setString(oss.str().c_str());
+
+    // the references are sorted by prim path, and their transforms by DAG path, so both are
+    // written relative to the previous reference
+    BinaryStreamWriter writer;
+    writer.writeUInt(_transformRefsVersion);
+    writer.writeUInt(refs.size());
+    std::string previousNodeName;
+    std::string previousPath;
+    for (const auto& ref : refs) {
+        const std::string&        path = ref.second->first.GetString();
+        const TransformReference& reference = ref.second->second;
+        writer.writePrefixedString(ref.first, previousNodeName);
+        writer.writePrefixedString(path, previousPath);
+        writer.writeUInt(reference.required());
+        writer.writeUInt(reference.selected());
+        writer.writeUInt(reference.refCount());
+        previousNodeName = ref.first;
+        previousPath = path;
+    }
+
+    MIntArray data;
+    writer.toIntArray(data);
+    setIntArrayData(serializedRefCountsDataPlug(), data);
+    serializedRefCountsPlug().setString("");
 
     triggerEvent("PostSerialiseTransformRefs");
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void ProxyShape::addTransformReference(
+    const MString& nodeName,
+    const SdfPath& path,
+    uint32_t       required,
+    uint32_t       selected,
+    uint32_t       refCounts)
+{
+    MSelectionList sl;
+    if (sl.add(nodeName)) {
+        MObject node;
+        if (sl.getDependNode(0, node)) {
+            MFnDependencyNode fn(node);
+            Scope*            transformNode = dynamic_cast<Scope*>(fn.userNode());
+            if (transformNode) {
+                m_requiredPaths.emplace(
+                    path, TransformReference(node, transformNode, required, selected, refCounts));
+                TF_DEBUG(ALUSDMAYA_EVALUATION)
+                    .Msg(
+                        "ProxyShape::deserialiseTransformRefs m_requiredPaths added "
+                        "AL_usdmaya_Transform TransformReference: %s\n",
+                        path.GetText());
+            } else {
+                m_requiredPaths.emplace(
+                    path, TransformReference(node, nullptr, required, selected, refCounts));
+                TF_DEBUG(ALUSDMAYA_EVALUATION)
+                    .Msg(
+                        "ProxyShape::deserialiseTransformRefs m_requiredPaths added "
+                        "TransformReference: %s\n",
+                        path.GetText());
+            }
+        }
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::deserialiseTransformRefs()
 {
@@ -1844,53 +1938,49 @@ void ProxyShape::deserialiseTransformRefs()
 
     triggerEvent("PreDeserialiseTransformRefs");
 
-    MString      str = serializedRefCountsPlug().asString();
-    MStringArray strs;
-    str.split(';', strs);
-
-    for (uint32_t i = 0, n = strs.length(); i < n; ++i) {
-        if (strs[i].length()) {
-            MStringArray tstrs;
-            strs[i].split(' ', tstrs);
-            MString nodeName = tstrs[0];
-
-            MSelectionList sl;
-            if (sl.add(nodeName)) {
-                MObject node;
-                if (sl.getDependNode(0, node)) {
-                    MFnDependencyNode fn(node);
-                    Scope*            transformNode = dynamic_cast<Scope*>(fn.userNode());
-                    if (transformNode) {
-                        const uint32_t required = tstrs[2].asUnsigned();
-                        const uint32_t selected = tstrs[3].asUnsigned();
-                        const uint32_t refCounts = tstrs[4].asUnsigned();
-                        SdfPath        path(tstrs[1].asChar());
-                        m_requiredPaths.emplace(
-                            path,
-                            TransformReference(node, transformNode, required, selected, refCounts));
-                        TF_DEBUG(ALUSDMAYA_EVALUATION)
-                            .Msg(
-                                "ProxyShape::deserialiseTransformRefs m_requiredPaths added "
-                                "AL_usdmaya_Transform TransformReference: %s\n",
-                                path.GetText());
-                    } else {
-                        const uint32_t required = tstrs[2].asUnsigned();
-                        const uint32_t selected = tstrs[3].asUnsigned();
-                        const uint32_t refCounts = tstrs[4].asUnsigned();
-                        SdfPath        path(tstrs[1].asChar());
-                        m_requiredPaths.emplace(
-                            path, TransformReference(node, nullptr, required, selected, refCounts));
-                        TF_DEBUG(ALUSDMAYA_EVALUATION)
-                            .Msg(
-                                "ProxyShape::deserialiseTransformRefs m_requiredPaths added "
-                                "TransformReference: %s\n",
-                                path.GetText());
-                    }
-                }
+    BinaryStreamReader reader(getIntArrayData(serializedRefCountsDataPlug()));
+    uint64_t           version = 0;
+    if (reader.readUInt(version) && version == _transformRefsVersion) {
+        uint64_t numRefs = 0;
+        reader.readUInt(numRefs);
+        std::string nodeName;
+        std::string path;
+        for (uint64_t i = 0; i < numRefs; ++i) {
+            uint64_t required = 0, selected = 0, refCounts = 0;
+            if (!reader.readPrefixedString(nodeName) || !reader.readPrefixedString(path)
+                || !reader.readUInt(required) || !reader.readUInt(selected)
+                || !reader.readUInt(refCounts)) {
+                MGlobal::displayWarning("Ignoring corrupted serialised transform references");
+                break;
+            }
+            addTransformReference(
+                MString(nodeName.c_str()),
+                SdfPath(path),
+                uint32_t(required),
+                uint32_t(selected),
+                uint32_t(refCounts));
+        }
+    } else {
+        // scenes saved by older versions only hold the string encoding
+        MString      str = serializedRefCountsPlug().asString();
+        MStringArray strs;
+        str.split(';', strs);
+
+        for (uint32_t i = 0, n = strs.length(); i < n; ++i) {
+            if (strs[i].length()) {
+                MStringArray tstrs;
+                strs[i].split(' ', tstrs);
+                addTransformReference(
+                    tstrs[0],
+                    SdfPath(tstrs[1].asChar()),
+                    tstrs[2].asUnsigned(),
+                    tstrs[3].asUnsigned(),
+                    tstrs[4].asUnsigned());
             }
         }
     }
 
+    setIntArrayData(serializedRefCountsDataPlug(), MIntArray());
     serializedRefCountsPlug().setString("");
 
     triggerEvent("PostDeserialiseTransformRefs");
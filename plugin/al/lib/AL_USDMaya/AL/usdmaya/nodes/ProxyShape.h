@@ -297,9 +297,12 @@ public:
     /// name of serialized session layer (on the LayerManager)
     AL_DECL_ATTRIBUTE(sessionLayerName);
 
-    /// serialised translator context
+    /// serialised translator context, as written by older versions
     AL_DECL_ATTRIBUTE(serializedTrCtx);
 
+    /// serialised translator context, binary encoded
+    AL_DECL_ATTRIBUTE(serializedTrCtxData);
+
     /// Open the stage unloaded.
     AL_DECL_ATTRIBUTE(unloaded);
 
@@ -318,9 +321,13 @@ public:
     /// material shininess
     AL_DECL_ATTRIBUTE(shininess);
 
-    /// Serialised reference counts to rebuild the transform reference information
+    /// Serialised reference counts to rebuild the transform reference information, as written by
+    /// older versions
     AL_DECL_ATTRIBUTE(serializedRefCounts);
 
+    /// Serialised reference counts to rebuild the transform reference information, binary encoded
+    AL_DECL_ATTRIBUTE(serializedRefCountsData);
+
     /// The path list joined by ",", that will be used as a mask when doing UsdStage::OpenMask()
     AL_DECL_ATTRIBUTE(populationMaskIncludePaths);
 
@@ -807,6 +814,14 @@ private:
         const std::vector<std::pair<SdfPath, MObject>>& removedRefs,
         TransformReason                                 reason);
 
+    /// \brief  adds a transform reference read by deserialiseTransformRefs
+    void addTransformReference(
+        const MString& nodeName,
+        const SdfPath& path,
+        uint32_t       required,
+        uint32_t       selected,
+        uint32_t       refCounts);
+
     void constructExcludedPrims();
 
     MObject makeUsdTransformChain_internal(
@@ -19,8 +19,30 @@
 #include "AL/usdmaya/nodes/ProxyShape.h"
 
 #include <maya/MProfiler.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace {
 const int _primFilterProfilerCategory = MProfiler::addCategory("PrimFIlter", "PrimFIlter");
+
+struct PrimInfo
+{
+    AL::usdmaya::fileio::TranslatorKey key;
+    bool                               active = false;
+};
+
+struct TranslatorInfo
+{
+    std::string translatorId;
+    bool        supportsUpdate = false;
+    bool        requiresParent = false;
+    bool        importableByDefault = false;
+};
 } // namespace
 
 namespace AL {
@@ -34,7 +56,7 @@ PrimFilter::PrimFilter(
     const std::vector<UsdPrim>& newPrimSet,
     PrimFilterInterface*        proxy,
     bool                        forceImport)
-    : m_newPrimSet(newPrimSet)
+    : m_newPrimSet()
     , m_transformsToCreate()
     , m_updatablePrimSet()
     , m_removedPrimSet()
@@ -42,99 +64,113 @@ PrimFilter::PrimFilter(
     MProfilingScope profilerScope(
         _primFilterProfilerCategory, MProfiler::kColorE_L3, "Initialise prim filter");
 
-    // copy over original prims
-    m_removedPrimSet.assign(previousPrims.begin(), previousPrims.end());
-    std::sort(
-        m_removedPrimSet.begin(), m_removedPrimSet.end(), [](const SdfPath& a, const SdfPath& b) {
-            return b < a;
+    // Read what the translator of each prim depends on in parallel. The translators themselves
+    // may be implemented in python, so they are only queried from this thread, once per key.
+    std::vector<PrimInfo> primInfos(newPrimSet.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, newPrimSet.size()),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const UsdPrim& prim = newPrimSet[i];
+                primInfos[i].active = prim.IsActive();
+                if (primInfos[i].active) {
+                    primInfos[i].key = fileio::TranslatorKey(prim);
+                }
+            }
         });
 
-    for (auto it = m_newPrimSet.begin(); it != m_newPrimSet.end();) {
-        UsdPrim prim = *it;
-        auto    lastIt = it;
-        ++it;
+    std::unordered_map<fileio::TranslatorKey, TranslatorInfo, fileio::TranslatorKeyHash>
+                                               translatorInfos;
+    std::unordered_set<SdfPath, SdfPath::Hash> previousPaths(
+        previousPrims.begin(), previousPrims.end());
+    std::unordered_set<SdfPath, SdfPath::Hash> keptPaths;
 
-        SdfPath path = prim.GetPath();
-
-        // check previous prim type (if it exists at all?)
-        std::string existingTranslatorId = proxy->getTranslatorIdForPath(path);
+    m_newPrimSet.reserve(newPrimSet.size());
+    for (size_t i = 0, n = newPrimSet.size(); i < n; ++i) {
+        // inactive prims should be removed
+        if (!primInfos[i].active) {
+            continue;
+        }
 
-        std::string newTranslatorId = proxy->generateTranslatorId(prim);
+        const UsdPrim& prim = newPrimSet[i];
+        auto           translatorIt = translatorInfos.find(primInfos[i].key);
+        if (translatorIt == translatorInfos.end()) {
+            TranslatorInfo info;
+            info.translatorId = proxy->generateTranslatorId(prim);
+            proxy->getTranslatorInfo(
+                info.translatorId,
+                info.supportsUpdate,
+                info.requiresParent,
+                info.importableByDefault);
+            translatorIt = translatorInfos.emplace(primInfos[i].key, std::move(info)).first;
+        }
+        const TranslatorInfo& info = translatorIt->second;
 
-        // inactive prims should be removed
-        if (!prim.IsActive()) {
-            it = m_newPrimSet.erase(lastIt);
+        if (!info.importableByDefault && !forceImport) {
             continue;
         }
 
-        bool supportsUpdate = false;
-        bool requiresParent = false;
-        bool importableByDefault = false;
-        proxy->getTranslatorInfo(
-            newTranslatorId, supportsUpdate, requiresParent, importableByDefault);
-
-        if (importableByDefault || forceImport) {
-            // if the type remains the same, and the type supports update
-            if (existingTranslatorId == newTranslatorId) {
-                // locate the path and delete from the removed set (we do not want to delete this
-                // prim! Note that m_removedPrimSet is reverse sorted
-                auto iter = std::lower_bound(
-                    m_removedPrimSet.begin(),
-                    m_removedPrimSet.end(),
-                    path,
-                    [](const SdfPath& a, const SdfPath& b) { return b < a; });
-                if (iter != removedPrimSet().end() && *iter == path) {
-                    if (supportsUpdate) {
-                        m_removedPrimSet.erase(iter);
-                        if (proxy->isPrimDirty(prim)) {
-                            TF_DEBUG(ALUSDMAYA_TRANSLATORS)
-                                .Msg(
-                                    "PrimFilter::PrimFilter %s prim will be updated.\n",
-                                    path.GetText());
-                            m_updatablePrimSet.push_back(prim);
-                        } else {
-                            TF_DEBUG(ALUSDMAYA_TRANSLATORS)
-                                .Msg(
-                                    "PrimFilter::PrimFilter %s prim remains unchanged.\n",
-                                    path.GetText());
-                        }
-                        // supporting update means it's not a new prim,
-                        // otherwise we still want the prim to be re-created.
-                        it = m_newPrimSet.erase(lastIt);
-
-                        // skip creating transforms in this case.
-                        requiresParent = false;
-                    } else {
-                        if (proxy->isPrimDirty(prim)) {
-                            // prim has been added in "remove prim set", nothing to do here
-                            TF_DEBUG(ALUSDMAYA_TRANSLATORS)
-                                .Msg(
-                                    "PrimFilter::PrimFilter %s prim will be removed and "
-                                    "recreated.\n",
-                                    path.GetText());
-                        } else {
-                            // prim is clean, no need to remove nor recreate
-                            TF_DEBUG(ALUSDMAYA_TRANSLATORS)
-                                .Msg(
-                                    "PrimFilter::PrimFilter %s prim remains unchanged.\n",
-                                    path.GetText());
-
-                            m_removedPrimSet.erase(iter);
-                            it = m_newPrimSet.erase(lastIt);
-                            // skip creating transforms in this case.
-                            requiresParent = false;
-                        }
-                    }
+        const SdfPath path = prim.GetPath();
+        bool          requiresParent = info.requiresParent;
+        bool          isNew = true;
+
+        // if the type remains the same, and the prim was previously translated
+        if (previousPaths.count(path) && !keptPaths.count(path)
+            && proxy->getTranslatorIdForPath(path) == info.translatorId) {
+            if (info.supportsUpdate) {
+                // keep the existing maya nodes (we do not want to delete this prim!)
+                keptPaths.insert(path);
+                if (proxy->isPrimDirty(prim)) {
+                    TF_DEBUG(ALUSDMAYA_TRANSLATORS)
+                        .Msg("PrimFilter::PrimFilter %s prim will be updated.\n", path.GetText());
+                    m_updatablePrimSet.push_back(prim);
+                } else {
+                    TF_DEBUG(ALUSDMAYA_TRANSLATORS)
+                        .Msg(
+                            "PrimFilter::PrimFilter %s prim remains unchanged.\n", path.GetText());
                 }
+                // supporting update means it's not a new prim,
+                // otherwise we still want the prim to be re-created.
+                isNew = false;
+            } else if (proxy->isPrimDirty(prim)) {
+                // prim stays in the "remove prim set", and will be recreated
+                TF_DEBUG(ALUSDMAYA_TRANSLATORS)
+                    .Msg(
+                        "PrimFilter::PrimFilter %s prim will be removed and recreated.\n",
+                        path.GetText());
+            } else {
+                // prim is clean, no need to remove nor recreate
+                TF_DEBUG(ALUSDMAYA_TRANSLATORS)
+                    .Msg("PrimFilter::PrimFilter %s prim remains unchanged.\n", path.GetText());
+                keptPaths.insert(path);
+                isNew = false;
             }
-            // if we need a transform, make a note of it now
-            if (requiresParent) {
-                m_transformsToCreate.push_back(prim);
+            // skip creating transforms for the prims that are kept
+            if (!isNew) {
+                requiresParent = false;
             }
-        } else {
-            it = m_newPrimSet.erase(lastIt);
+        }
+
+        if (isNew) {
+            m_newPrimSet.push_back(prim);
+        }
+        // if we need a transform, make a note of it now
+        if (requiresParent) {
+            m_transformsToCreate.push_back(prim);
         }
     }
+
+    // whatever was not kept is removed (in reverse order, so children are removed first)
+    m_removedPrimSet.reserve(previousPrims.size());
+    for (const SdfPath& path : previousPrims) {
+        if (!keptPaths.count(path)) {
+            m_removedPrimSet.push_back(path);
+        }
+    }
+    std::sort(
+        m_removedPrimSet.begin(), m_removedPrimSet.end(), [](const SdfPath& a, const SdfPath& b) {
+            return b < a;
+        });
 }
 
 //----------------------------------------------------------------------------------------------------------------------
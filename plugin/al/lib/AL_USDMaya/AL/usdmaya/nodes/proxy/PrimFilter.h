@@ -65,6 +65,11 @@ struct PrimFilterInterface
         bool&              importableByDefault)
         = 0;
 
+    /// \brief  returns the translatorId for a prim. The filter only calls this for the first prim
+    ///         of each assettype metadata and type name pair (see fileio::TranslatorKey), and
+    ///         reuses the result for the other prims sharing them.
+    /// \param  prim the prim to generate the translatorId of
+    /// \return the translatorId, or an empty string if no translator handles the prim
     virtual std::string generateTranslatorId(UsdPrim prim) = 0;
 
     /// \brief  check if a prim is dirty.
@@ -74,7 +79,10 @@ struct PrimFilterInterface
 };
 
 //----------------------------------------------------------------------------------------------------------------------
-/// \brief  A class to filter the prims during a variant switch
+/// \brief  A class to filter the prims during a variant switch. The prims are classified with a
+///         single pass over the new prims, and hashed lookups into the previous prims, so the cost
+///         is linear in the number of prims. The PrimFilterInterface is only called from the
+///         constructing thread.
 //----------------------------------------------------------------------------------------------------------------------
 class PrimFilter
 {
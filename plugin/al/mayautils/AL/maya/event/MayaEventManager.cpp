@@ -22,7 +22,11 @@
 #include <maya/MGlobal.h>
 #include <maya/MModelMessage.h>
 
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
 
 namespace AL {
 namespace maya {
@@ -1777,6 +1781,92 @@ public:
         return MGlobal::executeCommand(code, false, true);
     }
 
+    uint32_t compilePython(const char* const code) override
+    {
+        // callbacks registered with the same code share the same code object
+        auto it = m_compiledPython.find(code);
+        if (it != m_compiledPython.end()) {
+            ++it->second.refCount;
+            return it->second.handle;
+        }
+
+        // the code objects are kept in a dictionary of the __main__ module, the code being passed
+        // hex encoded so that it does not need escaping.
+        const uint32_t handle = ++m_lastCompiledPython;
+        std::string    command = "globals().setdefault('_AL_eventCallbackCode', {})[";
+        command += std::to_string(handle);
+        command += "] = compile(__import__('binascii').unhexlify('";
+        command += hexEncode(code, std::strlen(code));
+        command += "').decode('utf-8'), '<AL event callback>', 'exec')";
+        if (!MGlobal::executePythonCommand(command.c_str(), false, false)) {
+            return 0;
+        }
+        it = m_compiledPython.emplace(code, CompiledPython { handle, 1 }).first;
+        m_compiledPythonHandles.emplace(handle, it);
+        return handle;
+    }
+
+    bool executeCompiledPython(uint32_t compiledCode) override
+    {
+        const std::string command
+            = "exec(_AL_eventCallbackCode[" + std::to_string(compiledCode) + "])";
+        return MGlobal::executePythonCommand(command.c_str(), false, true);
+    }
+
+    void releaseCompiledPython(uint32_t compiledCode) override
+    {
+        auto handleIt = m_compiledPythonHandles.find(compiledCode);
+        if (handleIt == m_compiledPythonHandles.end()) {
+            return;
+        }
+
+        // the code object is dropped once no callback uses it anymore
+        auto it = handleIt->second;
+        if (--it->second.refCount) {
+            return;
+        }
+        const std::string command
+            = "_AL_eventCallbackCode.pop(" + std::to_string(compiledCode) + ", None)";
+        MGlobal::executePythonCommand(command.c_str(), false, false);
+        m_compiledPythonHandles.erase(handleIt);
+        m_compiledPython.erase(it);
+    }
+
+    bool setScriptPayloads(const std::vector<std::string>& payloads, const bool isPython) override
+    {
+        if (isPython) {
+            // set AL_eventPayloads to a list of strings
+            std::string joined;
+            for (size_t i = 0, n = payloads.size(); i < n; ++i) {
+                if (i) {
+                    joined += '\0';
+                }
+                joined += payloads[i];
+            }
+            std::string command = "AL_eventPayloads = __import__('binascii').unhexlify('";
+            command += hexEncode(joined.data(), joined.size());
+            command += "').decode('utf-8').split(u'\\x00')";
+            return MGlobal::executePythonCommand(command.c_str(), false, false);
+        }
+
+        // set the $AL_eventPayloads global string array
+        std::string command = "global string $AL_eventPayloads[]; $AL_eventPayloads = {";
+        for (size_t i = 0, n = payloads.size(); i < n; ++i) {
+            command += i ? ",\"" : "\"";
+            for (const char c : payloads[i]) {
+                switch (c) {
+                case '\\': command += "\\\\"; break;
+                case '"': command += "\\\""; break;
+                case '\n': command += "\\n"; break;
+                default: command += c; break;
+                }
+            }
+            command += '"';
+        }
+        command += "};";
+        return MGlobal::executeCommand(command.c_str(), false, false);
+    }
+
     void writeLog(EventSystemBinding::Type severity, const char* const text) override
     {
         switch (severity) {
@@ -1785,6 +1875,30 @@ public:
         case kError: MGlobal::displayError(text); break;
         }
     }
+
+private:
+    static std::string hexEncode(const char* const data, const size_t size)
+    {
+        static const char* const digits = "0123456789abcdef";
+        std::string              hex(size * 2, '0');
+        for (size_t i = 0; i < size; ++i) {
+            const uint8_t c = uint8_t(data[i]);
+            hex[2 * i] = digits[c >> 4];
+            hex[2 * i + 1] = digits[c & 0xf];
+        }
+        return hex;
+    }
+
+    struct CompiledPython
+    {
+        uint32_t handle;   ///< the key of the code object in _AL_eventCallbackCode
+        uint32_t refCount; ///< the number of callbacks using the code object
+    };
+    typedef std::map<std::string, CompiledPython> CompiledPythonMap;
+
+    CompiledPythonMap                                         m_compiledPython;
+    std::unordered_map<uint32_t, CompiledPythonMap::iterator> m_compiledPythonHandles;
+    uint32_t                                                  m_lastCompiledPython = 0;
 };
 
 static MayaEventSystemBinding g_eventSystem;
@@ -39,6 +39,37 @@ public:
         return MGlobal::executeCommand(code, false, true);
     }
 
+    uint32_t compilePython(const char* const code) override
+    {
+        m_compiledCode.push_back(code);
+        return uint32_t(m_compiledCode.size());
+    }
+
+    bool executeCompiledPython(uint32_t compiledCode) override
+    {
+        ++m_numCompiledExecutions;
+        return MGlobal::executePythonCommand(
+            m_compiledCode[compiledCode - 1].c_str(), false, true);
+    }
+
+    void releaseCompiledPython(uint32_t compiledCode) override
+    {
+        m_releasedCode.push_back(compiledCode);
+    }
+
+    bool setScriptPayloads(const std::vector<std::string>& payloads, const bool isPython) override
+    {
+        m_payloads = payloads;
+        ++m_numPayloadsSet;
+        return true;
+    }
+
+    std::vector<std::string> m_compiledCode;
+    std::vector<uint32_t>    m_releasedCode;
+    std::vector<std::string> m_payloads;
+    uint32_t                 m_numCompiledExecutions = 0;
+    uint32_t                 m_numPayloadsSet = 0;
+
     void writeLog(EventSystemBinding::Type severity, const char* const text) override
     {
         switch (severity) {
@@ -271,6 +302,106 @@ TEST(EventDispatcher, triggerEvent2)
     EXPECT_TRUE(info.unregisterCallback(id1));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TEST(EventDispatcher, triggerEventCompilesPythonOnce)
+{
+    g_eventSystem.m_compiledCode.clear();
+    g_eventSystem.m_numCompiledExecutions = 0;
+    EventDispatcher info(&g_eventSystem, "eventName", 42, kUserSpecifiedEventType, nullptr, 23);
+
+    CallbackId id1 = info.registerCallback("tag", "pass", 1000, true);
+
+    info.triggerEvent();
+    info.triggerEvent();
+    info.triggerEvent();
+
+    EXPECT_EQ(g_eventSystem.m_compiledCode.size(), 1u);
+    EXPECT_EQ(g_eventSystem.m_numCompiledExecutions, 3u);
+
+    EXPECT_TRUE(info.unregisterCallback(id1));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+static std::vector<size_t> g_indices;
+static void                func_dispatchBatch(void* userData, size_t index)
+{
+    g_userData = userData;
+    g_indices.push_back(index);
+}
+typedef void (*func_batch_ptr_type)(void*, size_t);
+
+TEST(EventDispatcher, triggerEventBatch)
+{
+    g_userData = 0;
+    g_indices.clear();
+    g_eventSystem.m_numCompiledExecutions = 0;
+    g_eventSystem.m_numPayloadsSet = 0;
+    EventDispatcher info(&g_eventSystem, "eventName", 42, kUserSpecifiedEventType, nullptr, 23);
+
+    int        value;
+    CallbackId id1 = info.registerCallback("tag", func_dispatchBatch, 1000, &value);
+    CallbackId id2 = info.registerCallback("tag1", "pass", 1001, true);
+    CallbackId id3 = info.registerCallback("tag2", "pass", 1002, true);
+
+    const std::vector<std::string> payloads = { "/root/a", "/root/b", "/root/c" };
+    info.triggerEventBatch(payloads, [](void* userData, const void* callback, size_t index) {
+        ((func_batch_ptr_type)callback)(userData, index);
+    });
+
+    // the C callback is called for each payload, the python callbacks once for the batch
+    EXPECT_EQ(g_userData, &value);
+    EXPECT_EQ(g_indices, std::vector<size_t>({ 0, 1, 2 }));
+    EXPECT_EQ(g_eventSystem.m_numCompiledExecutions, 2u);
+    EXPECT_EQ(g_eventSystem.m_numPayloadsSet, 1u);
+    EXPECT_EQ(g_eventSystem.m_payloads, payloads);
+
+    EXPECT_TRUE(info.unregisterCallback(id1));
+    EXPECT_TRUE(info.unregisterCallback(id2));
+    EXPECT_TRUE(info.unregisterCallback(id3));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(EventDispatcher, unregisterCallbackReleasesCompiledPython)
+{
+    g_eventSystem.m_compiledCode.clear();
+    g_eventSystem.m_releasedCode.clear();
+    EventDispatcher info(&g_eventSystem, "eventName", 42, kUserSpecifiedEventType, nullptr, 23);
+
+    CallbackId id1 = info.registerCallback("tag1", "pass", 1000, true);
+    CallbackId id2 = info.registerCallback("tag2", "pass", 1001, true);
+    CallbackId id3 = info.registerCallback("tag3", "pass", 1002, true);
+
+    info.triggerEvent();
+    EXPECT_TRUE(info.unregisterCallback(id1));
+    EXPECT_EQ(g_eventSystem.m_releasedCode, std::vector<uint32_t>({ 1u }));
+
+    // a callback that was never triggered has nothing to release
+    CallbackId id4 = info.registerCallback("tag4", "pass", 1003, true);
+    EXPECT_TRUE(info.unregisterCallback(id4));
+    EXPECT_EQ(g_eventSystem.m_releasedCode, std::vector<uint32_t>({ 1u }));
+
+    // the callbacks moved out of the dispatcher release their code too
+    Callback callback;
+    EXPECT_TRUE(info.unregisterCallback(id2, callback));
+    EXPECT_EQ(g_eventSystem.m_releasedCode, std::vector<uint32_t>({ 1u, 2u }));
+    EXPECT_TRUE(info.unregisterCallback(id3));
+    EXPECT_EQ(g_eventSystem.m_releasedCode, std::vector<uint32_t>({ 1u, 2u, 3u }));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(EventScheduler, unregisterEventReleasesCompiledPython)
+{
+    g_eventSystem.m_compiledCode.clear();
+    g_eventSystem.m_releasedCode.clear();
+    EventScheduler registrar(&g_eventSystem);
+    EventId        id1 = registrar.registerEvent("EventType1", kUserSpecifiedEventType);
+    registrar.registerCallback(id1, "tag", "pass", 1000, true);
+
+    EXPECT_TRUE(registrar.triggerEvent(id1));
+    EXPECT_TRUE(registrar.unregisterEvent(id1));
+    EXPECT_EQ(g_eventSystem.m_releasedCode, std::vector<uint32_t>({ 1u }));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // EventId registerEvent(const char* eventName, const void* associatedData = 0, const CallbackId
 // parentEvent = 0); bool unregisterEvent(EventId eventId);
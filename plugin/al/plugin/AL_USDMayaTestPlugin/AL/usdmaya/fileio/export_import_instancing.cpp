@@ -1,6 +1,9 @@
 #include "AL/usdmaya/Metadata.h"
 #include "test_usdmaya.h"
 
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/listOp.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/xform.h>
 
@@ -122,3 +125,69 @@ TEST(export_import_instancing, usd_instancing_roundtrip)
     EXPECT_EQ(allPaths[0].fullPathName(), "|nurbsCircle1|nurbsCircleShape1");
     EXPECT_EQ(allPaths[1].fullPathName(), "|parentTransform|nurbsCircle2|nurbsCircleShape1");
 }
+
+static const char* const generateDuplicateMeshes = R"(
+{
+polyCube -w 1 -h 1 -d 1 -ch 0;
+polyCube -w 1 -h 1 -d 1 -ch 0;
+setAttr "pCube2.translateZ" 5;
+polySphere -r 1 -sx 20 -sy 20 -ax 0 1 0 -cuv 2 -ch 0;
+}
+)";
+
+TEST(export_import_instancing, deduplicate_meshes)
+{
+    MFileIO::newFile(true);
+    MGlobal::executeCommand(generateDuplicateMeshes);
+
+    const std::string temp_path = buildTempPath("AL_USDMayaTests_duplicateMeshes.usda");
+
+    MString command = "file -force -options "
+                      "\"Dynamic_Attributes=1;"
+                      "Meshes=1;"
+                      "Duplicate_Instances=1;"
+                      "Merge_Transforms=1;"
+                      "Animation=0;"
+                      "Deduplicate_Meshes=1;\" -typ \"AL usdmaya export\" -pr -ea \"";
+    command += temp_path.c_str();
+    command += "\";";
+    MGlobal::executeCommand(command);
+
+    UsdStageRefPtr stage = UsdStage::Open(temp_path);
+    ASSERT_TRUE(stage);
+    SdfLayerHandle layer = stage->GetRootLayer();
+
+    // both cubes reference the same prototype, which holds their geometry
+    const SdfPath prototypePath("/MayaExportedInstanceSources/pCube1");
+    ASSERT_TRUE(layer->GetPrimAtPath(prototypePath));
+    EXPECT_TRUE(layer->GetAttributeAtPath(prototypePath.AppendProperty(UsdGeomTokens->points)));
+
+    for (const char* const path : { "/pCube1", "/pCube2" }) {
+        UsdPrim prim = stage->GetPrimAtPath(SdfPath(path));
+        ASSERT_TRUE(prim.IsValid() && prim.IsA<UsdGeomMesh>());
+        SdfReferenceListOp references;
+        prim.GetMetadata(SdfFieldKeys->References, &references);
+        ASSERT_EQ(references.GetPrependedItems().size(), 1u);
+        EXPECT_EQ(references.GetPrependedItems()[0].GetPrimPath(), prototypePath);
+        EXPECT_FALSE(
+            layer->GetAttributeAtPath(SdfPath(path).AppendProperty(UsdGeomTokens->points)));
+
+        VtArray<GfVec3f> points;
+        UsdGeomMesh(prim).GetPointsAttr().Get(&points);
+        EXPECT_EQ(points.size(), 8u);
+    }
+
+    // the transforms of the duplicates are kept
+    GfMatrix4d usdTransform;
+    bool       resetsXformStack = false;
+    UsdGeomMesh(stage->GetPrimAtPath(SdfPath("/pCube2")))
+        .GetLocalTransformation(&usdTransform, &resetsXformStack);
+    EXPECT_DOUBLE_EQ(usdTransform[3][2], 5.0);
+
+    // a unique mesh is exported as usual
+    UsdPrim sphere = stage->GetPrimAtPath(SdfPath("/pSphere1"));
+    ASSERT_TRUE(sphere.IsValid());
+    EXPECT_FALSE(sphere.HasAuthoredReferences());
+    EXPECT_TRUE(
+        layer->GetAttributeAtPath(SdfPath("/pSphere1").AppendProperty(UsdGeomTokens->points)));
+}
@@ -45,6 +45,7 @@ struct MockPrimFilterInterface : public AL::usdmaya::nodes::proxy::PrimFilterInt
     SdfPathVector     refPaths;
     SdfPathVector     cameraPaths;
     std::set<SdfPath> cleanPaths;
+    size_t            generateCount = 0;
 
     std::string getTranslatorIdForPath(const SdfPath& path) override
     {
@@ -73,6 +74,7 @@ struct MockPrimFilterInterface : public AL::usdmaya::nodes::proxy::PrimFilterInt
     /// registered
     std::string generateTranslatorId(UsdPrim prim) override
     {
+        ++generateCount;
         std::string translatorId;
 
         // Try metadata first
@@ -314,4 +316,35 @@ TEST(PrimFilter, removedPaths)
         EXPECT_TRUE(filter.updatablePrimSet().size() == 1);
         EXPECT_TRUE(filter.transformsToCreate().empty());
     }
+
+    /// The translator should only be looked up once per type, and the prims kept in order
+    {
+        const SdfPathVector previous = {
+            SdfPath("/root/cam"),
+            SdfPath("/root/hip1"),
+        };
+        mockInterface.refPaths = { SdfPath("/root/hip1") };
+        mockInterface.cameraPaths = { SdfPath("/root/cam") };
+        mockInterface.cleanPaths.clear();
+        mockInterface.generateCount = 0;
+
+        std::vector<UsdPrim> prims;
+        for (const auto& prim : stage->Traverse()) {
+            prims.push_back(prim);
+        }
+        AL::usdmaya::nodes::proxy::PrimFilter filter(previous, prims, &mockInterface, true);
+
+        EXPECT_EQ(2u, mockInterface.generateCount);
+        EXPECT_TRUE(filter.removedPrimSet().empty());
+        ASSERT_EQ(prims.size() - 2, filter.newPrimSet().size());
+        for (size_t i = 0, j = 0; i < prims.size(); ++i) {
+            if (std::find(previous.begin(), previous.end(), prims[i].GetPath())
+                == previous.end()) {
+                EXPECT_EQ(prims[i], filter.newPrimSet()[j++]);
+            }
+        }
+        EXPECT_EQ(2u, filter.updatablePrimSet().size());
+        EXPECT_EQ(prims.size() - 2, filter.transformsToCreate().size());
+        mockInterface.cameraPaths.clear();
+    }
 }
@@ -15,15 +15,19 @@
 //
 #include "AL/maya/test/testHelpers.h"
 #include "AL/usdmaya/StageCache.h"
+#include "AL/usdmaya/fileio/TransformIterator.h"
 #include "AL/usdmaya/fileio/translators/TranslatorContext.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "AL/usdmaya/nodes/Transform.h"
 #include "test_usdmaya.h"
 
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/camera.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
@@ -1326,7 +1330,56 @@ TEST(ProxyShape, boundingBox) { AL_USDMAYA_UNTESTED; }
 
 // std::vector<UsdPrim> huntForNativeNodesUnderPrim(const MDagPath& proxyTransformPath, SdfPath
 // startPath);
-TEST(ProxyShape, huntForNativeNodesUnderPrim) { AL_USDMAYA_UNTESTED; }
+TEST(ProxyShape, huntForNativeNodesUnderPrim)
+{
+    MFileIO::newFile(true);
+    auto constructStage = []() {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        UsdGeomXform::Define(stage, SdfPath("/root"));
+        for (int i = 0; i < 200; ++i) {
+            const SdfPath group("/root/group" + TfStringify(i));
+            UsdGeomXform::Define(stage, group);
+            UsdGeomMesh::Define(stage, group.AppendChild(TfToken("mesh")));
+            UsdGeomCamera::Define(stage, group.AppendChild(TfToken("camera")));
+            if (i % 10 == 0) {
+                UsdPrim instance = stage->DefinePrim(group.AppendChild(TfToken("instance")));
+                instance.GetReferences().AddInternalReference(SdfPath("/prototype"));
+                instance.SetInstanceable(true);
+            }
+        }
+        UsdGeomXform::Define(stage, SdfPath("/prototype"));
+        UsdGeomMesh::Define(stage, SdfPath("/prototype/mesh"));
+        return stage;
+    };
+
+    const std::string temp_path = buildTempPath("AL_USDMayaTests_huntForNativeNodes.usda");
+    MObject           shape;
+    AL::usdmaya::nodes::ProxyShape* proxy
+        = CreateMayaProxyShape(constructStage, temp_path, &shape);
+    UsdStageRefPtr stage = proxy->getUsdStage();
+
+    MDagPath proxyTransformPath;
+    MDagPath::getAPathTo(shape, proxyTransformPath);
+    proxyTransformPath.pop();
+
+    // the prims must be found in the order of a serial traversal
+    auto&                manufacture = proxy->translatorManufacture();
+    std::vector<UsdPrim> expected;
+    AL::usdmaya::fileio::TransformIterator it(
+        stage->GetPrimAtPath(SdfPath("/root")), proxyTransformPath);
+    for (; !it.done(); it.next()) {
+        if (manufacture.get(it.prim())) {
+            expected.push_back(it.prim());
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    const std::vector<UsdPrim> found = proxy->huntForNativeNodesUnderPrim(
+        proxyTransformPath, SdfPath("/root"), manufacture, true);
+    EXPECT_TRUE(found == expected);
+
+    MFileIO::newFile(true);
+}
 
 // void createSelectionChangedCallback();
 // void destroySelectionChangedCallback();
@@ -14,11 +14,16 @@
 // limitations under the License.
 //
 #include "AL/usdmaya/StageCache.h"
+#include "AL/usdmaya/fileio/translators/TranslatorContext.h"
 #include "AL/usdmaya/nodes/Layer.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "AL/usdmaya/nodes/Transform.h"
 #include "test_usdmaya.h"
 
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/stage.h>
@@ -32,7 +37,9 @@
 #include <maya/MItDependencyNodes.h>
 #include <maya/MSelectionList.h>
 
+#include <chrono>
 #include <fstream>
+#include <vector>
 
 using AL::maya::test::buildTempPath;
 
@@ -106,6 +113,8 @@ TEST(TranslatorContext, value_compare)
 // TfToken TranslatorContext::getTypeForPath(SdfPath path) const
 // MString TranslatorContext::serialise() const;
 // void TranslatorContext::deserialise(const MString& string);
+// void TranslatorContext::serialiseBinary(MIntArray& data) const;
+// bool TranslatorContext::deserialiseBinary(const MIntArray& data);
 TEST(TranslatorContext, TranslatorContext)
 {
     const MString     temp_ma_path = buildTempPath("AL_USDMayaTests_cube.ma");
@@ -264,11 +273,213 @@ TEST(TranslatorContext, TranslatorContext)
             MObjectHandle handle;
             EXPECT_FALSE(context->getTransform(SdfPath("/root/rig"), handle));
         }
+
+        {
+            obj = fnd.create("polyCube");
+            context->registerItem(prim, transformHandle);
+            context->insertItem(prim, obj);
+            EXPECT_TRUE(context->isBinarySerialisationDirty());
+            MIntArray data;
+            context->serialiseBinary(data);
+            EXPECT_FALSE(context->isBinarySerialisationDirty());
+
+            context->clearPrimMappings();
+            EXPECT_TRUE(context->isBinarySerialisationDirty());
+            EXPECT_TRUE(context->deserialiseBinary(data));
+            EXPECT_FALSE(context->isBinarySerialisationDirty());
+            {
+                AL::usdmaya::fileio::translators::MObjectHandleArray handles;
+                context->getMObjects(SdfPath("/root/rig"), handles);
+                ASSERT_EQ(handles.size(), 1u);
+                EXPECT_TRUE(handles[0].object() == obj);
+            }
+            translatorId = context->getTranslatorIdForPath(SdfPath("/root/rig"));
+            EXPECT_TRUE("schematype:ALMayaReference" == translatorId);
+            {
+                MObjectHandle handle;
+                context->getTransform(SdfPath("/root/rig"), handle);
+                EXPECT_TRUE(handle.object() == rigObj);
+            }
+
+            // renaming a node invalidates the serialised names
+            MFnDependencyNode(obj).setName("renamedCube");
+            EXPECT_TRUE(context->isBinarySerialisationDirty());
+
+            // truncated data is ignored as a whole
+            context->serialiseBinary(data);
+            data.setLength(data.length() - 1);
+            context->clearPrimMappings();
+            EXPECT_FALSE(context->deserialiseBinary(data));
+            EXPECT_TRUE(context->getTranslatorIdForPath(SdfPath("/root/rig")).empty());
+            EXPECT_FALSE(context->deserialiseBinary(MIntArray()));
+        }
+    }
+}
+
+namespace {
+// Create a stage of primCount meshes, in groups of a thousand, and return the meshes.
+std::vector<UsdPrim> createMeshStage(size_t primCount, UsdStageRefPtr& stage)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    {
+        SdfChangeBlock    changeBlock;
+        SdfPrimSpecHandle root = SdfPrimSpec::New(layer, "root", SdfSpecifierDef, "Xform");
+        SdfPrimSpecHandle group;
+        for (size_t i = 0; i < primCount; ++i) {
+            if (i % 1000 == 0) {
+                group = SdfPrimSpec::New(
+                    root, TfStringPrintf("group%zu", i / 1000), SdfSpecifierDef, "Xform");
+            }
+            SdfPrimSpec::New(group, TfStringPrintf("mesh%zu", i), SdfSpecifierDef, "Mesh");
+        }
+    }
+
+    stage = UsdStage::Open(layer);
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.GetTypeName() == "Mesh") {
+            prims.push_back(prim);
+        }
+    }
+    return prims;
+}
+} // namespace
+
+// void TranslatorContext::registerItem(const UsdPrim& prim, MObjectHandle object);
+// bool TranslatorContext::hasEntry(const SdfPath& path, const std::string& translatorId);
+TEST(TranslatorContext, primMappingLargeStage)
+{
+    UsdStageRefPtr             stage;
+    const std::vector<UsdPrim> prims = createMeshStage(10000, stage);
+    ASSERT_EQ(prims.size(), 10000u);
+
+    AL::usdmaya::fileio::translators::TranslatorContextPtr context
+        = AL::usdmaya::fileio::translators::TranslatorContext::create(nullptr);
+
+    // Register the meshes in reverse order, the mappings are kept sorted by path.
+    for (auto it = prims.rbegin(); it != prims.rend(); ++it) {
+        context->registerItem(*it, MObjectHandle());
+    }
+    // Registering a prim again keeps a single mapping.
+    context->registerItem(prims.front(), MObjectHandle());
+
+    for (const UsdPrim& prim : prims) {
+        ASSERT_TRUE(context->hasEntry(prim.GetPath(), "schematype:Mesh"));
+        ASSERT_FALSE(context->hasEntry(prim.GetPath(), "schematype:Xform"));
+        ASSERT_EQ(context->getTranslatorIdForPath(prim.GetPath()), "schematype:Mesh");
+    }
+
+    // The groups were not registered.
+    EXPECT_FALSE(context->hasEntry(SdfPath("/root/group0"), "schematype:Xform"));
+    EXPECT_FALSE(context->hasEntry(SdfPath("/root/group9"), "schematype:Xform"));
+    EXPECT_TRUE(context->getTranslatorIdForPath(SdfPath("/root/group0")).empty());
+    EXPECT_FALSE(context->hasEntry(SdfPath("/root/group0/mesh10000"), "schematype:Mesh"));
+}
+
+// Timing of the prim mappings on large stages. Disabled by default, run it with
+// --gtest_also_run_disabled_tests; the timings are recorded as test properties.
+TEST(TranslatorContext, DISABLED_primMappingBenchmark)
+{
+    for (size_t primCount : { 10000, 100000, 1000000 }) {
+        UsdStageRefPtr             stage;
+        const std::vector<UsdPrim> prims = createMeshStage(primCount, stage);
+        ASSERT_EQ(prims.size(), primCount);
+
+        AL::usdmaya::fileio::translators::TranslatorContextPtr context
+            = AL::usdmaya::fileio::translators::TranslatorContext::create(nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+        for (const UsdPrim& prim : prims) {
+            context->registerItem(prim, MObjectHandle());
+        }
+        const auto registration = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        size_t found = 0;
+        for (const UsdPrim& prim : prims) {
+            found += context->hasEntry(prim.GetPath(), "schematype:Mesh");
+        }
+        const auto lookup = std::chrono::steady_clock::now() - start;
+        EXPECT_EQ(found, primCount);
+
+        using std::chrono::milliseconds;
+        ::testing::Test::RecordProperty(
+            TfStringPrintf("register_ms_%zu", primCount),
+            int(std::chrono::duration_cast<milliseconds>(registration).count()));
+        ::testing::Test::RecordProperty(
+            TfStringPrintf("lookup_ms_%zu", primCount),
+            int(std::chrono::duration_cast<milliseconds>(lookup).count()));
     }
 }
 
-// TranslatorContext::~TranslatorContext();
 // void TranslatorContext::updatePrimTypes();
+// void ProxyShape::serialiseTranslatorContext();
+// void ProxyShape::deserialiseTranslatorContext();
+TEST(TranslatorContext, updatePrimTypesSerialisation)
+{
+    const MString     temp_ma_path = buildTempPath("AL_USDMayaTests_typeChangeCube.ma");
+    const std::string temp_path = buildTempPath("AL_USDMayaTests_typeChangeRig.usda");
+
+    const MString g_simpleRig = MString("#usda 1.0\n"
+                                        "\n"
+                                        "def Xform \"root\"\n"
+                                        "{\n"
+                                        "    def ALMayaReference \"rig\""
+                                        "    {\n"
+                                        "      asset mayaReference = \"")
+        + temp_ma_path
+        + "\"\n"
+          "      string mayaNamespace = \"cube\"\n"
+          "    }\n"
+          "}\n";
+
+    MFileIO::newFile(true);
+    MGlobal::executeCommand("polyCube -w 1 -h 1 -d 1 -sd 1 -sh 1 -sw 1", false, false);
+    MFileIO::saveAs(temp_ma_path, 0, true);
+    MFileIO::newFile(true);
+
+    {
+        std::ofstream os(temp_path);
+        os << g_simpleRig;
+    }
+
+    MFnDagNode fn;
+    MObject    xform = fn.create("transform");
+    fn.create("AL_usdmaya_ProxyShape", xform);
+
+    AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+    proxy->filePathPlug().setString(temp_path.c_str());
+
+    auto    stage = proxy->getUsdStage();
+    auto    context = proxy->context();
+    UsdPrim prim = stage->GetPrimAtPath(SdfPath("/root/rig"));
+    ASSERT_TRUE(prim);
+    EXPECT_EQ(
+        context->getTranslatorIdForPath(SdfPath("/root/rig")),
+        std::string("schematype:ALMayaReference"));
+
+    // save the context, so that the next save only re-encodes it if it changed
+    proxy->serialiseTranslatorContext();
+    EXPECT_FALSE(context->isBinarySerialisationDirty());
+
+    // change the type of the prim without letting the proxy shape translate it again
+    proxy->pauseUpdatesPlug().setBool(true);
+    prim.SetTypeName(TfToken("Xform"));
+    const std::string translatorId = proxy->translatorManufacture().generateTranslatorId(prim);
+    ASSERT_NE(translatorId, std::string("schematype:ALMayaReference"));
+
+    context->updatePrimTypes();
+    EXPECT_EQ(context->getTranslatorIdForPath(SdfPath("/root/rig")), translatorId);
+    EXPECT_TRUE(context->isBinarySerialisationDirty());
+
+    // save and reload the context, the new translator id must have been stored
+    proxy->serialiseTranslatorContext();
+    context->clearPrimMappings();
+    proxy->deserialiseTranslatorContext();
+    EXPECT_EQ(context->getTranslatorIdForPath(SdfPath("/root/rig")), translatorId);
+}
+
+// TranslatorContext::~TranslatorContext();
 // void TranslatorContext::registerItem(const UsdPrim& prim, MObjectHandle object);
 // void TranslatorContext::validatePrims();
 // bool TranslatorContext::hasEntry(const SdfPath& path, const TfToken& type);
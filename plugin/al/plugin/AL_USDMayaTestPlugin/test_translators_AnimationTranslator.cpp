@@ -13,9 +13,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include "AL/maya/utils/Utils.h"
 #include "AL/usdmaya/fileio/AnimationTranslator.h"
 #include "test_usdmaya.h"
 
+#include <pxr/usd/usdGeom/xformable.h>
+
+#include <maya/MAnimControl.h>
 #include <maya/MDGModifier.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFileIO.h>
@@ -27,6 +31,7 @@
 #include <maya/MPointArray.h>
 #include <maya/MSelectionList.h>
 
+using AL::maya::test::buildTempPath;
 using AL::usdmaya::fileio::AnimationTranslator;
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -235,6 +240,142 @@ TEST(translators_AnimationTranslator, animationDrivenIndirectPlug)
     mod.doIt();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TEST(translators_AnimationTranslator, drivingAnimCurve)
+{
+    MFileIO::newFile(true);
+    setUp();
+    MStatus status;
+
+    MFnDependencyNode fnb;
+    MObject           addDoubleLinear1 = fnb.create(m_addDoubleLinearNodeName, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+
+    MFnDependencyNode fnc;
+    MObject           addDoubleLinear2 = fnc.create(m_addDoubleLinearNodeName, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+
+    MFnAnimCurve fna;
+    MObject animCurve = fna.create(fnb.findPlug("input1"), MFnAnimCurve::kAnimCurveTL, 0, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+    fna.addKey(MTime(0.0), 1.0);
+    fna.addKey(MTime(2.0), 2.0);
+
+    // the curve can be evaluated directly, whether or not its input is connected to time
+    EXPECT_TRUE(AnimationTranslator::getDrivingAnimCurve(fnb.findPlug("input1")) == animCurve);
+    MDGModifier mod;
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.connect(m_outTime, fna.findPlug("input")));
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.doIt());
+    EXPECT_TRUE(AnimationTranslator::getDrivingAnimCurve(fnb.findPlug("input1")) == animCurve);
+
+    // unconnected plugs, and plugs driven through other nodes, have no driving curve
+    EXPECT_TRUE(AnimationTranslator::getDrivingAnimCurve(fnb.findPlug("input2")).isNull());
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.connect(fnb.findPlug("output"), fnc.findPlug("input1")));
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.doIt());
+    EXPECT_TRUE(AnimationTranslator::isAnimated(fnc.findPlug("input1"), true));
+    EXPECT_TRUE(AnimationTranslator::getDrivingAnimCurve(fnc.findPlug("input1")).isNull());
+
+    // a curve evaluated at a time other than the current time is not used directly
+    MFnDependencyNode fnd;
+    MObject           addDoubleLinear3 = fnd.create(m_addDoubleLinearNodeName, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.disconnect(m_outTime, fna.findPlug("input")));
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.connect(fnd.findPlug("output"), fna.findPlug("input")));
+    EXPECT_EQ(MStatus(MS::kSuccess), mod.doIt());
+    EXPECT_TRUE(AnimationTranslator::getDrivingAnimCurve(fnb.findPlug("input1")).isNull());
+
+    mod.deleteNode(addDoubleLinear3);
+    mod.deleteNode(addDoubleLinear2);
+    mod.deleteNode(addDoubleLinear1);
+    mod.deleteNode(animCurve);
+    mod.doIt();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(translators_AnimationTranslator, exportDrivingAnimCurve)
+{
+    MFileIO::newFile(true);
+    setUp();
+
+    // the channels are only keyframed against time, so they are exported from their anim curves
+    MGlobal::executeCommand(
+        "createNode transform -n animated;"
+        "setKeyframe -at tx -t 1 -v 0 animated;"
+        "setKeyframe -at tx -t 5 -v 3 animated;"
+        "setKeyframe -at rx -t 1 -v 0 animated;"
+        "setKeyframe -at rx -t 5 -v 90 animated;"
+        "setKeyframe -at ry -t 3 -v 45 animated;"
+        "setKeyframe -at sz -t 1 -v 1 animated;"
+        "setKeyframe -at sz -t 5 -v 2 animated;"
+        "select animated",
+        false,
+        true);
+
+    const std::string temp_path = buildTempPath("AL_USDMayaTests_exportDrivingAnimCurve.usda");
+    MString           exportCmd;
+    exportCmd.format(
+        MString("AL_usdmaya_ExportCommand -f \"^1s\" -sl 1 -frameRange 1 5 -subSamples 2"),
+        AL::maya::utils::convert(temp_path));
+    EXPECT_EQ(MStatus(MS::kSuccess), MGlobal::executeCommand(exportCmd, true));
+
+    UsdStageRefPtr stage = UsdStage::Open(temp_path);
+    ASSERT_TRUE(stage);
+    UsdGeomXformable xformable(stage->GetPrimAtPath(SdfPath("/animated")));
+    ASSERT_TRUE(xformable);
+
+    MSelectionList sl;
+    MObject        node;
+    sl.add("animated");
+    sl.getDependNode(0, node);
+    MFnDependencyNode fn(node);
+
+    // the rotation is authored in degrees, whereas the anim curve and the plug are in radians
+    const double radToDeg = 180.0 / M_PI;
+    UsdAttribute translateAttr, rotateAttr, scaleAttr;
+    bool         resetsXformStack;
+    for (const UsdGeomXformOp& op : xformable.GetOrderedXformOps(&resetsXformStack)) {
+        switch (op.GetOpType()) {
+        case UsdGeomXformOp::TypeTranslate: translateAttr = op.GetAttr(); break;
+        case UsdGeomXformOp::TypeRotateXYZ: rotateAttr = op.GetAttr(); break;
+        case UsdGeomXformOp::TypeScale: scaleAttr = op.GetAttr(); break;
+        default: break;
+        }
+    }
+    ASSERT_TRUE(translateAttr);
+    ASSERT_TRUE(rotateAttr);
+    ASSERT_TRUE(scaleAttr);
+
+    // compare the samples with the values of the plugs, stepping the timeline
+    const struct
+    {
+        UsdAttribute attr;
+        MPlug        plug;
+        double       scale;
+    } channels[] = { { translateAttr, fn.findPlug("translate"), 1.0 },
+                     { rotateAttr, fn.findPlug("rotate"), radToDeg },
+                     { scaleAttr, fn.findPlug("scale"), 1.0 } };
+
+    for (const auto& channel : channels) {
+        EXPECT_EQ(9u, channel.attr.GetNumTimeSamples());
+        for (double t = 1.0; t <= 5.0; t += 0.5) {
+            MAnimControl::setCurrentTime(MTime(t, MTime::uiUnit()));
+
+            VtValue value;
+            EXPECT_TRUE(channel.attr.Get(&value, UsdTimeCode(t)));
+            value = value.Cast<GfVec3d>();
+            ASSERT_TRUE(value.IsHolding<GfVec3d>());
+            const GfVec3d& sample = value.UncheckedGet<GfVec3d>();
+            for (uint32_t i = 0; i < 3; ++i) {
+                EXPECT_NEAR(channel.plug.child(i).asDouble() * channel.scale, sample[i], 1e-4);
+            }
+        }
+    }
+
+    VtValue rotate;
+    EXPECT_TRUE(rotateAttr.Get(&rotate, UsdTimeCode(5.0)));
+    EXPECT_NEAR(90.0, rotate.Cast<GfVec3d>().Get<GfVec3d>()[0], 1e-4);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 TEST(translators_AnimationTranslator, expressionDrivenPlug)
 {
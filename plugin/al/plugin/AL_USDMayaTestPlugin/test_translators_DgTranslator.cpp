@@ -25,25 +25,34 @@
 
 #include <maya/MAngle.h>
 #include <maya/MDGModifier.h>
+#include <maya/MFloatArray.h>
 #include <maya/MFloatMatrix.h>
 #include <maya/MFloatPoint.h>
 #include <maya/MFloatVector.h>
 #include <maya/MFnAttribute.h>
 #include <maya/MFnData.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MFnFloatArrayData.h>
+#include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnMatrixAttribute.h>
 #include <maya/MFnMatrixData.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnNumericData.h>
+#include <maya/MFnPointArrayData.h>
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MFnUnitAttribute.h>
+#include <maya/MFnVectorArrayData.h>
 #include <maya/MLibrary.h>
 #include <maya/MMatrix.h>
+#include <maya/MMatrixArray.h>
 #include <maya/MPoint.h>
+#include <maya/MPointArray.h>
 #include <maya/MStatus.h>
 #include <maya/MTime.h>
 #include <maya/MVector.h>
+#include <maya/MVectorArray.h>
 
+#include <chrono>
 #include <cstring>
 
 using AL::maya::test::buildTempPath;
@@ -110,6 +119,15 @@ MPlug findPlug(const char* name)
 
 MObject findAttribute(const char* name) { return findPlug(name).attribute(); }
 
+MObject
+addTypedAttribute(MObject node, const char* longName, const char* shortName, MFnData::Type type)
+{
+    MFnTypedAttribute fn;
+    MObject           attribute = fn.create(longName, shortName, type);
+    EXPECT_EQ(MStatus(MS::kSuccess), MFnDependencyNode(node).addAttribute(attribute));
+    return attribute;
+}
+
 /// \brief  A set of bit flags you can apply to an attribute
 enum AttributeFlags
 {
@@ -1185,6 +1203,217 @@ TEST(translators_DgNodeTranslator, matrix4x4d_array)
     delete[] result;
 }
 
+// static uint32_t getArrayDataLength(MObject node, MObject attr);
+// static MStatus getFloatArrayData(MObject node, MObject attr, float* values, size_t count);
+// static MStatus getFloatArray(MObject node, MObject attr, float* values, size_t count);
+TEST(translators_DgNodeTranslator, float_array_data)
+{
+    setUp();
+    MFloatArray orig(SIZE);
+    for (int i = 0; i < SIZE; ++i) {
+        orig[i] = randFloat();
+    }
+    const char* const longName = "longFloatArrayDataName";
+    MObject attribute = addTypedAttribute(m_node, longName, "lfadn", MFnData::kFloatArray);
+    MFnFloatArrayData fnData;
+    MObject origData = fnData.create(orig);
+    EXPECT_EQ(MStatus(MS::kSuccess), MPlug(m_node, attribute).setValue(origData));
+    EXPECT_EQ(uint32_t(SIZE), DgNodeTranslator::getArrayDataLength(m_node, attribute));
+
+    std::vector<float> result(SIZE);
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getFloatArrayData(m_node, attribute, result.data(), SIZE));
+    std::vector<float> container;
+    EXPECT_EQ(MStatus(MS::kSuccess), DgNodeTranslator::getFloatArray(m_node, attribute, container));
+    ASSERT_EQ(size_t(SIZE), container.size());
+    for (int i = 0; i < SIZE; ++i) {
+        EXPECT_EQ(orig[i], result[i]);
+        EXPECT_EQ(orig[i], container[i]);
+    }
+
+    // the buffer has to match the length of the data, and the data has to be of the requested type
+    EXPECT_FALSE(DgNodeTranslator::getFloatArrayData(m_node, attribute, result.data(), SIZE - 1));
+    EXPECT_FALSE(DgNodeTranslator::getVec3ArrayData(m_node, attribute, result.data(), SIZE / 3));
+}
+
+// static MStatus getVec3ArrayData(MObject node, MObject attr, float* values, size_t count);
+// static MStatus getVec3ArrayData(MObject node, MObject attr, double* values, size_t count);
+TEST(translators_DgNodeTranslator, vec3_array_data)
+{
+    setUp();
+    MPointArray  points(SIZE);
+    MVectorArray vectors(SIZE);
+    for (int i = 0; i < SIZE; ++i) {
+        points[i] = MPoint(randDouble(), randDouble(), randDouble());
+        vectors[i] = MVector(randDouble(), randDouble(), randDouble());
+    }
+    MObject pointAttribute
+        = addTypedAttribute(m_node, "longPointArrayDataName", "lpadn", MFnData::kPointArray);
+    MObject vectorAttribute
+        = addTypedAttribute(m_node, "longVectorArrayDataName", "lvadn", MFnData::kVectorArray);
+    MFnPointArrayData  fnPoints;
+    MFnVectorArrayData fnVectors;
+    MObject pointsData = fnPoints.create(points);
+    EXPECT_EQ(MStatus(MS::kSuccess), MPlug(m_node, pointAttribute).setValue(pointsData));
+    MObject vectorsData = fnVectors.create(vectors);
+    EXPECT_EQ(MStatus(MS::kSuccess), MPlug(m_node, vectorAttribute).setValue(vectorsData));
+
+    // one extra element, to make sure the w components are not written past the end of the data
+    std::vector<float>  pointsf(SIZE * 3 + 1, -1.0f), vectorsf(SIZE * 3);
+    std::vector<double> pointsd(SIZE * 3 + 1, -1.0), vectorsd(SIZE * 3);
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getVec3ArrayData(m_node, pointAttribute, pointsf.data(), SIZE));
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getVec3ArrayData(m_node, pointAttribute, pointsd.data(), SIZE));
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getVec3Array(m_node, vectorAttribute, vectorsf.data(), SIZE));
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getVec3Array(m_node, vectorAttribute, vectorsd.data(), SIZE));
+    for (int i = 0; i < SIZE; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_EQ(float(points[i][j]), pointsf[i * 3 + j]);
+            EXPECT_EQ(points[i][j], pointsd[i * 3 + j]);
+            EXPECT_EQ(float(vectors[i][j]), vectorsf[i * 3 + j]);
+            EXPECT_EQ(vectors[i][j], vectorsd[i * 3 + j]);
+        }
+    }
+    EXPECT_EQ(-1.0f, pointsf.back());
+    EXPECT_EQ(-1.0, pointsd.back());
+}
+
+// Reads a point array larger than the staging memory kept between reads, followed by a small one,
+// which must not see the memory released after the first read.
+TEST(translators_DgNodeTranslator, large_point_array_data)
+{
+    setUp();
+    const uint32_t largeCount = 100000;
+    MPointArray    largePoints(largeCount);
+    for (uint32_t i = 0; i < largeCount; ++i) {
+        largePoints[i] = MPoint(randDouble(), randDouble(), randDouble());
+    }
+    MPointArray smallPoints(SIZE);
+    for (int i = 0; i < SIZE; ++i) {
+        smallPoints[i] = MPoint(randDouble(), randDouble(), randDouble());
+    }
+    MObject largeAttribute
+        = addTypedAttribute(m_node, "largePointArrayData", "lgpad", MFnData::kPointArray);
+    MObject smallAttribute
+        = addTypedAttribute(m_node, "smallPointArrayData", "smpad", MFnData::kPointArray);
+    MFnPointArrayData fnPoints;
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        MPlug(m_node, largeAttribute).setValue(fnPoints.create(largePoints)));
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        MPlug(m_node, smallAttribute).setValue(fnPoints.create(smallPoints)));
+
+    std::vector<float> large(largeCount * 3), small(SIZE * 3);
+    for (int pass = 0; pass < 2; ++pass) {
+        EXPECT_EQ(
+            MStatus(MS::kSuccess),
+            DgNodeTranslator::getVec3ArrayData(m_node, largeAttribute, large.data(), largeCount));
+        EXPECT_EQ(
+            MStatus(MS::kSuccess),
+            DgNodeTranslator::getVec3ArrayData(m_node, smallAttribute, small.data(), SIZE));
+        for (uint32_t i = 0; i < largeCount; i += 997) {
+            EXPECT_EQ(float(largePoints[i].x), large[i * 3]);
+            EXPECT_EQ(float(largePoints[i].z), large[i * 3 + 2]);
+        }
+        for (int i = 0; i < SIZE; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                EXPECT_EQ(float(smallPoints[i][j]), small[i * 3 + j]);
+            }
+        }
+    }
+}
+
+// static MStatus getMatrix4x4ArrayData(MObject node, MObject attr, float* values, size_t count);
+// static MStatus getMatrix4x4ArrayData(MObject node, MObject attr, double* values, size_t count);
+TEST(translators_DgNodeTranslator, matrix4x4_array_data)
+{
+    setUp();
+    MMatrixArray orig(SIZE);
+    for (int i = 0; i < SIZE; ++i) {
+        for (int j = 0; j < 16; ++j) {
+            orig[i][j / 4][j % 4] = randDouble();
+        }
+    }
+    MObject attribute
+        = addTypedAttribute(m_node, "longMatrixArrayDataName", "lmadn", MFnData::kMatrixArray);
+    MFnMatrixArrayData fnData;
+    MObject origData = fnData.create(orig);
+    EXPECT_EQ(MStatus(MS::kSuccess), MPlug(m_node, attribute).setValue(origData));
+
+    std::vector<float>  resultf(SIZE * 16);
+    std::vector<double> resultd(SIZE * 16);
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getMatrix4x4Array(m_node, attribute, resultf.data(), SIZE));
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getMatrix4x4ArrayData(m_node, attribute, resultd.data(), SIZE));
+    for (int i = 0; i < SIZE; ++i) {
+        for (int j = 0; j < 16; ++j) {
+            EXPECT_EQ(float(orig[i][j / 4][j % 4]), resultf[i * 16 + j]);
+            EXPECT_EQ(orig[i][j / 4][j % 4], resultd[i * 16 + j]);
+        }
+    }
+}
+
+// Compares reading a multi float attribute one plug at a time, with reading the same values from
+// a float array attribute in bulk. Disabled by default, run it with
+// --gtest_also_run_disabled_tests; the timings are recorded as test properties.
+TEST(translators_DgNodeTranslator, DISABLED_array_data_benchmark)
+{
+    setUp();
+    const uint32_t count = 100000;
+    MFloatArray    orig(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        orig[i] = randFloat();
+    }
+    const uint32_t flags
+        = kCached | kReadable | kWritable | kStorable | kArray | kUsesArrayDataBuilder;
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        NodeHelper::addFloatAttr(m_node, "benchmarkMultiFloats", "bmf", 0.0f, flags));
+    MObject multiAttribute = findAttribute("benchmarkMultiFloats");
+    MObject typedAttribute
+        = addTypedAttribute(m_node, "benchmarkFloatArray", "bfa", MFnData::kFloatArray);
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::setFloatArray(m_node, multiAttribute, &orig[0], count));
+    MFnFloatArrayData fnData;
+    MObject origData = fnData.create(orig);
+    EXPECT_EQ(MStatus(MS::kSuccess), MPlug(m_node, typedAttribute).setValue(origData));
+
+    std::vector<float> perPlug(count), bulk(count);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getFloatArray(m_node, multiAttribute, perPlug.data(), count));
+    const auto perPlugTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(
+        MStatus(MS::kSuccess),
+        DgNodeTranslator::getFloatArrayData(m_node, typedAttribute, bulk.data(), count));
+    const auto bulkTime = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(perPlug, bulk);
+
+    using std::chrono::microseconds;
+    ::testing::Test::RecordProperty(
+        "per_plug_us", int(std::chrono::duration_cast<microseconds>(perPlugTime).count()));
+    ::testing::Test::RecordProperty(
+        "bulk_us", int(std::chrono::duration_cast<microseconds>(bulkTime).count()));
+}
+
 // static MStatus getStringArray(MObject node, MObject attr, std::string* values, size_t count);
 // static MStatus setStringArray(MObject node, MObject attr, const std::string* values, size_t
 // count);
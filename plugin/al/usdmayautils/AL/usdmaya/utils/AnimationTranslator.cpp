@@ -146,6 +146,33 @@ bool AnimationTranslator::isAnimated(MPlug attr, const bool assumeExpressionIsAn
     return false;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+MObject AnimationTranslator::getDrivingAnimCurve(const MPlug& plug)
+{
+    MPlugArray plugs;
+    if (!plug.connectedTo(plugs, true, false) || plugs.length() != 1) {
+        return MObject::kNullObj;
+    }
+
+    // time to time curves are left out, their values would need a unit conversion
+    MObject curveNode = plugs[0].node();
+    switch (curveNode.apiType()) {
+    case MFn::kAnimCurveTimeToAngular:
+    case MFn::kAnimCurveTimeToDistance:
+    case MFn::kAnimCurveTimeToUnitless: break;
+    default: return MObject::kNullObj;
+    }
+
+    // unless the input of the curve is driven by the time node, it is evaluated at a time other
+    // than the current time
+    MFnAnimCurve curve(curveNode);
+    MPlug        input = curve.findPlug("input", true);
+    if (input.isDestination() && !input.source().node().hasFn(MFn::kTime)) {
+        return MObject::kNullObj;
+    }
+    return curveNode;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool AnimationTranslator::isAnimatedMesh(const MDagPath& mesh)
 {
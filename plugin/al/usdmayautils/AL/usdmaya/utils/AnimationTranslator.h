@@ -130,6 +130,15 @@ public:
     AL_USDMAYA_UTILS_PUBLIC
     static bool isAnimated(MPlug attr, bool assumeExpressionIsAnimated = true);
 
+    /// \brief  returns the animCurve node that directly drives the plug, if the plug is keyframed
+    ///         against time. The values of the plug can then be computed by evaluating the curve,
+    ///         without changing the current time and evaluating the DG.
+    /// \param  plug the attribute to test
+    /// \return the animCurve node, or a null object if the plug is not driven by a single time
+    ///         based animCurve (e.g. driven keys, anim layers, expressions, ...)
+    AL_USDMAYA_UTILS_PUBLIC
+    static MObject getDrivingAnimCurve(const MPlug& plug);
+
     /// \brief  returns true if the mesh is animated
     /// \param  mesh the mesh to test
     /// \return true if the mesh was found to be animated
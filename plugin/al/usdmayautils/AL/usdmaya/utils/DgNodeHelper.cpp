@@ -21,24 +21,161 @@
 #include <usdUfe/utils/SIMD.h>
 
 #include <maya/MDGModifier.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
 #include <maya/MFloatMatrix.h>
 #include <maya/MFnCompoundAttribute.h>
 #include <maya/MFnDoubleArrayData.h>
 #include <maya/MFnFloatArrayData.h>
+#include <maya/MFnIntArrayData.h>
 #include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnMatrixData.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnNumericData.h>
+#include <maya/MFnPointArrayData.h>
 #include <maya/MFnTypedAttribute.h>
+#include <maya/MFnVectorArrayData.h>
+#include <maya/MIntArray.h>
 #include <maya/MMatrix.h>
 #include <maya/MMatrixArray.h>
 #include <maya/MObjectArray.h>
+#include <maya/MPointArray.h>
+#include <maya/MVectorArray.h>
 
 #include <iostream>
+#include <vector>
 
 using namespace UsdUfe; // used for typedefs from SIMD.h
 
+namespace {
+
+// Staging memory is handed out in whole blocks, so that every 4th double is 32 byte aligned
+struct alignas(32) StagingBlock
+{
+    double d[4];
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  scratch memory for at least count doubles. The memory belongs to the calling thread,
+///         and is reused by its next staging buffer, so converting arrays does not allocate each
+///         time. Memory above 1MB is released when the buffer goes out of scope, so that reading
+///         one very large array does not hold on to its memory for the lifetime of the thread.
+class StagingBuffer
+{
+public:
+    explicit StagingBuffer(const size_t count)
+    {
+        std::vector<StagingBlock>& blocks = pool();
+        const size_t               numBlocks = (count + 3) / 4;
+        if (blocks.size() < numBlocks) {
+            blocks.resize(numBlocks);
+        }
+        m_data = blocks.empty() ? nullptr : blocks.front().d;
+    }
+
+    ~StagingBuffer()
+    {
+        std::vector<StagingBlock>& blocks = pool();
+        if (blocks.size() > maxRetainedBlocks) {
+            std::vector<StagingBlock>().swap(blocks);
+        }
+    }
+
+    StagingBuffer(const StagingBuffer&) = delete;
+    StagingBuffer& operator=(const StagingBuffer&) = delete;
+
+    double* data() const { return m_data; }
+
+private:
+    static constexpr size_t maxRetainedBlocks = (1024 * 1024) / sizeof(StagingBlock);
+
+    static std::vector<StagingBlock>& pool()
+    {
+        thread_local std::vector<StagingBlock> blocks;
+        return blocks;
+    }
+
+    double* m_data;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts doubles read into a staging buffer to floats
+void convertDoublesToFloats(const double* const input, float* const output, const size_t count)
+{
+    size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+#ifdef __AVX__
+    for (const size_t count8 = count & ~size_t(7); i < count8; i += 8) {
+        const f128 lo = cvt4d_to_4f(load4d(input + i));
+        const f128 hi = cvt4d_to_4f(load4d(input + i + 4));
+        storeu8f(output + i, set8f(lo, hi));
+    }
+#endif
+    for (const size_t count4 = count & ~size_t(3); i < count4; i += 4) {
+        const f128 lo = cvt2d_to_2f(load2d(input + i));
+        const f128 hi = cvt2d_to_2f(load2d(input + i + 2));
+        storeu4f(output + i, movelh4f(lo, hi));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = float(input[i]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts the homogeneous points read into a staging buffer to float triples
+void convertPointsToVec3(const double* const input, float* const output, const size_t count)
+{
+    size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+    // each store also writes the w component, which the next point overwrites. The last point is
+    // left to the scalar loop so that nothing is written past the end of the output.
+    for (const size_t last = count ? count - 1 : 0; i < last; ++i) {
+        const double* const iptr = input + i * 4;
+#ifdef __AVX__
+        storeu4f(output + i * 3, cvt4d_to_4f(load4d(iptr)));
+#else
+        storeu4f(
+            output + i * 3, movelh4f(cvt2d_to_2f(load2d(iptr)), cvt2d_to_2f(load2d(iptr + 2))));
+#endif
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i * 3] = float(input[i * 4]);
+        output[i * 3 + 1] = float(input[i * 4 + 1]);
+        output[i * 3 + 2] = float(input[i * 4 + 2]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  strips the w component from the homogeneous points read into a staging buffer
+void convertPointsToVec3(const double* const input, double* const output, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const double* const iptr = input + i * 4;
+        double* const       optr = output + i * 3;
+#if AL_UTILS_ENABLE_SIMD
+        storeu2d(optr, load2d(iptr));
+#else
+        optr[0] = iptr[0];
+        optr[1] = iptr[1];
+#endif
+        optr[2] = iptr[2];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  gets the typed data held by a non multi attribute
+MStatus getArrayData(MObject node, MObject attribute, MObject& data)
+{
+    MPlug plug(node, attribute);
+    if (!plug || plug.isArray())
+        return MS::kFailure;
+    return plug.getValue(data);
+}
+
+} // namespace
+
 namespace AL {
 namespace usdmaya {
 namespace utils {
@@ -1517,8 +1654,10 @@ MStatus DgNodeHelper::getInt32Array(
     const size_t   count)
 {
     MPlug plug(node, attribute);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
+    if (!plug.isArray())
+        return getInt32ArrayData(node, attribute, values, count);
 
     uint32_t num = plug.numElements();
     if (num != count) {
@@ -1639,8 +1778,10 @@ MStatus DgNodeHelper::getFloatArray(
     const size_t count)
 {
     MPlug plug(node, attribute);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
+    if (!plug.isArray())
+        return getFloatArrayData(node, attribute, values, count);
 
     uint32_t num = plug.numElements();
     if (num != count) {
@@ -1769,8 +1910,10 @@ MStatus DgNodeHelper::getDoubleArray(
     const size_t  count)
 {
     MPlug plug(node, attribute);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
+    if (!plug.isArray())
+        return getDoubleArrayData(node, attribute, values, count);
 
     uint32_t num = plug.numElements();
     if (num != count) {
@@ -2103,8 +2246,10 @@ MStatus
 DgNodeHelper::getVec3Array(MObject node, MObject attribute, float* const values, const size_t count)
 {
     MPlug plug(node, attribute);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
+    if (!plug.isArray())
+        return getVec3ArrayData(node, attribute, values, count);
 
     uint32_t num = plug.numElements();
     if (num != count) {
@@ -2250,8 +2395,10 @@ MStatus DgNodeHelper::getVec3Array(
     const size_t  count)
 {
     MPlug plug(node, attribute);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
+    if (!plug.isArray())
+        return getVec3ArrayData(node, attribute, values, count);
 
     uint32_t num = plug.numElements();
     if (num != count) {
@@ -2980,43 +3127,7 @@ MStatus DgNodeHelper::getMatrix4x4Array(
 #endif
         }
     } else {
-        MObject value;
-        plug.getValue(value);
-        MFnMatrixArrayData fn(value);
-
-        for (uint32_t i = 0, n = fn.length(); i < n; ++i) {
-            float*  optr = values + i * 16;
-            double* iptr = &fn[i].matrix[0][0];
-#if AL_UTILS_ENABLE_SIMD
-#ifdef __AVX__
-            const f128 m0 = cvt4d_to_4f(loadu4d(iptr));
-            const f128 m1 = cvt4d_to_4f(loadu4d(iptr + 4));
-            const f128 m2 = cvt4d_to_4f(loadu4d(iptr + 8));
-            const f128 m3 = cvt4d_to_4f(loadu4d(iptr + 12));
-#else
-            const f128 m0a = cvt2d_to_2f(loadu2d(iptr));
-            const f128 m0b = cvt2d_to_2f(loadu2d(iptr + 2));
-            const f128 m1a = cvt2d_to_2f(loadu2d(iptr + 4));
-            const f128 m1b = cvt2d_to_2f(loadu2d(iptr + 6));
-            const f128 m2a = cvt2d_to_2f(loadu2d(iptr + 8));
-            const f128 m2b = cvt2d_to_2f(loadu2d(iptr + 10));
-            const f128 m3a = cvt2d_to_2f(loadu2d(iptr + 12));
-            const f128 m3b = cvt2d_to_2f(loadu2d(iptr + 14));
-            const f128 m0 = movelh4f(m0a, m0b);
-            const f128 m1 = movelh4f(m1a, m1b);
-            const f128 m2 = movelh4f(m2a, m2b);
-            const f128 m3 = movelh4f(m3a, m3b);
-#endif
-            storeu4f(optr, m0);
-            storeu4f(optr + 4, m1);
-            storeu4f(optr + 8, m2);
-            storeu4f(optr + 12, m3);
-#else
-            for (int k = 0; k < 16; ++k) {
-                optr[k] = iptr[k];
-            }
-#endif
-        }
+        return getMatrix4x4ArrayData(node, attribute, values, count);
     }
     return MS::kSuccess;
 }
@@ -3086,36 +3197,7 @@ MStatus DgNodeHelper::getMatrix4x4Array(
 #endif
         }
     } else {
-        MObject value;
-        plug.getValue(value);
-        MFnMatrixArrayData fn(value);
-
-        for (uint32_t i = 0, n = fn.length(); i < n; ++i) {
-            double* optr = values + i * 16;
-            double* iptr = &fn[i].matrix[0][0];
-
-#if AL_UTILS_ENABLE_SIMD
-#ifdef __AVX__
-            storeu4d(optr, loadu4d(iptr));
-            storeu4d(optr + 4, loadu4d(iptr + 4));
-            storeu4d(optr + 8, loadu4d(iptr + 8));
-            storeu4d(optr + 12, loadu4d(iptr + 12));
-#else
-            storeu2d(optr, loadu2d(iptr));
-            storeu2d(optr + 2, loadu2d(iptr + 2));
-            storeu2d(optr + 4, loadu2d(iptr + 4));
-            storeu2d(optr + 6, loadu2d(iptr + 6));
-            storeu2d(optr + 8, loadu2d(iptr + 8));
-            storeu2d(optr + 10, loadu2d(iptr + 10));
-            storeu2d(optr + 12, loadu2d(iptr + 12));
-            storeu2d(optr + 14, loadu2d(iptr + 14));
-#endif
-#else
-            for (uint32_t k = 0; k < 16; ++k) {
-                optr[k] = iptr[k];
-            }
-#endif
-        }
+        return getMatrix4x4ArrayData(node, attribute, values, count);
     }
 
     return MS::kSuccess;
@@ -4382,6 +4464,209 @@ MStatus DgNodeHelper::getStringArray(
     return MS::kSuccess;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t DgNodeHelper::getArrayDataLength(MObject node, MObject attribute)
+{
+    MObject data;
+    if (!getArrayData(node, attribute, data))
+        return 0;
+
+    switch (data.apiType()) {
+    case MFn::kFloatArrayData: return MFnFloatArrayData(data).length();
+    case MFn::kDoubleArrayData: return MFnDoubleArrayData(data).length();
+    case MFn::kIntArrayData: return MFnIntArrayData(data).length();
+    case MFn::kPointArrayData: return MFnPointArrayData(data).length();
+    case MFn::kVectorArrayData: return MFnVectorArrayData(data).length();
+    case MFn::kMatrixArrayData: return MFnMatrixArrayData(data).length();
+    default: break;
+    }
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getFloatArrayData(
+    MObject      node,
+    MObject      attribute,
+    float* const values,
+    const size_t count)
+{
+    const char* const errorString = "DgNodeHelper::getFloatArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+    MStatus           status;
+    MFnFloatArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MFloatArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    return array.get(values);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getDoubleArrayData(
+    MObject       node,
+    MObject       attribute,
+    double* const values,
+    const size_t  count)
+{
+    const char* const errorString = "DgNodeHelper::getDoubleArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+    MStatus            status;
+    MFnDoubleArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MDoubleArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    return array.get(values);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getInt32ArrayData(
+    MObject        node,
+    MObject        attribute,
+    int32_t* const values,
+    const size_t   count)
+{
+    const char* const errorString = "DgNodeHelper::getInt32ArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+    MStatus         status;
+    MFnIntArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MIntArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    return array.get(values);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getVec3ArrayData(
+    MObject      node,
+    MObject      attribute,
+    float* const values,
+    const size_t count)
+{
+    const char* const errorString = "DgNodeHelper::getVec3ArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+
+    if (data.apiType() == MFn::kVectorArrayData) {
+        // MVectorArray can hand back its contents as float triples, so no staging is needed
+        const MVectorArray array = MFnVectorArrayData(data).array();
+        if (array.length() != count) {
+            MGlobal::displayError("array is sized incorrectly");
+            return MS::kFailure;
+        }
+        return array.get(reinterpret_cast<float(*)[3]>(values));
+    }
+
+    MStatus           status;
+    MFnPointArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MPointArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    const StagingBuffer points(count * 4);
+    AL_MAYA_CHECK_ERROR(array.get(reinterpret_cast<double(*)[4]>(points.data())), errorString);
+    convertPointsToVec3(points.data(), values, count);
+    return MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getVec3ArrayData(
+    MObject       node,
+    MObject       attribute,
+    double* const values,
+    const size_t  count)
+{
+    const char* const errorString = "DgNodeHelper::getVec3ArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+
+    if (data.apiType() == MFn::kVectorArrayData) {
+        const MVectorArray array = MFnVectorArrayData(data).array();
+        if (array.length() != count) {
+            MGlobal::displayError("array is sized incorrectly");
+            return MS::kFailure;
+        }
+        return array.get(reinterpret_cast<double(*)[3]>(values));
+    }
+
+    MStatus           status;
+    MFnPointArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MPointArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    const StagingBuffer points(count * 4);
+    AL_MAYA_CHECK_ERROR(array.get(reinterpret_cast<double(*)[4]>(points.data())), errorString);
+    convertPointsToVec3(points.data(), values, count);
+    return MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getMatrix4x4ArrayData(
+    MObject      node,
+    MObject      attribute,
+    float* const values,
+    const size_t count)
+{
+    const char* const errorString = "DgNodeHelper::getMatrix4x4ArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+    MStatus            status;
+    MFnMatrixArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MMatrixArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    const StagingBuffer matrices(count * 16);
+    AL_MAYA_CHECK_ERROR(array.get(reinterpret_cast<double(*)[4][4]>(matrices.data())), errorString);
+    convertDoublesToFloats(matrices.data(), values, count * 16);
+    return MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::getMatrix4x4ArrayData(
+    MObject       node,
+    MObject       attribute,
+    double* const values,
+    const size_t  count)
+{
+    const char* const errorString = "DgNodeHelper::getMatrix4x4ArrayData error";
+    MObject           data;
+    AL_MAYA_CHECK_ERROR(getArrayData(node, attribute, data), errorString);
+    MStatus            status;
+    MFnMatrixArrayData fn(data, &status);
+    AL_MAYA_CHECK_ERROR(status, errorString);
+
+    const MMatrixArray array = fn.array();
+    if (array.length() != count) {
+        MGlobal::displayError("array is sized incorrectly");
+        return MS::kFailure;
+    }
+    return array.get(reinterpret_cast<double(*)[4][4]>(values));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus DgNodeHelper::addStringValue(
     MObject           node,
@@ -5467,14 +5752,55 @@ DgNodeHelper::copyDynamicAttributes(MObject node, UsdPrim& prim, AnimationTransl
                     }
                 } break;
 
+                case MFnData::kFloatArray: {
+                    UsdAttribute usdAttr
+                        = prim.CreateAttribute(attributeName, SdfValueTypeNames->FloatArray);
+                    VtArray<float> value;
+                    value.resize(getArrayDataLength(node, attribute));
+                    getFloatArrayData(node, attribute, value.data(), value.size());
+                    usdAttr.Set(value);
+                    usdAttr.SetCustom(true);
+                } break;
+
+                case MFnData::kDoubleArray: {
+                    UsdAttribute usdAttr
+                        = prim.CreateAttribute(attributeName, SdfValueTypeNames->DoubleArray);
+                    VtArray<double> value;
+                    value.resize(getArrayDataLength(node, attribute));
+                    getDoubleArrayData(node, attribute, value.data(), value.size());
+                    usdAttr.Set(value);
+                    usdAttr.SetCustom(true);
+                } break;
+
+                case MFnData::kIntArray: {
+                    UsdAttribute usdAttr
+                        = prim.CreateAttribute(attributeName, SdfValueTypeNames->IntArray);
+                    VtArray<int> value;
+                    value.resize(getArrayDataLength(node, attribute));
+                    getInt32ArrayData(node, attribute, value.data(), value.size());
+                    usdAttr.Set(value);
+                    usdAttr.SetCustom(true);
+                } break;
+
+                case MFnData::kPointArray:
+                case MFnData::kVectorArray: {
+                    UsdAttribute usdAttr = prim.CreateAttribute(
+                        attributeName,
+                        type == MFnData::kPointArray ? SdfValueTypeNames->Point3dArray
+                                                     : SdfValueTypeNames->Vector3dArray);
+                    VtArray<GfVec3d> value;
+                    value.resize(getArrayDataLength(node, attribute));
+                    getVec3ArrayData(node, attribute, (double*)value.data(), value.size());
+                    usdAttr.Set(value);
+                    usdAttr.SetCustom(true);
+                } break;
+
                 case MFnData::kMatrixArray: {
-                    MFnMatrixArrayData fnData(plug.asMObject());
-                    UsdAttribute       usdAttr
+                    UsdAttribute usdAttr
                         = prim.CreateAttribute(attributeName, SdfValueTypeNames->Matrix4dArray);
                     VtArray<GfMatrix4d> m;
-                    m.assign(
-                        (const GfMatrix4d*)&fnData.array()[0],
-                        ((const GfMatrix4d*)&fnData.array()[0]) + fnData.array().length());
+                    m.resize(getArrayDataLength(node, attribute));
+                    getMatrix4x4ArrayData(node, attribute, (double*)m.data(), m.size());
                     usdAttr.Set(m);
                     usdAttr.SetCustom(true);
                 } break;
@@ -5698,25 +6024,23 @@ DgNodeHelper::copyDynamicAttributes(MObject node, UsdPrim& prim, AnimationTransl
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void DgNodeHelper::copySimpleValue(
-    const MPlug&       plug,
-    UsdAttribute&      usdAttr,
-    const UsdTimeCode& timeCode)
+VtValue DgNodeHelper::getSimpleValue(const MPlug& plug, const UsdDataType type)
 {
     MObject node = plug.node();
     MObject attribute = plug.attribute();
     bool    isArray = plug.isArray();
-    switch (getAttributeType(usdAttr)) {
+    VtValue result;
+    switch (type) {
     case UsdDataType::kUChar:
         if (!isArray) {
             int8_t value;
             getInt8(node, attribute, value);
-            usdAttr.Set(uint8_t(value), timeCode);
+            result = uint8_t(value);
         } else {
             VtArray<uint8_t> m;
             m.resize(plug.numElements());
             getInt8Array(node, attribute, (int8_t*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5724,12 +6048,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             int32_t value;
             getInt32(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<int32_t> m;
             m.resize(plug.numElements());
             getInt32Array(node, attribute, (int32_t*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5737,12 +6061,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             int32_t value;
             getInt32(node, attribute, value);
-            usdAttr.Set(uint32_t(value), timeCode);
+            result = uint32_t(value);
         } else {
             VtArray<uint32_t> m;
             m.resize(plug.numElements());
             getInt32Array(node, attribute, (int32_t*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5750,12 +6074,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             int64_t value;
             getInt64(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<int64_t> m;
             m.resize(plug.numElements());
             getInt64Array(node, attribute, (int64_t*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5763,12 +6087,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             int64_t value;
             getInt64(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<int64_t> m;
             m.resize(plug.numElements());
             getInt64Array(node, attribute, (int64_t*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5776,12 +6100,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             float value;
             getFloat(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<float> m;
             m.resize(plug.numElements());
             getFloatArray(node, attribute, (float*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5789,12 +6113,12 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             double value;
             getDouble(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<double> m;
             m.resize(plug.numElements());
             getDoubleArray(node, attribute, (double*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -5802,44 +6126,55 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             GfHalf value;
             getHalf(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
         } else {
             VtArray<GfHalf> m;
             m.resize(plug.numElements());
             getHalfArray(node, attribute, (GfHalf*)m.data(), m.size());
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
     default: break;
     }
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void DgNodeHelper::copyAttributeValue(
+void DgNodeHelper::copySimpleValue(
     const MPlug&       plug,
     UsdAttribute&      usdAttr,
     const UsdTimeCode& timeCode)
+{
+    const VtValue value = getSimpleValue(plug, getAttributeType(usdAttr));
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue DgNodeHelper::getAttributeValue(const MPlug& plug, const UsdDataType type)
 {
     MObject node = plug.node();
     MObject attribute = plug.attribute();
     bool    isArray = plug.isArray();
+    VtValue result;
     switch (attribute.apiType()) {
     case MFn::kAttribute2Double:
     case MFn::kAttribute2Float:
     case MFn::kAttribute2Int:
     case MFn::kAttribute2Short: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec2d:
             if (!isArray) {
                 GfVec2d m;
                 getVec2(node, attribute, (double*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2d> m;
                 m.resize(plug.numElements());
                 getVec2Array(node, attribute, (double*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5847,12 +6182,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec2f m;
                 getVec2(node, attribute, (float*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2f> m;
                 m.resize(plug.numElements());
                 getVec2Array(node, attribute, (float*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5860,12 +6195,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec2i m;
                 getVec2(node, attribute, (int*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2i> m;
                 m.resize(plug.numElements());
                 getVec2Array(node, attribute, (int*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5873,12 +6208,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec2h m;
                 getVec2(node, attribute, (GfHalf*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2h> m;
                 m.resize(plug.numElements());
                 getVec2Array(node, attribute, (GfHalf*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5890,17 +6225,17 @@ void DgNodeHelper::copyAttributeValue(
     case MFn::kAttribute3Float:
     case MFn::kAttribute3Long:
     case MFn::kAttribute3Short: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec3d:
             if (!isArray) {
                 GfVec3d m;
                 getVec3(node, attribute, (double*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3d> m;
                 m.resize(plug.numElements());
                 getVec3Array(node, attribute, (double*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5908,12 +6243,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec3f m;
                 getVec3(node, attribute, (float*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3f> m;
                 m.resize(plug.numElements());
                 getVec3Array(node, attribute, (float*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5921,12 +6256,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec3i m;
                 getVec3(node, attribute, (int*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3i> m;
                 m.resize(plug.numElements());
                 getVec3Array(node, attribute, (int*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5934,12 +6269,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec3h m;
                 getVec3(node, attribute, (GfHalf*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3h> m;
                 m.resize(plug.numElements());
                 getVec3Array(node, attribute, (GfHalf*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5948,17 +6283,17 @@ void DgNodeHelper::copyAttributeValue(
     } break;
 
     case MFn::kAttribute4Double: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec4d:
             if (!isArray) {
                 GfVec4d m;
                 getVec4(node, attribute, (double*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4d> m;
                 m.resize(plug.numElements());
                 getVec4Array(node, attribute, (double*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5966,12 +6301,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec4f m;
                 getVec4(node, attribute, (float*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4f> m;
                 m.resize(plug.numElements());
                 getVec4Array(node, attribute, (float*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5979,12 +6314,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec4i m;
                 getVec4(node, attribute, (int*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4i> m;
                 m.resize(plug.numElements());
                 getVec4Array(node, attribute, (int*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -5992,12 +6327,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 GfVec4h m;
                 getVec4(node, attribute, (GfHalf*)&m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4h> m;
                 m.resize(plug.numElements());
                 getVec4Array(node, attribute, (GfHalf*)m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6012,12 +6347,12 @@ void DgNodeHelper::copyAttributeValue(
             if (!isArray) {
                 bool value;
                 getBool(node, attribute, value);
-                usdAttr.Set(value, timeCode);
+                result = value;
             } else {
                 VtArray<bool> m;
                 m.resize(plug.numElements());
                 getUsdBoolArray(node, attribute, m);
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
         } break;
 
@@ -6028,7 +6363,7 @@ void DgNodeHelper::copyAttributeValue(
         case MFnNumericData::kInt64:
         case MFnNumericData::kByte:
         case MFnNumericData::kChar: {
-            copySimpleValue(plug, usdAttr, timeCode);
+            result = getSimpleValue(plug, type);
         } break;
 
         default: {
@@ -6041,21 +6376,21 @@ void DgNodeHelper::copyAttributeValue(
     case MFn::kDoubleAngleAttribute:
     case MFn::kDoubleLinearAttribute:
     case MFn::kFloatLinearAttribute: {
-        copySimpleValue(plug, usdAttr, timeCode);
+        result = getSimpleValue(plug, type);
     } break;
 
     case MFn::kEnumAttribute: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kInt: {
             if (!isArray) {
                 int32_t value;
                 getInt32(node, attribute, value);
-                usdAttr.Set(value, timeCode);
+                result = value;
             } else {
                 VtArray<int> m;
                 m.resize(plug.numElements());
                 getInt32Array(node, attribute, m.data(), m.size());
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
         } break;
         default: {
@@ -6071,16 +6406,55 @@ void DgNodeHelper::copyAttributeValue(
         case MFnData::kString: {
             std::string value;
             getString(node, attribute, value);
-            usdAttr.Set(value, timeCode);
+            result = value;
+        } break;
+
+        case MFnData::kFloatArray: {
+            VtArray<float> value;
+            value.resize(getArrayDataLength(node, attribute));
+            getFloatArrayData(node, attribute, value.data(), value.size());
+            result = value;
+        } break;
+
+        case MFnData::kDoubleArray: {
+            VtArray<double> value;
+            value.resize(getArrayDataLength(node, attribute));
+            getDoubleArrayData(node, attribute, value.data(), value.size());
+            result = value;
+        } break;
+
+        case MFnData::kIntArray: {
+            VtArray<int> value;
+            value.resize(getArrayDataLength(node, attribute));
+            getInt32ArrayData(node, attribute, value.data(), value.size());
+            result = value;
+        } break;
+
+        case MFnData::kPointArray:
+        case MFnData::kVectorArray: {
+            switch (type) {
+            case UsdDataType::kVec3f: {
+                VtArray<GfVec3f> value;
+                value.resize(getArrayDataLength(node, attribute));
+                getVec3ArrayData(node, attribute, (float*)value.data(), value.size());
+                result = value;
+            } break;
+            case UsdDataType::kVec3d: {
+                VtArray<GfVec3d> value;
+                value.resize(getArrayDataLength(node, attribute));
+                getVec3ArrayData(node, attribute, (double*)value.data(), value.size());
+                result = value;
+            } break;
+            default: {
+            } break;
+            }
         } break;
 
         case MFnData::kMatrixArray: {
-            MFnMatrixArrayData  fnData(plug.asMObject());
             VtArray<GfMatrix4d> m;
-            m.assign(
-                (const GfMatrix4d*)&fnData.array()[0],
-                ((const GfMatrix4d*)&fnData.array()[0]) + fnData.array().length());
-            usdAttr.Set(m, timeCode);
+            m.resize(getArrayDataLength(node, attribute));
+            getMatrix4x4ArrayData(node, attribute, (double*)m.data(), m.size());
+            result = m;
         } break;
 
         default: {
@@ -6111,13 +6485,13 @@ void DgNodeHelper::copyAttributeValue(
                             if (!isArray) {
                                 GfMatrix2d value;
                                 getMatrix2x2(node, attribute, (double*)&value);
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             } else {
                                 VtArray<GfMatrix2d> value;
                                 value.resize(plug.numElements());
                                 getMatrix2x2Array(
                                     node, attribute, (double*)value.data(), plug.numElements());
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             }
                         }
                     }
@@ -6155,13 +6529,13 @@ void DgNodeHelper::copyAttributeValue(
                             if (!isArray) {
                                 GfMatrix3d value;
                                 getMatrix3x3(node, attribute, (double*)&value);
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             } else {
                                 VtArray<GfMatrix3d> value;
                                 value.resize(plug.numElements());
                                 getMatrix3x3Array(
                                     node, attribute, (double*)value.data(), plug.numElements());
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             }
                         }
                     }
@@ -6188,12 +6562,12 @@ void DgNodeHelper::copyAttributeValue(
                             if (!isArray) {
                                 GfVec4i value;
                                 getVec4(node, attribute, (int32_t*)&value);
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             } else {
                                 VtArray<GfVec4i> value;
                                 value.resize(plug.numElements());
                                 getVec4Array(node, attribute, (int32_t*)value.data(), value.size());
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             }
                         } break;
 
@@ -6201,12 +6575,12 @@ void DgNodeHelper::copyAttributeValue(
                             if (!isArray) {
                                 GfVec4f value;
                                 getVec4(node, attribute, (float*)&value);
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             } else {
                                 VtArray<GfVec4f> value;
                                 value.resize(plug.numElements());
                                 getVec4Array(node, attribute, (float*)value.data(), value.size());
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             }
                         } break;
 
@@ -6214,12 +6588,12 @@ void DgNodeHelper::copyAttributeValue(
                             if (!isArray) {
                                 GfVec4d value;
                                 getVec4(node, attribute, (double*)&value);
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             } else {
                                 VtArray<GfVec4d> value;
                                 value.resize(plug.numElements());
                                 getVec4Array(node, attribute, (double*)value.data(), value.size());
-                                usdAttr.Set(value, timeCode);
+                                result = value;
                             }
                         } break;
 
@@ -6236,35 +6610,46 @@ void DgNodeHelper::copyAttributeValue(
         if (!isArray) {
             GfMatrix4d m;
             getMatrix4x4(node, attribute, (double*)&m);
-            usdAttr.Set(m, timeCode);
+            result = m;
         } else {
             VtArray<GfMatrix4d> value;
             value.resize(plug.numElements());
             getMatrix4x4Array(node, attribute, (double*)value.data(), value.size());
-            usdAttr.Set(value, timeCode);
+            result = value;
         }
     } break;
 
     default: break;
     }
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void DgNodeHelper::copySimpleValue(
+void DgNodeHelper::copyAttributeValue(
     const MPlug&       plug,
     UsdAttribute&      usdAttr,
-    const float        scale,
     const UsdTimeCode& timeCode)
+{
+    const VtValue value = getAttributeValue(plug, getAttributeType(usdAttr));
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue
+DgNodeHelper::getSimpleValue(const MPlug& plug, const UsdDataType type, const float scale)
 {
     MObject node = plug.node();
     MObject attribute = plug.attribute();
     bool    isArray = plug.isArray();
-    switch (getAttributeType(usdAttr)) {
+    VtValue result;
+    switch (type) {
     case UsdDataType::kFloat:
         if (!isArray) {
             float value;
             getFloat(node, attribute, value);
-            usdAttr.Set(value * scale, timeCode);
+            result = value * scale;
         } else {
             VtArray<float> m;
             m.resize(plug.numElements());
@@ -6272,7 +6657,7 @@ void DgNodeHelper::copySimpleValue(
             for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                 *it *= scale;
             }
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
@@ -6280,7 +6665,7 @@ void DgNodeHelper::copySimpleValue(
         if (!isArray) {
             double value;
             getDouble(node, attribute, value);
-            usdAttr.Set(value * scale, timeCode);
+            result = value * scale;
         } else {
             VtArray<double> m;
             m.resize(plug.numElements());
@@ -6289,36 +6674,48 @@ void DgNodeHelper::copySimpleValue(
             for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                 *it *= temp;
             }
-            usdAttr.Set(m, timeCode);
+            result = m;
         }
         break;
 
     default: break;
     }
+    return result;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void DgNodeHelper::copyAttributeValue(
+void DgNodeHelper::copySimpleValue(
     const MPlug&       plug,
     UsdAttribute&      usdAttr,
     const float        scale,
     const UsdTimeCode& timeCode)
+{
+    const VtValue value = getSimpleValue(plug, getAttributeType(usdAttr), scale);
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+VtValue
+DgNodeHelper::getAttributeValue(const MPlug& plug, const UsdDataType type, const float scale)
 {
     MObject node = plug.node();
     MObject attribute = plug.attribute();
     bool    isArray = plug.isArray();
+    VtValue result;
     switch (attribute.apiType()) {
     case MFn::kAttribute2Double:
     case MFn::kAttribute2Float:
     case MFn::kAttribute2Int:
     case MFn::kAttribute2Short: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec2d:
             if (!isArray) {
                 GfVec2d m;
                 getVec2(node, attribute, (double*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2d> m;
                 m.resize(plug.numElements());
@@ -6327,7 +6724,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= temp;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6336,7 +6733,7 @@ void DgNodeHelper::copyAttributeValue(
                 GfVec2f m;
                 getVec2(node, attribute, (float*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec2f> m;
                 m.resize(plug.numElements());
@@ -6344,7 +6741,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= scale;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6356,13 +6753,13 @@ void DgNodeHelper::copyAttributeValue(
     case MFn::kAttribute3Float:
     case MFn::kAttribute3Long:
     case MFn::kAttribute3Short: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec3d:
             if (!isArray) {
                 GfVec3d m;
                 getVec3(node, attribute, (double*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3d> m;
                 m.resize(plug.numElements());
@@ -6371,7 +6768,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= temp;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6380,7 +6777,7 @@ void DgNodeHelper::copyAttributeValue(
                 GfVec3f m;
                 getVec3(node, attribute, (float*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec3f> m;
                 m.resize(plug.numElements());
@@ -6388,7 +6785,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= scale;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6397,13 +6794,13 @@ void DgNodeHelper::copyAttributeValue(
     } break;
 
     case MFn::kAttribute4Double: {
-        switch (getAttributeType(usdAttr)) {
+        switch (type) {
         case UsdDataType::kVec4d:
             if (!isArray) {
                 GfVec4d m;
                 getVec4(node, attribute, (double*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4d> m;
                 m.resize(plug.numElements());
@@ -6412,7 +6809,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= temp;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6421,7 +6818,7 @@ void DgNodeHelper::copyAttributeValue(
                 GfVec4f m;
                 getVec4(node, attribute, (float*)&m);
                 m *= scale;
-                usdAttr.Set(m, timeCode);
+                result = m;
             } else {
                 VtArray<GfVec4f> m;
                 m.resize(plug.numElements());
@@ -6429,7 +6826,7 @@ void DgNodeHelper::copyAttributeValue(
                 for (auto it = m.begin(), e = m.end(); it != e; ++it) {
                     *it *= scale;
                 }
-                usdAttr.Set(m, timeCode);
+                result = m;
             }
             break;
 
@@ -6447,7 +6844,7 @@ void DgNodeHelper::copyAttributeValue(
         case MFnNumericData::kInt64:
         case MFnNumericData::kByte:
         case MFnNumericData::kChar: {
-            copySimpleValue(plug, usdAttr, scale, timeCode);
+            result = getSimpleValue(plug, type, scale);
         } break;
 
         default: {
@@ -6460,11 +6857,25 @@ void DgNodeHelper::copyAttributeValue(
     case MFn::kDoubleAngleAttribute:
     case MFn::kDoubleLinearAttribute:
     case MFn::kFloatLinearAttribute: {
-        copySimpleValue(plug, usdAttr, scale, timeCode);
+        result = getSimpleValue(plug, type, scale);
     } break;
 
     default: break;
     }
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void DgNodeHelper::copyAttributeValue(
+    const MPlug&       plug,
+    UsdAttribute&      usdAttr,
+    const float        scale,
+    const UsdTimeCode& timeCode)
+{
+    const VtValue value = getAttributeValue(plug, getAttributeType(usdAttr), scale);
+    if (!value.IsEmpty()) {
+        usdAttr.Set(value, timeCode);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
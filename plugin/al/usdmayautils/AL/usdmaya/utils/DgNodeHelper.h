@@ -20,6 +20,7 @@
 #include "AL/usdmaya/utils/Api.h"
 #include "AL/usdmaya/utils/AttributeType.h"
 
+#include <pxr/base/vt/value.h>
 #include <pxr/usd/usdGeom/xformOp.h>
 
 #include <maya/MAngle.h>
@@ -454,6 +455,93 @@ public:
     AL_USDMAYA_UTILS_PUBLIC
     static MStatus getStringArray(MObject node, MObject attr, std::string* values, size_t count);
 
+    //--------------------------------------------------------------------------------------------------------------------
+    /// \name   Methods to get array data from typed array attributes
+    /// \brief  These read the whole MFnFloatArrayData, MFnDoubleArrayData, MFnIntArrayData,
+    ///         MFnPointArrayData, MFnVectorArrayData or MFnMatrixArrayData held by a (non multi)
+    ///         typed attribute in one go, rather than walking the elements one plug at a time.
+    ///         Where the Maya data has to be converted (doubles to floats, or the homogeneous
+    ///         points to 3D vectors), it is copied into an aligned staging buffer that is reused
+    ///         by each thread, and converted from there with SIMD. getFloatArray, getDoubleArray,
+    ///         getInt32Array, getVec3Array and getMatrix4x4Array forward to these when the
+    ///         attribute is not a multi.
+    //--------------------------------------------------------------------------------------------------------------------
+
+    /// \brief  returns the number of elements in the typed array data held by the attribute
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \return the number of floats, doubles, ints, points, vectors or matrices in the array data,
+    ///         or zero if the attribute does not hold any typed array data
+    AL_USDMAYA_UTILS_PUBLIC
+    static uint32_t getArrayDataLength(MObject node, MObject attr);
+
+    /// \brief  retrieve the float values from an MFnData::kFloatArray attribute
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of elements in the buffer.
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus getFloatArrayData(MObject node, MObject attr, float* values, size_t count);
+
+    /// \brief  retrieve the double values from an MFnData::kDoubleArray attribute
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of elements in the buffer.
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus getDoubleArrayData(MObject node, MObject attr, double* values, size_t count);
+
+    /// \brief  retrieve the integer values from an MFnData::kIntArray attribute
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of elements in the buffer.
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus getInt32ArrayData(MObject node, MObject attr, int32_t* values, size_t count);
+
+    /// \brief  retrieve the xyz values from an MFnData::kPointArray or MFnData::kVectorArray
+    ///         attribute, converted to floats. The w component of the points is discarded.
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of points in the buffer (values should be 3x this size)
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus getVec3ArrayData(MObject node, MObject attr, float* values, size_t count);
+
+    /// \brief  retrieve the xyz values from an MFnData::kPointArray or MFnData::kVectorArray
+    ///         attribute. The w component of the points is discarded.
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of points in the buffer (values should be 3x this size)
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus getVec3ArrayData(MObject node, MObject attr, double* values, size_t count);
+
+    /// \brief  retrieve the matrices from an MFnData::kMatrixArray attribute, converted to floats
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of matrices in the buffer (values should be 16x this size)
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus
+    getMatrix4x4ArrayData(MObject node, MObject attr, float* values, size_t count);
+
+    /// \brief  retrieve the matrices from an MFnData::kMatrixArray attribute
+    /// \param  node the maya node on which the attribute you are interested in exists
+    /// \param  attr the handle to the typed array attribute
+    /// \param  values a pointer to a pre-allocated buffer to fill with the attribute values
+    /// \param  count the number of matrices in the buffer (values should be 16x this size)
+    /// \return MS::kSuccess if ok
+    AL_USDMAYA_UTILS_PUBLIC
+    static MStatus
+    getMatrix4x4ArrayData(MObject node, MObject attr, double* values, size_t count);
+
     //--------------------------------------------------------------------------------------------------------------------
     /// \name   Methods to get single values from non array attributes
     //--------------------------------------------------------------------------------------------------------------------
@@ -1779,6 +1867,40 @@ public:
     static MStatus
     copyDynamicAttributes(MObject node, UsdPrim& prim, AnimationTranslator* translator = 0);
 
+    /// \brief  read the current value of the plug specified, converted to the given USD data type.
+    ///         This does not access USD, so the value can be authored later on (as the animation
+    ///         export does, while Maya evaluates the next frame).
+    /// \param  plug the attribute to read
+    /// \param  type the type of the USD attribute the value is intended for
+    /// \return the value, or an empty value if the attribute/type combination is not supported
+    AL_USDMAYA_UTILS_PUBLIC
+    static VtValue getAttributeValue(const MPlug& plug, UsdDataType type);
+
+    /// \brief  read the current value of the plug specified, converted to the given USD data type,
+    ///         and scaled.
+    /// \param  plug the attribute to read
+    /// \param  type the type of the USD attribute the value is intended for
+    /// \param  scale a scaling factor to apply (to convert units)
+    /// \return the value, or an empty value if the attribute/type combination is not supported
+    AL_USDMAYA_UTILS_PUBLIC
+    static VtValue getAttributeValue(const MPlug& plug, UsdDataType type, float scale);
+
+    /// \brief  read the current value of a numeric plug, converted to the given USD data type.
+    /// \param  plug the attribute to read
+    /// \param  type the type of the USD attribute the value is intended for
+    /// \return the value, or an empty value if the type is not supported
+    AL_USDMAYA_UTILS_PUBLIC
+    static VtValue getSimpleValue(const MPlug& plug, UsdDataType type);
+
+    /// \brief  read the current value of a numeric plug, converted to the given USD data type, and
+    ///         scaled.
+    /// \param  plug the attribute to read
+    /// \param  type the type of the USD attribute the value is intended for
+    /// \param  scale a scaling factor to apply (to convert units)
+    /// \return the value, or an empty value if the type is not supported
+    AL_USDMAYA_UTILS_PUBLIC
+    static VtValue getSimpleValue(const MPlug& plug, UsdDataType type, float scale);
+
     /// \brief  copy the attribute value from the plug specified, at the given time, and store the
     /// data on the usdAttr. \param  attr the attribute to be copied \param  usdAttr the attribute
     /// to copy the data to \param  timeCode the timecode to use when setting the data
@@ -1867,9 +1989,9 @@ inline MStatus
 DgNodeHelper::getInt32Array(const MObject& node, const MObject& attr, std::vector<int32_t>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getInt32Array(node, attr, values.data(), num);
 }
@@ -1903,9 +2025,9 @@ inline MStatus
 DgNodeHelper::getFloatArray(const MObject& node, const MObject& attr, std::vector<float>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getFloatArray(node, attr, values.data(), num);
 }
@@ -1915,9 +2037,9 @@ inline MStatus
 DgNodeHelper::getDoubleArray(const MObject& node, const MObject& attr, std::vector<double>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getDoubleArray(node, attr, values.data(), num);
 }
@@ -1951,9 +2073,9 @@ inline MStatus
 DgNodeHelper::getUsdInt32Array(const MObject& node, const MObject& attr, VtArray<int32_t>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getInt32Array(node, attr, values.data(), num);
 }
@@ -1987,9 +2109,9 @@ inline MStatus
 DgNodeHelper::getUsdFloatArray(const MObject& node, const MObject& attr, VtArray<float>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getFloatArray(node, attr, values.data(), num);
 }
@@ -1999,9 +2121,9 @@ inline MStatus
 DgNodeHelper::getUsdDoubleArray(const MObject& node, const MObject& attr, VtArray<double>& values)
 {
     MPlug plug(node, attr);
-    if (!plug || !plug.isArray())
+    if (!plug)
         return MS::kFailure;
-    const uint32_t num = plug.numElements();
+    const uint32_t num = plug.isArray() ? plug.numElements() : getArrayDataLength(node, attr);
     values.resize(num);
     return getDoubleArray(node, attr, values.data(), num);
 }
@@ -15,6 +15,11 @@
 //
 #include "AL/usd/transaction/TransactionManager.h"
 
+#include <pxr/usd/sdf/notice.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <string>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -61,6 +66,28 @@ void compareSpecViews(
     }
 }
 
+void compareProps(
+    const SdfPropertySpecHandle& a,
+    const SdfPropertySpecHandle& b,
+    SdfPathVector&               output,
+    SdfPathVector&               extra)
+{
+    const auto aFields = a->ListFields();
+    const auto bFields = b->ListFields();
+
+    if (aFields != bFields)
+        output.push_back(a->GetPath());
+    else {
+        /// Check field values
+        for (const auto& name : aFields) {
+            if (a->GetField(name) != b->GetField(name)) {
+                output.push_back(a->GetPath());
+                return;
+            }
+        }
+    }
+}
+
 void comparePrims(
     const SdfPrimSpecHandle& a,
     const SdfPrimSpecHandle& b,
@@ -71,29 +98,195 @@ void comparePrims(
     /// Compare children
     compareSpecViews(a->GetNameChildren(), b->GetNameChildren(), resynced, changed, comparePrims);
     // Compare properties
-    auto compareProps = [](const SdfPropertySpecHandle& a,
-                           const SdfPropertySpecHandle& b,
-                           SdfPathVector&               output,
-                           SdfPathVector&               extra) {
-        const auto aFields = a->ListFields();
-        const auto bFields = b->ListFields();
-
-        if (aFields != bFields)
-            output.push_back(a->GetPath());
-        else {
-            /// Check field values
-            for (const auto& name : aFields) {
-                if (a->GetField(name) != b->GetField(name)) {
-                    output.push_back(a->GetPath());
-                    return;
-                }
-            }
-        }
-    };
     compareSpecViews(a->GetProperties(), b->GetProperties(), changed, resynced, compareProps);
 }
+
+/// Removes the duplicates and the paths nested under an other path of the set
+SdfPathSet collapsePaths(const SdfPathVector& paths)
+{
+    SdfPathSet sorted(paths.begin(), paths.end()), collapsed;
+    for (const auto& path : sorted) {
+        if (SdfPathFindLongestPrefix(collapsed, path) == collapsed.end()) {
+            collapsed.insert(collapsed.end(), path);
+        }
+    }
+    return collapsed;
+}
 } // anonymous namespace
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Records the paths edited on a layer while a transaction is open, so that only those have
+///         to be compared against the snapshot of the layer when the transaction is closed.
+//----------------------------------------------------------------------------------------------------------------------
+class TransactionManager::ChangeTracker : public TfWeakBase
+{
+public:
+    ChangeTracker(const SdfLayerHandle& layer, const SdfLayerHandle& base)
+        : m_base(base)
+    {
+        m_noticeKey = TfNotice::Register(
+            TfCreateWeakPtr(this), &ChangeTracker::onLayerChanged, layer);
+        m_probeNoticeKey
+            = TfNotice::Register(TfCreateWeakPtr(this), &ChangeTracker::onBaseChanged, base);
+    }
+
+    ~ChangeTracker()
+    {
+        TfNotice::Revoke(m_noticeKey);
+        TfNotice::Revoke(m_probeNoticeKey);
+    }
+
+    /// \brief  compares the recorded paths of the layer against the snapshot taken on open
+    void compare(const SdfLayerHandle& layer, SdfPathVector& resynced, SdfPathVector& changed)
+    {
+        const SdfLayerHandle& base = m_base;
+
+        // the edits made in an open change block have not been notified yet, so the recorded
+        // paths may be incomplete
+        if (m_contentReplaced || isChangeBlockOpen()) {
+            comparePrims(base->GetPseudoRoot(), layer->GetPseudoRoot(), resynced, changed);
+            return;
+        }
+
+        // a removed (or renamed) prim may have been authored again with different content, so the
+        // whole subtree needs comparing. Everything else only needs its own spec compared, as its
+        // children and properties get their own entries when edited.
+        SdfPathSet deepPaths;
+        for (const auto& path : m_removed) {
+            if (SdfPathFindLongestPrefix(deepPaths, path) == deepPaths.end()) {
+                deepPaths.insert(deepPaths.end(), path);
+                compareSpec(base, layer, path, true, resynced, changed);
+            }
+        }
+        for (const auto& path : m_edited) {
+            if (SdfPathFindLongestPrefix(deepPaths, path) == deepPaths.end()) {
+                compareSpec(base, layer, path, false, resynced, changed);
+            }
+        }
+
+        // as with the full comparison, only report the topmost resynced paths, and no changes
+        // beneath them
+        const SdfPathSet collapsedResynced = collapsePaths(resynced);
+        resynced.assign(collapsedResynced.begin(), collapsedResynced.end());
+        SdfPathSet collapsedChanged;
+        for (const auto& path : changed) {
+            if (SdfPathFindLongestPrefix(collapsedResynced, path) == collapsedResynced.end()) {
+                collapsedChanged.insert(path);
+            }
+        }
+        changed.assign(collapsedChanged.begin(), collapsedChanged.end());
+    }
+
+private:
+    /// \brief  returns true if an SdfChangeBlock is currently open. The notices of the edits are
+    ///         only sent when the outermost change block closes, so an edit of the snapshot layer,
+    ///         which is not used by any stage, that is not notified right away means one is open.
+    bool isChangeBlockOpen()
+    {
+        m_baseChanged = false;
+        m_base->SetComment("transaction probe " + std::to_string(++m_probeCount));
+        return !m_baseChanged;
+    }
+
+    static void compareSpec(
+        const SdfLayerHandle& base,
+        const SdfLayerHandle& layer,
+        const SdfPath&        path,
+        const bool            compareChildren,
+        SdfPathVector&        resynced,
+        SdfPathVector&        changed)
+    {
+        if (path.IsPrimPropertyPath()) {
+            const auto a = base->GetPropertyAtPath(path);
+            const auto b = layer->GetPropertyAtPath(path);
+            if (a && b) {
+                compareProps(a, b, changed, resynced);
+            } else if (a || b) {
+                changed.push_back(path);
+            }
+        } else {
+            const auto a = base->GetPrimAtPath(path);
+            const auto b = layer->GetPrimAtPath(path);
+            if (a && b) {
+                if (compareChildren) {
+                    comparePrims(a, b, resynced, changed);
+                }
+            } else if (a || b) {
+                resynced.push_back(path);
+            }
+        }
+    }
+
+    void onBaseChanged(const SdfNotice::LayersDidChangeSentPerLayer&, const SdfLayerHandle&)
+    {
+        m_baseChanged = true;
+    }
+
+    /// \brief  returns the prim or property path recording the edit of the given path, or an empty
+    ///         path if the edit does not need to be compared
+    static SdfPath trackedPath(SdfPath path)
+    {
+        // variants are not compared, and targets, connections etc. are compared as part of their
+        // owning property
+        if (path.ContainsPrimVariantSelection()) {
+            return SdfPath();
+        }
+        while (!path.IsPrimPath() && !path.IsPrimPropertyPath() && !path.IsAbsoluteRootPath()) {
+            path = path.GetParentPath();
+        }
+        return path.IsAbsoluteRootPath() ? SdfPath() : path;
+    }
+
+    void onLayerChanged(
+        const SdfNotice::LayersDidChangeSentPerLayer& notice,
+        const SdfLayerHandle&                         layer)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+            if (layerAndChanges.first != layer) {
+                continue;
+            }
+            for (const auto& pathAndEntry : layerAndChanges.second.GetEntryList()) {
+                const auto& flags = pathAndEntry.second.flags;
+                if (flags.didReplaceContent || flags.didReloadContent) {
+                    m_contentReplaced = true;
+                }
+                if (m_contentReplaced) {
+                    continue;
+                }
+
+                const SdfPath path = trackedPath(pathAndEntry.first);
+                if (path.IsEmpty()) {
+                    continue;
+                }
+
+                if (flags.didRemoveInertPrim || flags.didRemoveNonInertPrim || flags.didRename) {
+                    m_removed.insert(path);
+                } else {
+                    m_edited.insert(path);
+                }
+
+                // renames are recorded at the new path, the old one has been removed too
+                if (flags.didRename) {
+                    const SdfPath oldPath = trackedPath(pathAndEntry.second.oldPath);
+                    if (!oldPath.IsEmpty()) {
+                        m_removed.insert(oldPath);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    SdfLayerHandle m_base;
+    TfNotice::Key  m_noticeKey;
+    TfNotice::Key  m_probeNoticeKey;
+    SdfPathSet     m_edited;
+    SdfPathSet     m_removed;
+    size_t         m_probeCount = 0;
+    bool           m_baseChanged = false;
+    bool           m_contentReplaced = false;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 TransactionManager::StageManagerMap& TransactionManager::GetManagers()
 {
@@ -114,11 +307,13 @@ bool TransactionManager::AnyInProgress() const { return !m_transactions.empty();
 bool TransactionManager::Open(const SdfLayerHandle& layer)
 {
     if (m_stage && layer) {
-        auto pair = m_transactions.emplace(get_pointer(layer), TransactionData { nullptr, 1 });
+        auto pair = m_transactions.emplace(
+            get_pointer(layer), TransactionData { nullptr, 1, nullptr });
         if (pair.second) {
             auto& base = pair.first->second.base;
             base = SdfLayer::CreateAnonymous("transaction_base");
             base->TransferContent(layer);
+            pair.first->second.tracker = std::make_shared<ChangeTracker>(layer, base);
             OpenNotice(layer).Send(m_stage);
         } else {
             ++pair.first->second.count;
@@ -137,11 +332,7 @@ bool TransactionManager::Close(const SdfLayerHandle& layer)
         if (it != m_transactions.end()) {
             if (--it->second.count == 0) {
                 SdfPathVector changedInfo, resynched;
-                comparePrims(
-                    it->second.base->GetPseudoRoot(),
-                    layer->GetPseudoRoot(),
-                    resynched,
-                    changedInfo);
+                it->second.tracker->compare(layer, resynched, changedInfo);
                 CloseNotice(layer, std::move(changedInfo), std::move(resynched)).Send(m_stage);
                 m_transactions.erase(it);
             }
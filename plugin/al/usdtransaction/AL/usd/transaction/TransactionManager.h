@@ -20,6 +20,8 @@
 #include <pxr/base/tf/weakPtr.h>
 #include <pxr/pxr.h>
 
+#include <memory>
+
 namespace AL {
 namespace usd {
 namespace transaction {
@@ -32,9 +34,10 @@ namespace transaction {
 ///         as well as static interface where stage needs to be provided.
 ///
 ///         Whenever a new transaction (first one targeting given layer) is opened an OpenNotice is
-///         being emitted and snapshot of given layer is taken. Whenever last transaction targeting
-///         given layer for given stage is closed, targetted layer content is being compared against
-///         previously taken snapshot and CloseNotice is emitted with delta information.
+///         being emitted and snapshot of given layer is taken. While the transaction is open, the
+///         paths edited on the layer are recorded. Whenever last transaction targeting given layer
+///         for given stage is closed, the recorded paths of the targetted layer are being compared
+///         against previously taken snapshot and CloseNotice is emitted with delta information.
 ///
 /// \note   It's user responsibilty to pair Open with Close calls, otherwise clients might not
 /// respond to any
@@ -130,10 +133,12 @@ private:
         : m_stage(stage)
     {
     }
+    class ChangeTracker;
     struct TransactionData
     {
-        PXR_NS::SdfLayerRefPtr base;
-        int                    count;
+        PXR_NS::SdfLayerRefPtr         base;
+        int                            count;
+        std::shared_ptr<ChangeTracker> tracker;
     };
     const PXR_NS::UsdStageWeakPtr                          m_stage;
     std::unordered_map<PXR_NS::SdfLayer*, TransactionData> m_transactions;
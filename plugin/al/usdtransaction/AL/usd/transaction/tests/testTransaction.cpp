@@ -2,6 +2,10 @@
 #include "AL/usd/transaction/Transaction.h"
 
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/propertySpec.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/stage.h>
 
@@ -301,3 +305,90 @@ TEST_F(TransactionTest, Clear)
     EXPECT_EQ(sorted(getChanged()), empty());
     EXPECT_EQ(sorted(getResynced()), empty());
 }
+
+/// Test that CloseNotice reports prims authored again after being removed as expected
+TEST_F(TransactionTest, RemoveAndRecreate)
+{
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        createPrimWithAttribute("/root");
+        createPrimWithAttribute("/root/A");
+        createPrimWithAttribute("/root/A/B");
+        createPrimWithAttribute("/root/C");
+    }
+    EXPECT_EQ(sorted(getChanged()), empty());
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root" }));
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        m_stage->GetSessionLayer()->GetPrimAtPath(SdfPath("/root"))->RemoveNameChild(
+            m_stage->GetSessionLayer()->GetPrimAtPath(SdfPath("/root/A")));
+        createPrimWithAttribute("/root/A", "foo");
+        changePrimAttribute("/root/C", 2);
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({ "/root/A.foo", "/root/A.prop", "/root/C.prop" }));
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root/A/B" }));
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        m_stage->RemovePrim(SdfPath("/root/A"));
+        changePrimAttribute("/root/C", 3);
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({ "/root/C.prop" }));
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root/A" }));
+}
+
+/// Test that CloseNotice reports both paths of a renamed prim as expected
+TEST_F(TransactionTest, Rename)
+{
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        createPrimWithAttribute("/root");
+        createPrimWithAttribute("/root/A");
+        createPrimWithAttribute("/root/A/B");
+    }
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root" }));
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        m_stage->GetSessionLayer()->GetPrimAtPath(SdfPath("/root/A"))->SetName("D");
+    }
+    EXPECT_EQ(sorted(getChanged()), empty());
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root/A", "/root/D" }));
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        m_stage->GetSessionLayer()->GetPropertyAtPath(SdfPath("/root/D.prop"))->SetName("renamed");
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({ "/root/D.prop", "/root/D.renamed" }));
+    EXPECT_EQ(sorted(getResynced()), empty());
+}
+
+/// Test that CloseNotice reports the edits of a transaction closed in a change block as expected
+TEST_F(TransactionTest, ChangeBlock)
+{
+    {
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        createPrimWithAttribute("/root");
+        createPrimWithAttribute("/root/A");
+    }
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root" }));
+    {
+        /// the notices of these edits are only sent once the change block closes, after the
+        /// transaction
+        SdfChangeBlock    changeBlock;
+        ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+        changePrimAttribute("/root/A", 2);
+        SdfCreatePrimInLayer(m_stage->GetSessionLayer(), SdfPath("/root/B"));
+    }
+    EXPECT_EQ(closed(), 2u);
+    EXPECT_EQ(sorted(getChanged()), sorted({ "/root/A.prop" }));
+    EXPECT_EQ(sorted(getResynced()), sorted({ "/root/B" }));
+    {
+        /// a transaction with edits notified both outside and inside of a change block
+        Transaction transaction(m_stage, m_stage->GetSessionLayer());
+        EXPECT_TRUE(transaction.Open());
+        changePrimAttribute("/root", 2);
+        SdfChangeBlock changeBlock;
+        changePrimAttribute("/root/A", 3);
+        EXPECT_TRUE(transaction.Close());
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({ "/root.prop", "/root/A.prop" }));
+    EXPECT_EQ(sorted(getResynced()), empty());
+}
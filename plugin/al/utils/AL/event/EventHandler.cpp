@@ -24,6 +24,9 @@ namespace event {
 
 EventScheduler* g_scheduler = 0;
 
+// the handle of python callbacks that the binding was unable to compile
+static const uint32_t g_notCompiled = ~uint32_t(0);
+
 //----------------------------------------------------------------------------------------------------------------------
 EventScheduler& EventScheduler::getScheduler()
 {
@@ -62,6 +65,7 @@ Callback::Callback(
     : m_tag(tag)
     , m_userData(0)
     , m_callbackId(callbackId)
+    , m_compiledCode(0)
 {
     size_t len = std::strlen(commandText) + 1;
     char*  ptr = new char[len];
@@ -190,11 +194,50 @@ void EventDispatcher::registerCallback(Callback& info)
     m_callbacks.insert(insertLocation, std::move(info));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void EventDispatcher::executeScriptCallback(Callback& callback)
+{
+    bool succeeded;
+    if (callback.isPythonCallback()) {
+        // compile on the first trigger, and remember when the binding is unable to, so that the
+        // code is not parsed twice on every trigger.
+        if (!callback.m_compiledCode) {
+            callback.m_compiledCode = m_system->compilePython(callback.callbackText());
+            if (!callback.m_compiledCode) {
+                callback.m_compiledCode = g_notCompiled;
+            }
+        }
+        succeeded = callback.m_compiledCode != g_notCompiled
+            ? m_system->executeCompiledPython(callback.m_compiledCode)
+            : m_system->executePython(callback.callbackText());
+    } else {
+        succeeded = m_system->executeMEL(callback.callbackText());
+    }
+
+    if (!succeeded) {
+        m_system->error(
+            "The %s callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
+            callback.isPythonCallback() ? "python" : "MEL",
+            m_name.c_str(),
+            callback.tag().c_str());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void EventDispatcher::releaseCompiledCode(Callback& callback)
+{
+    if (callback.m_compiledCode && callback.m_compiledCode != g_notCompiled) {
+        m_system->releaseCompiledPython(callback.m_compiledCode);
+    }
+    callback.m_compiledCode = 0;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool EventDispatcher::unregisterCallback(CallbackId callbackId)
 {
     for (auto it = m_callbacks.begin(), e = m_callbacks.end(); it != e; ++it) {
         if (it->callbackId() == callbackId) {
+            releaseCompiledCode(*it);
             m_callbacks.erase(it);
             return true;
         }
@@ -207,6 +250,8 @@ bool EventDispatcher::unregisterCallback(CallbackId callbackId, Callback& info)
 {
     for (auto it = m_callbacks.begin(), e = m_callbacks.end(); it != e; ++it) {
         if (it->callbackId() == callbackId) {
+            // the callback compiles its code again if it is registered elsewhere
+            releaseCompiledCode(*it);
             info = std::move(*it);
             m_callbacks.erase(it);
             return true;
@@ -257,6 +302,9 @@ bool EventScheduler::unregisterEvent(EventId eventId)
     auto it = std::lower_bound(m_registeredEvents.begin(), m_registeredEvents.end(), eventId);
     if (it != m_registeredEvents.end()) {
         if (it->eventId() == eventId) {
+            for (auto& callback : it->m_callbacks) {
+                it->releaseCompiledCode(callback);
+            }
             m_registeredEvents.erase(it);
             return true;
         }
@@ -269,6 +317,9 @@ bool EventScheduler::unregisterEvent(const char* const eventName)
 {
     for (auto it = m_registeredEvents.begin(), e = m_registeredEvents.end(); it != e; ++it) {
         if (it->name() == eventName && it->associatedData() == 0) {
+            for (auto& callback : it->m_callbacks) {
+                it->releaseCompiledCode(callback);
+            }
             m_registeredEvents.erase(it);
             return true;
         }
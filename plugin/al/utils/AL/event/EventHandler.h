@@ -188,6 +188,36 @@ public:
     /// \return true if executed correctly
     virtual bool executeMEL(const char* const code) = 0;
 
+    /// \brief  override to compile python code once, so that a callback triggered many times is
+    ///         not parsed again on each trigger. The compiled code lives until it is released with
+    ///         releaseCompiledPython.
+    /// \param  code the code to compile
+    /// \return a non-zero handle to pass to executeCompiledPython, or zero if the code could not be
+    ///         compiled (in which case executePython is used instead)
+    virtual uint32_t compilePython(const char* const code) { return 0; }
+
+    /// \brief  override to execute python code compiled with compilePython
+    /// \param  compiledCode the handle returned by compilePython
+    /// \return true if executed correctly
+    virtual bool executeCompiledPython(uint32_t compiledCode) { return false; }
+
+    /// \brief  override to release python code compiled with compilePython, once the callback
+    ///         it was compiled for is unregistered
+    /// \param  compiledCode the handle returned by compilePython
+    virtual void releaseCompiledPython(uint32_t compiledCode) {}
+
+    /// \brief  override to hand the payloads of a batched event to the script callbacks, prior to
+    ///         them being executed by EventDispatcher::triggerEventBatch
+    /// \param  payloads the payloads of the events in the batch
+    /// \param  isPython true if the payloads are for python callbacks, false for MEL callbacks
+    /// \return true if the payloads were set, false if batching is not supported (in which case
+    ///         the script callbacks are executed once per payload)
+    virtual bool
+    setScriptPayloads(const std::vector<std::string>& payloads, const bool isPython)
+    {
+        return false;
+    }
+
     /// \brief  override to implement the logging system
     /// \param  severity
     /// \param  text the text to log
@@ -255,6 +285,7 @@ public:
         : m_tag(tag)
         , m_userData(userData)
         , m_callbackId(callbackId)
+        , m_compiledCode(0)
     {
         m_callback = (const void*)functionPointer;
         m_weight = weight;
@@ -280,6 +311,7 @@ public:
         : m_tag()
         , m_userData(nullptr)
         , m_callbackId(0)
+        , m_compiledCode(0)
     {
         m_callback = nullptr;
         m_weight = 0;
@@ -292,6 +324,7 @@ public:
         : m_tag(std::move(rhs.m_tag))
         , m_userData(rhs.m_userData)
         , m_callbackId(rhs.m_callbackId)
+        , m_compiledCode(rhs.m_compiledCode)
     {
         m_callback = rhs.m_callback;
         rhs.m_callback = nullptr;
@@ -307,6 +340,7 @@ public:
         m_tag = std::move(rhs.m_tag);
         m_userData = rhs.m_userData;
         m_callbackId = rhs.m_callbackId;
+        m_compiledCode = rhs.m_compiledCode;
         m_callback = rhs.m_callback;
         rhs.m_callback = nullptr;
         m_weight = rhs.m_weight;
@@ -372,6 +406,7 @@ private:
         uint32_t m_weight : 30;      ///< the weighting value for the event
         uint32_t m_functionType : 2; ///< the type of callback (e.g. C++, python, MEL)
     };
+    uint32_t m_compiledCode; ///< the handle of the compiled python code (zero until first triggered)
 };
 typedef std::vector<Callback> Callbacks;
 
@@ -583,22 +618,8 @@ public:
         for (auto& callback : m_callbacks) {
             if (callback.isCCallback()) {
                 binder(callback.userData(), callback.callback());
-            } else if (callback.isPythonCallback()) {
-                if (!m_system->executePython(callback.callbackText())) {
-                    m_system->error(
-                        "The python callback of event name \"%s\" and tag \"%s\" failed to execute "
-                        "correctly",
-                        m_name.c_str(),
-                        callback.tag().c_str());
-                }
             } else {
-                if (!m_system->executeMEL(callback.callbackText())) {
-                    m_system->error(
-                        "The MEL callback of event name \"%s\" and tag \"%s\" failed to execute "
-                        "correctly",
-                        m_name.c_str(),
-                        callback.tag().c_str());
-                }
+                executeScriptCallback(callback);
             }
         }
     }
@@ -613,21 +634,53 @@ public:
             if (callback.isCCallback()) {
                 defaultEventFunction basic = (defaultEventFunction)callback.callback();
                 basic(callback.userData());
-            } else if (callback.isPythonCallback()) {
-                if (!m_system->executePython(callback.callbackText())) {
-                    m_system->error(
-                        "The python callback of event name \"%s\" and tag \"%s\" failed to execute "
-                        "correctly",
-                        m_name.c_str(),
-                        callback.tag().c_str());
+            } else {
+                executeScriptCallback(callback);
+            }
+        }
+    }
+
+    /// \brief  triggers the event once for each payload in a batch. The C++ callbacks are called
+    ///         once per payload, whereas the script callbacks are executed once for the whole batch,
+    ///         with the payloads handed to them by EventSystemBinding::setScriptPayloads.
+    ///         This avoids paying the cost of the script interpreter for every item, when an event
+    ///         fires for many items at once (e.g. prims, or nodes).
+    /// \code
+    /// std::vector<std::string> primPaths;
+    /// eventThing.triggerEventBatch(
+    ///     primPaths, [&](void* userData, const void* callback, size_t index) {
+    ///         ((prim_changed_func)callback)(userData, primPaths[index]);
+    ///     });
+    /// \endcode
+    /// \param  payloads the text representation of each event, handed to the script callbacks
+    /// \param  binder a function object called with the user data, function pointer, and index of
+    ///         the payload, for each C++ callback and payload
+    template <typename FunctionBinder>
+    void triggerEventBatch(const std::vector<std::string>& payloads, FunctionBinder binder)
+    {
+        if (payloads.empty()) {
+            return;
+        }
+        int pythonBatched = -1, melBatched = -1;
+        for (auto& callback : m_callbacks) {
+            if (callback.isCCallback()) {
+                for (size_t i = 0, n = payloads.size(); i < n; ++i) {
+                    binder(callback.userData(), callback.callback(), i);
                 }
+                continue;
+            }
+
+            // only hand the payloads over once per script language
+            const bool isPython = callback.isPythonCallback();
+            int&       batched = isPython ? pythonBatched : melBatched;
+            if (batched < 0) {
+                batched = m_system->setScriptPayloads(payloads, isPython) ? 1 : 0;
+            }
+            if (batched) {
+                executeScriptCallback(callback);
             } else {
-                if (!m_system->executeMEL(callback.callbackText())) {
-                    m_system->error(
-                        "The MEL callback of event name \"%s\" and tag \"%s\" failed to execute "
-                        "correctly",
-                        m_name.c_str(),
-                        callback.tag().c_str());
+                for (size_t i = 0, n = payloads.size(); i < n; ++i) {
+                    executeScriptCallback(callback);
                 }
             }
         }
@@ -667,6 +720,12 @@ public:
     }
 
 private:
+    /// \brief  executes a python or MEL callback, compiling the python code on first use
+    AL_EVENT_PUBLIC
+    void executeScriptCallback(Callback& callback);
+    /// \brief  releases the compiled python code of a callback being unregistered
+    AL_EVENT_PUBLIC
+    void releaseCompiledCode(Callback& callback);
     AL_EVENT_PUBLIC
     CallbackId registerCallbackInternal(
         const char* const tag,
@@ -800,6 +859,25 @@ public:
         return false;
     }
 
+    /// \brief  dispatches a batch of events using a function binder
+    /// \param  eventId the event to dispatch
+    /// \param  payloads the text representation of each event, handed to the script callbacks
+    /// \param  binder the binder to dispatch the event, called with the index of each payload
+    /// \return true if the event is valid
+    template <typename FunctionBinder>
+    bool triggerEventBatch(
+        EventId                         eventId,
+        const std::vector<std::string>& payloads,
+        FunctionBinder                  binder)
+    {
+        EventDispatcher* e = event(eventId);
+        if (e) {
+            e->triggerEventBatch(payloads, binder);
+            return true;
+        }
+        return false;
+    }
+
     /// \brief  dispatches an event using the standard void (*func)(void* userData) signature
     /// \param  eventId the event to dispatch
     /// \return true if the event is valid
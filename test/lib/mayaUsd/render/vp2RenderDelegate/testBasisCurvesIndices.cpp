@@ -0,0 +1,137 @@
+#include <mayaUsd/render/vp2RenderDelegate/basisCurvesIndices.h>
+
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+using CurveOffsets = HdVP2BasisCurvesIndices::CurveOffsets;
+
+HdBasisCurvesTopology createTopology(
+    const TfToken&    type,
+    const TfToken&    basis,
+    const TfToken&    wrap,
+    const VtIntArray& vertexCounts,
+    const VtIntArray& indices = VtIntArray())
+{
+    return HdBasisCurvesTopology(type, basis, wrap, vertexCounts, indices);
+}
+
+} // namespace
+
+TEST(BasisCurvesIndices, curveOffsets)
+{
+    const VtIntArray          vertexCounts = { 4, 0, 7 };
+    std::vector<CurveOffsets> offsets;
+    HdVP2BasisCurvesIndices::ComputeCurveOffsets(
+        vertexCounts,
+        [](int count) -> CurveOffsets { return { size_t(count), size_t(count) * 2 }; },
+        offsets);
+
+    ASSERT_EQ(offsets.size(), 4u);
+    ASSERT_EQ(offsets[0].src, 0u);
+    ASSERT_EQ(offsets[0].dst, 0u);
+    ASSERT_EQ(offsets[1].src, 4u);
+    ASSERT_EQ(offsets[1].dst, 8u);
+    ASSERT_EQ(offsets[2].src, 4u);
+    ASSERT_EQ(offsets[2].dst, 8u);
+    ASSERT_EQ(offsets[3].src, 11u);
+    ASSERT_EQ(offsets[3].dst, 22u);
+
+    // No curves still gives the total sizes.
+    HdVP2BasisCurvesIndices::ComputeCurveOffsets(
+        VtIntArray(), [](int) -> CurveOffsets { return { 1, 1 }; }, offsets);
+    ASSERT_EQ(offsets.size(), 1u);
+    ASSERT_EQ(offsets[0].src, 0u);
+    ASSERT_EQ(offsets[0].dst, 0u);
+}
+
+TEST(BasisCurvesIndices, cubic)
+{
+    // Open bezier curves of 1, 2 and 3 segments.
+    const VtIntArray bezier = HdVP2BasisCurvesIndices::BuildCubicIndexArray(
+        createTopology(HdTokens->cubic, HdTokens->bezier, HdTokens->nonperiodic, { 4, 7, 10 }));
+    ASSERT_EQ(bezier.size(), 24u);
+    ASSERT_EQ(bezier, VtIntArray({ 0,  1,  2,  3,  4,  5,  6,  7,  7,  8,  9,  10,
+                                   11, 12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20 }));
+
+    // Periodic curves of varying vertex counts wrap back to their first vertex.
+    const VtIntArray bspline = HdVP2BasisCurvesIndices::BuildCubicIndexArray(
+        createTopology(HdTokens->cubic, HdTokens->bSpline, HdTokens->periodic, { 4, 6 }));
+    ASSERT_EQ(bspline.size(), 40u);
+    ASSERT_EQ(VtIntArray(bspline.begin() + 12, bspline.begin() + 16), VtIntArray({ 3, 0, 1, 2 }));
+    ASSERT_EQ(VtIntArray(bspline.end() - 4, bspline.end()), VtIntArray({ 9, 4, 5, 6 }));
+
+    const VtIntArray periodicBezier = HdVP2BasisCurvesIndices::BuildCubicIndexArray(
+        createTopology(HdTokens->cubic, HdTokens->bezier, HdTokens->periodic, { 6 }));
+    ASSERT_EQ(periodicBezier, VtIntArray({ 0, 1, 2, 3, 3, 4, 5, 0 }));
+}
+
+TEST(BasisCurvesIndices, linear)
+{
+    const VtIntArray open = HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(
+        createTopology(HdTokens->linear, HdTokens->bezier, HdTokens->nonperiodic, { 3, 2 }));
+    ASSERT_EQ(open, VtIntArray({ 0, 1, 1, 2, 3, 4 }));
+
+    const VtIntArray periodic = HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(
+        createTopology(HdTokens->linear, HdTokens->bezier, HdTokens->periodic, { 3, 4 }));
+    ASSERT_EQ(periodic, VtIntArray({ 0, 1, 1, 2, 2, 0, 3, 4, 4, 5, 5, 6, 6, 3 }));
+
+    // The first and last segments of catmullRom curves are not drawn.
+    const VtIntArray catmullRom = HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(
+        createTopology(HdTokens->cubic, HdTokens->catmullRom, HdTokens->nonperiodic, { 5 }));
+    ASSERT_EQ(catmullRom, VtIntArray({ 1, 2, 2, 3 }));
+
+    // The indices are mapped through the curve indices.
+    const VtIntArray indexed = HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(createTopology(
+        HdTokens->linear, HdTokens->bezier, HdTokens->nonperiodic, { 3 }, { 5, 6, 7 }));
+    ASSERT_EQ(indexed, VtIntArray({ 5, 6, 6, 7 }));
+}
+
+TEST(BasisCurvesIndices, segmented)
+{
+    const VtIntArray lines = HdVP2BasisCurvesIndices::BuildLinesIndexArray(
+        createTopology(HdTokens->linear, HdTokens->bezier, HdTokens->segmented, { 2, 4 }));
+    ASSERT_EQ(lines, VtIntArray({ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST(BasisCurvesIndices, emptyTopology)
+{
+    const HdBasisCurvesTopology topology
+        = createTopology(HdTokens->cubic, HdTokens->bezier, HdTokens->nonperiodic, VtIntArray());
+    ASSERT_TRUE(HdVP2BasisCurvesIndices::BuildCubicIndexArray(topology).empty());
+    ASSERT_TRUE(HdVP2BasisCurvesIndices::BuildLinesIndexArray(topology).empty());
+    ASSERT_TRUE(HdVP2BasisCurvesIndices::BuildLineSegmentIndexArray(topology).empty());
+}
+
+TEST(BasisCurvesIndices, manyCurves)
+{
+    // Enough curves to be filled by several parallel tasks.
+    const size_t curveCount = 4 * HdVP2BasisCurvesIndices::kCurveGrainSize + 3;
+    VtIntArray   vertexCounts(curveCount);
+    for (size_t curve = 0; curve < curveCount; ++curve)
+        vertexCounts[curve] = (curve % 2) ? 7 : 4;
+
+    const VtIntArray indices = HdVP2BasisCurvesIndices::BuildCubicIndexArray(
+        createTopology(HdTokens->cubic, HdTokens->bezier, HdTokens->nonperiodic, vertexCounts));
+
+    // One segment for the curves of 4 vertices, two for the curves of 7 vertices.
+    size_t index = 0;
+    int    vertex = 0;
+    for (size_t curve = 0; curve < curveCount; ++curve) {
+        const int count = vertexCounts[curve];
+        for (int segment = 0; segment < (count - 1) / 3; ++segment) {
+            for (int v = 0; v < 4; ++v)
+                ASSERT_EQ(indices[index++], vertex + segment * 3 + v);
+        }
+        vertex += count;
+    }
+    ASSERT_EQ(index, indices.size());
+}
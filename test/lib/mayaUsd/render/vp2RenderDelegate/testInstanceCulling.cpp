@@ -0,0 +1,260 @@
+#include <mayaUsd/render/vp2RenderDelegate/instanceCulling.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const GfRange3d kUnitBounds(GfVec3d(-0.5), GfVec3d(0.5));
+
+// Perspective camera at the origin looking down -Z, in Maya's row-vector convention.
+HdVP2CullingView createView(double minScreenSize)
+{
+    const double nearDist = 1.0;
+    const double farDist = 1000.0;
+    const double focal = 1.0 / std::tan(0.5);
+    const double aspect = 16.0 / 9.0;
+    const double height = 1080.0;
+
+    HdVP2CullingView view;
+    MMatrix&         m = view.viewProjection;
+    m = MMatrix();
+    m[0][0] = focal / aspect;
+    m[1][1] = focal;
+    m[2][2] = -(farDist + nearDist) / (farDist - nearDist);
+    m[2][3] = -1.0;
+    m[3][2] = -2.0 * farDist * nearDist / (farDist - nearDist);
+    m[3][3] = 0.0;
+    view.pixelScale = 0.5 * focal * height;
+    view.minScreenSize = minScreenSize;
+    return view;
+}
+
+MMatrix createTransform(double x, double y, double z, double scale = 1.0)
+{
+    MMatrix m;
+    m[0][0] = m[1][1] = m[2][2] = scale;
+    m[3][0] = x;
+    m[3][1] = y;
+    m[3][2] = z;
+    return m;
+}
+
+// True if the unit box transformed by m is fully outside one of the clip planes.
+bool outsideFrustum(const MMatrix& m, const HdVP2CullingView& view)
+{
+    const MMatrix& vp = view.viewProjection;
+    for (int plane = 0; plane < 6; ++plane) {
+        const int    axis = plane / 2;
+        const double sign = (plane % 2) ? -1.0 : 1.0;
+        bool         allOutside = true;
+        for (int corner = 0; corner < 8 && allOutside; ++corner) {
+            const double local[3] = { (corner & 1) ? 0.5 : -0.5,
+                                      (corner & 2) ? 0.5 : -0.5,
+                                      (corner & 4) ? 0.5 : -0.5 };
+            double       world[3];
+            for (int j = 0; j < 3; ++j) {
+                world[j] = local[0] * m[0][j] + local[1] * m[1][j] + local[2] * m[2][j] + m[3][j];
+            }
+            double clip[4];
+            for (int j = 0; j < 4; ++j) {
+                clip[j]
+                    = world[0] * vp[0][j] + world[1] * vp[1][j] + world[2] * vp[2][j] + vp[3][j];
+            }
+            allOutside = clip[3] + sign * clip[axis] < 0.0;
+        }
+        if (allOutside) {
+            return true;
+        }
+    }
+    return false;
+}
+
+MMatrixArray createRandomInstances(size_t count)
+{
+    std::mt19937                           generator(42);
+    std::uniform_real_distribution<double> position(-500.0, 500.0);
+    std::uniform_real_distribution<double> scale(0.2, 4.0);
+
+    MMatrixArray transforms;
+    for (size_t i = 0; i < count; ++i) {
+        transforms.append(createTransform(
+            position(generator), 0.1 * position(generator), position(generator), scale(generator)));
+    }
+    return transforms;
+}
+
+} // namespace
+
+TEST(InstanceCulling, cullsOutsideFrustum)
+{
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, -10.0));   // In front of the camera
+    transforms.append(createTransform(0.0, 0.0, 10.0));    // Behind the camera
+    transforms.append(createTransform(100.0, 0.0, -10.0)); // Far to the right
+    transforms.append(createTransform(0.0, 0.0, -2000.0)); // Past the far plane
+    transforms.append(createTransform(0.0, 0.0, -1.0));    // Crossing the near plane
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, kUnitBounds);
+    const std::vector<uint8_t>& visible = culler.Cull(createView(0.0));
+
+    ASSERT_EQ(visible.size(), transforms.length());
+    EXPECT_TRUE(visible[0]);
+    EXPECT_FALSE(visible[1]);
+    EXPECT_FALSE(visible[2]);
+    EXPECT_FALSE(visible[3]);
+    EXPECT_TRUE(visible[4]);
+}
+
+TEST(InstanceCulling, cullsSmallInstances)
+{
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, -10.0));  // Hundreds of pixels
+    transforms.append(createTransform(0.0, 0.0, -900.0)); // About two pixels
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, kUnitBounds);
+
+    const std::vector<uint8_t>& visible = culler.Cull(createView(4.0));
+    EXPECT_TRUE(visible[0]);
+    EXPECT_FALSE(visible[1]);
+
+    const std::vector<uint8_t>& allVisible = culler.Cull(createView(0.0));
+    EXPECT_TRUE(allVisible[0]);
+    EXPECT_TRUE(allVisible[1]);
+}
+
+TEST(InstanceCulling, levelOfDetailHysteresis)
+{
+    // About 17 pixels with the default view.
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, -100.0));
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, kUnitBounds);
+
+    auto lodView = [](double zoom) {
+        HdVP2CullingView view = createView(0.0);
+        view.lodScreenSize = 20.0;
+        view.pixelScale *= zoom;
+        return view;
+    };
+
+    EXPECT_EQ(culler.Cull(lodView(1.0))[0], HdVP2InstanceCuller::kBoundingBox);
+    EXPECT_EQ(culler.GetBoundingBoxCount(), 1u);
+
+    // Slightly above the threshold, the bounding box is kept.
+    EXPECT_EQ(culler.Cull(lodView(1.3))[0], HdVP2InstanceCuller::kBoundingBox);
+
+    EXPECT_EQ(culler.Cull(lodView(1.6))[0], HdVP2InstanceCuller::kFullDetail);
+    EXPECT_EQ(culler.GetBoundingBoxCount(), 0u);
+
+    // Slightly above the threshold, the full detail is kept.
+    EXPECT_EQ(culler.Cull(lodView(1.3))[0], HdVP2InstanceCuller::kFullDetail);
+}
+
+TEST(InstanceCulling, levelOfDetailWithoutCulling)
+{
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, -10.0));  // Hundreds of pixels
+    transforms.append(createTransform(0.0, 0.0, 10.0));   // Behind the camera
+    transforms.append(createTransform(0.0, 0.0, -900.0)); // About two pixels
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, kUnitBounds);
+
+    HdVP2CullingView view = createView(0.0);
+    view.cullFrustum = false;
+    view.lodScreenSize = 20.0;
+    const std::vector<uint8_t>& visible = culler.Cull(view);
+    EXPECT_EQ(visible[0], HdVP2InstanceCuller::kFullDetail);
+    EXPECT_NE(visible[1], HdVP2InstanceCuller::kCulled);
+    EXPECT_EQ(visible[2], HdVP2InstanceCuller::kBoundingBox);
+}
+
+TEST(InstanceCulling, emptyBoundsAreNeverCulled)
+{
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, 10.0));
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, GfRange3d());
+    const std::vector<uint8_t>& visible = culler.Cull(createView(0.0));
+    ASSERT_EQ(visible.size(), 1u);
+    EXPECT_TRUE(visible[0]);
+}
+
+TEST(InstanceCulling, matchesBruteForce)
+{
+    const MMatrixArray     transforms = createRandomInstances(100000);
+    const HdVP2CullingView view = createView(0.0);
+
+    HdVP2InstanceCuller culler;
+    culler.Build(transforms, kUnitBounds);
+    const std::vector<uint8_t>& visible = culler.Cull(view);
+
+    ASSERT_EQ(visible.size(), transforms.length());
+    for (unsigned int i = 0; i < transforms.length(); ++i) {
+        EXPECT_EQ(visible[i] != 0, !outsideFrustum(transforms[i], view)) << "instance " << i;
+    }
+}
+
+TEST(InstanceCulling, rebuildsOnlyWhenInstancesChange)
+{
+    MMatrixArray transforms;
+    transforms.append(createTransform(0.0, 0.0, -10.0));
+
+    HdVP2InstanceCuller culler;
+    culler.Update(1, MMatrix(), kUnitBounds, transforms);
+    EXPECT_TRUE(culler.Cull(createView(0.0))[0]);
+
+    // Same version, the moved instance is still culled with the previous hierarchy.
+    transforms.setLength(0);
+    transforms.append(createTransform(0.0, 0.0, 10.0));
+    culler.Update(1, MMatrix(), kUnitBounds, transforms);
+    EXPECT_TRUE(culler.Cull(createView(0.0))[0]);
+
+    culler.Update(2, MMatrix(), kUnitBounds, transforms);
+    EXPECT_FALSE(culler.Cull(createView(0.0))[0]);
+}
+
+// Disabled by default, run it with --gtest_also_run_disabled_tests; the timings are recorded as
+// test properties.
+TEST(InstanceCulling, DISABLED_benchmark)
+{
+    for (size_t instanceCount : { 10000, 100000, 1000000 }) {
+        const MMatrixArray     transforms = createRandomInstances(instanceCount);
+        const HdVP2CullingView view = createView(1.0);
+
+        auto                start = std::chrono::steady_clock::now();
+        HdVP2InstanceCuller culler;
+        culler.Build(transforms, kUnitBounds);
+        const auto build = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        const std::vector<uint8_t>& visible = culler.Cull(view);
+        const auto                  cull = std::chrono::steady_clock::now() - start;
+
+        size_t visibleCount = 0;
+        for (uint8_t flag : visible)
+            visibleCount += flag;
+
+        EXPECT_EQ(visible.size(), instanceCount);
+        EXPECT_GT(visibleCount, 0u);
+
+        using std::chrono::microseconds;
+        const std::string suffix = "_" + std::to_string(instanceCount);
+        ::testing::Test::RecordProperty(
+            "build_us" + suffix, int(std::chrono::duration_cast<microseconds>(build).count()));
+        ::testing::Test::RecordProperty(
+            "cull_us" + suffix, int(std::chrono::duration_cast<microseconds>(cull).count()));
+        ::testing::Test::RecordProperty("visible" + suffix, int(visibleCount));
+    }
+}
@@ -0,0 +1,244 @@
+#include <mayaUsd/render/vp2RenderDelegate/instanceTransforms.h>
+
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/vtBufferSource.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+struct InstancerPrimvars
+{
+    VtVec3fArray    translations;
+    VtQuathArray    rotations;
+    VtVec3fArray    scales;
+    VtMatrix4dArray transforms;
+    GfMatrix4d      instancerTransform;
+};
+
+InstancerPrimvars createPrimvars(size_t instanceCount, bool withTransforms)
+{
+    InstancerPrimvars primvars;
+    primvars.instancerTransform.SetTranslate(GfVec3d(1000.0, -20.0, 5.0));
+
+    primvars.translations.resize(instanceCount);
+    primvars.rotations.resize(instanceCount);
+    primvars.scales.resize(instanceCount);
+    for (size_t i = 0; i < instanceCount; ++i) {
+        const float f = static_cast<float>(i);
+        primvars.translations[i] = GfVec3f(f, 2.0f * f, -f);
+        const GfQuatd rotation = GfRotation(GfVec3d(1.0, 1.0, 0.0), f).GetQuat();
+        primvars.rotations[i] = GfQuath(rotation);
+        primvars.scales[i] = GfVec3f(1.0f + 0.001f * f, 1.0f, 2.0f);
+    }
+
+    if (withTransforms) {
+        primvars.transforms.resize(instanceCount);
+        for (size_t i = 0; i < instanceCount; ++i) {
+            primvars.transforms[i].SetRotate(GfRotation(GfVec3d(0.0, 0.0, 1.0), 0.5 * i));
+        }
+    }
+    return primvars;
+}
+
+// Composition of the instance transforms one matrix at a time, in double precision.
+VtMatrix4dArray composeReference(const InstancerPrimvars& primvars, const VtIntArray& indices)
+{
+    VtMatrix4dArray result(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const int  index = indices[i];
+        GfMatrix4d transform = primvars.instancerTransform;
+
+        GfMatrix4d translate(1);
+        translate.SetTranslate(GfVec3d(primvars.translations[index]));
+        transform = translate * transform;
+
+        GfMatrix4d rotate(1);
+        rotate.SetRotate(GfQuatd(primvars.rotations[index]));
+        transform = rotate * transform;
+
+        GfMatrix4d scale(1);
+        scale.SetScale(GfVec3d(primvars.scales[index]));
+        transform = scale * transform;
+
+        if (!primvars.transforms.empty()) {
+            transform = primvars.transforms[index] * transform;
+        }
+        result[i] = transform;
+    }
+    return result;
+}
+
+void update(HdVP2InstanceTransforms& kernel, const InstancerPrimvars& primvars)
+{
+    const HdVtBufferSource translations(TfToken("translations"), VtValue(primvars.translations));
+    const HdVtBufferSource rotations(TfToken("rotations"), VtValue(primvars.rotations));
+    const HdVtBufferSource scales(TfToken("scales"), VtValue(primvars.scales));
+    const HdVtBufferSource transforms(TfToken("transforms"), VtValue(primvars.transforms));
+
+    kernel.Update(
+        primvars.instancerTransform,
+        primvars.translations.size(),
+        &translations,
+        &rotations,
+        &scales,
+        primvars.transforms.empty() ? nullptr : &transforms);
+}
+
+VtIntArray allIndices(size_t instanceCount)
+{
+    VtIntArray indices(instanceCount);
+    for (size_t i = 0; i < instanceCount; ++i)
+        indices[i] = static_cast<int>(i);
+    return indices;
+}
+
+} // namespace
+
+TEST(InstanceTransforms, matchesReferenceComposition)
+{
+    for (bool withTransforms : { false, true }) {
+        const size_t instanceCount = 5000;
+        const auto   primvars = createPrimvars(instanceCount, withTransforms);
+
+        HdVP2InstanceTransforms kernel;
+        update(kernel, primvars);
+        EXPECT_EQ(kernel.GetInstanceCount(), instanceCount);
+
+        // Every other instance, in reverse order.
+        VtIntArray indices;
+        for (int i = static_cast<int>(instanceCount) - 1; i >= 0; i -= 2)
+            indices.push_back(i);
+
+        VtMatrix4dArray result;
+        kernel.Compose(indices, result);
+
+        const VtMatrix4dArray expected = composeReference(primvars, indices);
+        ASSERT_EQ(result.size(), expected.size());
+        for (size_t i = 0; i < result.size(); ++i) {
+            for (int e = 0; e < 16; ++e) {
+                EXPECT_NEAR(result[i].data()[e], expected[i].data()[e], 1e-6);
+            }
+        }
+    }
+}
+
+TEST(InstanceTransforms, appliesWorldMatrix)
+{
+    const size_t instanceCount = 3000;
+    const auto   primvars = createPrimvars(instanceCount, false);
+
+    HdVP2InstanceTransforms kernel;
+    update(kernel, primvars);
+
+    MMatrix worldMatrix;
+    worldMatrix[3][0] = 10.0;
+    worldMatrix[0][0] = 2.0;
+
+    VtMatrix4dArray local;
+    kernel.Compose(allIndices(instanceCount), local);
+    MMatrixArray applied;
+    HdVP2InstanceTransforms::Apply(worldMatrix, local, applied);
+
+    ASSERT_EQ(applied.length(), instanceCount);
+    for (unsigned int i = 0; i < instanceCount; ++i) {
+        MMatrix localMatrix;
+        local[i].Get(localMatrix.matrix);
+        const MMatrix expected = worldMatrix * localMatrix;
+        EXPECT_TRUE(applied[i].isEquivalent(expected, 1e-9));
+    }
+}
+
+TEST(InstanceTransforms, farFromOrigin)
+{
+    // Instance transforms a few millimeters apart, a thousand kilometers from the
+    // origin, where single precision only resolves about 6 centimeters.
+    const size_t instanceCount = 100;
+    auto         primvars = createPrimvars(instanceCount, true);
+    primvars.instancerTransform.SetTranslate(GfVec3d(-1.0e6, 0.0, 1.0e6));
+    for (size_t i = 0; i < instanceCount; ++i) {
+        GfMatrix4d transform = primvars.transforms[i];
+        transform.SetTranslateOnly(GfVec3d(1.0e8 + 0.001 * i, 0.0, -1.0e8));
+        primvars.transforms[i] = transform;
+    }
+
+    HdVP2InstanceTransforms kernel;
+    update(kernel, primvars);
+
+    const VtIntArray indices = allIndices(instanceCount);
+    VtMatrix4dArray  result;
+    kernel.Compose(indices, result);
+
+    const VtMatrix4dArray expected = composeReference(primvars, indices);
+    ASSERT_EQ(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        const GfVec3d offset = result[i].ExtractTranslation() - expected[i].ExtractTranslation();
+        EXPECT_LT(offset.GetLength(), 1e-6);
+    }
+
+    // Consecutive instances remain distinct.
+    for (size_t i = 1; i < result.size(); ++i) {
+        EXPECT_NE(result[i].ExtractTranslation(), result[i - 1].ExtractTranslation());
+    }
+}
+
+TEST(InstanceTransforms, missingPrimvarsAreIdentity)
+{
+    const size_t instanceCount = 10;
+    const auto   primvars = createPrimvars(4, false);
+
+    // Only 4 translations for 10 instances, no other primvars.
+    const HdVtBufferSource translations(TfToken("translations"), VtValue(primvars.translations));
+
+    HdVP2InstanceTransforms kernel;
+    kernel.Update(GfMatrix4d(1.0), instanceCount, &translations, nullptr, nullptr, nullptr);
+
+    VtMatrix4dArray result;
+    kernel.Compose(allIndices(instanceCount), result);
+    ASSERT_EQ(result.size(), instanceCount);
+    for (size_t i = 0; i < instanceCount; ++i) {
+        const GfVec3d expected = i < 4 ? GfVec3d(primvars.translations[i]) : GfVec3d(0.0);
+        EXPECT_EQ(result[i].ExtractTranslation(), expected);
+        EXPECT_EQ(result[i].ExtractRotationMatrix(), GfMatrix3d(1.0));
+    }
+}
+
+// Timing of the composition against the reference one. Disabled by default, run it with
+// --gtest_also_run_disabled_tests; the timings are recorded as test properties.
+TEST(InstanceTransforms, DISABLED_benchmark)
+{
+    for (size_t instanceCount : { 10000, 100000, 1000000 }) {
+        const auto       primvars = createPrimvars(instanceCount, false);
+        const VtIntArray indices = allIndices(instanceCount);
+
+        auto                  start = std::chrono::steady_clock::now();
+        const VtMatrix4dArray expected = composeReference(primvars, indices);
+        const auto            reference = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        HdVP2InstanceTransforms kernel;
+        update(kernel, primvars);
+        VtMatrix4dArray result;
+        kernel.Compose(indices, result);
+        const auto composed = std::chrono::steady_clock::now() - start;
+
+        ASSERT_EQ(result.size(), expected.size());
+        EXPECT_TRUE(GfIsClose(result.back(), expected.back(), 1e-6));
+
+        using std::chrono::microseconds;
+        ::testing::Test::RecordProperty(
+            "reference_us_" + std::to_string(instanceCount),
+            int(std::chrono::duration_cast<microseconds>(reference).count()));
+        ::testing::Test::RecordProperty(
+            "kernel_us_" + std::to_string(instanceCount),
+            int(std::chrono::duration_cast<microseconds>(composed).count()));
+    }
+}
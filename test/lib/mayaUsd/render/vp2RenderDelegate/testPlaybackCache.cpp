@@ -0,0 +1,116 @@
+#include <mayaUsd/render/vp2RenderDelegate/playbackCache.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const SdfPath kMeshPath("/root/mesh");
+const SdfPath kOtherMeshPath("/root/otherMesh");
+
+HdVP2PlaybackCache::Entry createEntry(size_t pointCount, bool withNormals)
+{
+    HdVP2PlaybackCache::Entry entry;
+    entry.points = VtValue(VtVec3fArray(pointCount, GfVec3f(1.0f)));
+    if (withNormals) {
+        entry.normals = VtValue(VtVec3fArray(pointCount, GfVec3f(0.0f, 1.0f, 0.0f)));
+    }
+    return entry;
+}
+
+} // namespace
+
+TEST(PlaybackCache, findsInsertedFrames)
+{
+    HdVP2PlaybackCache cache(1024 * 1024);
+
+    EXPECT_TRUE(cache.Insert(kMeshPath, 1.0, createEntry(8, true)));
+    EXPECT_TRUE(cache.Insert(kMeshPath, 2.0, createEntry(8, false)));
+
+    HdVP2PlaybackCache::Entry entry;
+    ASSERT_TRUE(cache.Find(kMeshPath, 1.0, &entry));
+    EXPECT_EQ(entry.points.Get<VtVec3fArray>().size(), 8u);
+    EXPECT_EQ(entry.normals.Get<VtVec3fArray>().size(), 8u);
+
+    ASSERT_TRUE(cache.Find(kMeshPath, 2.0, &entry));
+    EXPECT_TRUE(entry.normals.IsEmpty());
+
+    EXPECT_FALSE(cache.Find(kMeshPath, 3.0, &entry));
+    EXPECT_FALSE(cache.Find(kOtherMeshPath, 1.0, &entry));
+
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(cache.GetUsedBytes(), 24 * sizeof(GfVec3f));
+}
+
+TEST(PlaybackCache, sharesArrays)
+{
+    HdVP2PlaybackCache cache(1024 * 1024);
+
+    const HdVP2PlaybackCache::Entry inserted = createEntry(8, false);
+    ASSERT_TRUE(cache.Insert(kMeshPath, 1.0, inserted));
+
+    HdVP2PlaybackCache::Entry entry;
+    ASSERT_TRUE(cache.Find(kMeshPath, 1.0, &entry));
+    EXPECT_TRUE(entry.points.UncheckedGet<VtVec3fArray>().IsIdentical(
+        inserted.points.UncheckedGet<VtVec3fArray>()));
+}
+
+TEST(PlaybackCache, replacesFrames)
+{
+    HdVP2PlaybackCache cache(1024 * 1024);
+
+    ASSERT_TRUE(cache.Insert(kMeshPath, 1.0, createEntry(8, false)));
+    ASSERT_TRUE(cache.Insert(kMeshPath, 1.0, createEntry(16, true)));
+
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    EXPECT_EQ(cache.GetUsedBytes(), 32 * sizeof(GfVec3f));
+}
+
+TEST(PlaybackCache, respectsBudget)
+{
+    HdVP2PlaybackCache cache(20 * sizeof(GfVec3f));
+
+    EXPECT_TRUE(cache.Insert(kMeshPath, 1.0, createEntry(10, false)));
+    EXPECT_TRUE(cache.Insert(kMeshPath, 2.0, createEntry(10, false)));
+    EXPECT_FALSE(cache.Insert(kMeshPath, 3.0, createEntry(1, false)));
+
+    // The cached frames are kept when the budget is reached.
+    EXPECT_TRUE(cache.Find(kMeshPath, 1.0, nullptr));
+    EXPECT_TRUE(cache.Find(kMeshPath, 2.0, nullptr));
+    EXPECT_FALSE(cache.Find(kMeshPath, 3.0, nullptr));
+    EXPECT_EQ(cache.GetUsedBytes(), cache.GetBudget());
+}
+
+TEST(PlaybackCache, rejectsUnsupportedData)
+{
+    HdVP2PlaybackCache cache(1024 * 1024);
+
+    HdVP2PlaybackCache::Entry entry;
+    EXPECT_FALSE(cache.Insert(kMeshPath, 1.0, entry));
+
+    entry.points = VtValue(VtVec3dArray(8));
+    EXPECT_FALSE(cache.Insert(kMeshPath, 1.0, entry));
+
+    entry = createEntry(8, false);
+    entry.normals = VtValue(VtFloatArray(8));
+    EXPECT_FALSE(cache.Insert(kMeshPath, 1.0, entry));
+
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+}
+
+TEST(PlaybackCache, clear)
+{
+    HdVP2PlaybackCache cache(1024 * 1024);
+
+    ASSERT_TRUE(cache.Insert(kMeshPath, 1.0, createEntry(8, true)));
+    ASSERT_TRUE(cache.Insert(kOtherMeshPath, 1.0, createEntry(8, true)));
+    cache.Clear();
+
+    EXPECT_FALSE(cache.Find(kMeshPath, 1.0, nullptr));
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+}
@@ -0,0 +1,107 @@
+#include <mayaUsd/render/vp2RenderDelegate/resourceRegistry.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+TEST(ResourceRegistry, commitRunsTasksInOrderOnce)
+{
+    HdVP2ResourceRegistry registry;
+    const std::thread::id commitThread = std::this_thread::get_id();
+
+    std::vector<int> order;
+    bool             otherThread = false;
+    for (int i = 0; i < 100; ++i) {
+        registry.EnqueueCommit([&order, &otherThread, commitThread, i]() {
+            otherThread |= std::this_thread::get_id() != commitThread;
+            order.push_back(i);
+        });
+    }
+    EXPECT_TRUE(order.empty());
+
+    registry.Commit();
+    EXPECT_FALSE(otherThread);
+    ASSERT_EQ(order.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+
+    // The queue is drained, a second commit has nothing to run.
+    registry.Commit();
+    EXPECT_EQ(order.size(), 100u);
+}
+
+TEST(ResourceRegistry, syncScopeIsPerThread)
+{
+    const size_t accessCount = HdVP2ResourceRegistry::GetSyncMayaAccessCount();
+
+    HdVP2ResourceRegistry::SyncScope syncScope;
+    EXPECT_FALSE(HdVP2ResourceRegistry::CanAccessMaya());
+
+    // Another thread is not syncing, its access is allowed and not counted.
+    bool otherThreadAccess = false;
+    std::thread([&otherThreadAccess]() {
+        otherThreadAccess = HdVP2ResourceRegistry::VerifyMayaAccess();
+    }).join();
+    EXPECT_TRUE(otherThreadAccess);
+    EXPECT_EQ(HdVP2ResourceRegistry::GetSyncMayaAccessCount(), accessCount);
+}
+
+TEST(ResourceRegistry, mayaAccessFromSyncIsCounted)
+{
+    const size_t accessCount = HdVP2ResourceRegistry::GetSyncMayaAccessCount();
+    EXPECT_TRUE(HdVP2ResourceRegistry::VerifyMayaAccess());
+
+    {
+        HdVP2ResourceRegistry::SyncScope syncScope;
+        {
+            // Nested syncs, like forced representations, keep the thread flagged.
+            HdVP2ResourceRegistry::SyncScope nestedScope;
+        }
+        EXPECT_FALSE(HdVP2ResourceRegistry::VerifyMayaAccess());
+        EXPECT_FALSE(HdVP2ResourceRegistry::VerifyMayaAccess());
+    }
+
+    EXPECT_TRUE(HdVP2ResourceRegistry::CanAccessMaya());
+    EXPECT_EQ(HdVP2ResourceRegistry::GetSyncMayaAccessCount(), accessCount + 2);
+}
+
+TEST(ResourceRegistry, commitReadsFrameStaging)
+{
+    HdVP2ResourceRegistry registry;
+    HdVP2StagingPool&     pool = registry.GetStagingPool();
+
+    const size_t count = 4096;
+    bool         dataValid = true;
+    auto         syncFrame = [&](float value) {
+        // Staging data written at sync time is read back when the commit runs.
+        for (int rprim = 0; rprim < 16; ++rprim) {
+            HdVP2ResourceRegistry::SyncScope syncScope;
+            float*                           data = pool.AllocateForFrame<float>(count);
+            for (size_t i = 0; i < count; ++i) {
+                data[i] = value + rprim;
+            }
+            registry.EnqueueCommit([&dataValid, data, count, value, rprim]() {
+                for (size_t i = 0; i < count; ++i) {
+                    dataValid &= data[i] == value + rprim;
+                }
+            });
+        }
+        registry.Commit();
+    };
+
+    syncFrame(0.0f);
+    EXPECT_TRUE(dataValid);
+    const size_t allocationCount = pool.GetSystemAllocationCount();
+    EXPECT_EQ(allocationCount, 16u);
+
+    // The commit recycles the frame blocks, the next frames reuse them.
+    for (int frame = 1; frame < 10; ++frame) {
+        syncFrame(static_cast<float>(frame));
+    }
+    EXPECT_TRUE(dataValid);
+    EXPECT_EQ(pool.GetSystemAllocationCount(), allocationCount);
+}
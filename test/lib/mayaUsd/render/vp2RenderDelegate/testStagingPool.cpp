@@ -0,0 +1,146 @@
+#include <mayaUsd/render/vp2RenderDelegate/stagingPool.h>
+
+#include <gtest/gtest.h>
+#include <tbb/parallel_for.h>
+
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Stage the data of a primvar on each of the workers, like an animated frame does.
+void syncFrame(HdVP2StagingPool& pool, size_t primCount, size_t primvarSize)
+{
+    tbb::parallel_for(size_t(0), primCount, [&](size_t prim) {
+        HdVP2StagingVector<int> indices { HdVP2StagingAllocator<int>(pool) };
+        for (size_t i = 0; i < primvarSize; ++i) {
+            indices.push_back(int(prim + i));
+        }
+
+        float* primvar = pool.AllocateForFrame<float>(primvarSize);
+        for (size_t i = 0; i < primvarSize; ++i) {
+            primvar[i] = float(indices[i]);
+        }
+    });
+}
+
+} // namespace
+
+TEST(StagingPool, reusesBlocksAcrossFrames)
+{
+    HdVP2StagingPool pool;
+
+    syncFrame(pool, 1000, 5000);
+    pool.Recycle();
+    const size_t allocationCount = pool.GetSystemAllocationCount();
+    const size_t reservedBytes = pool.GetReservedBytes();
+    EXPECT_GT(allocationCount, 0u);
+
+    // The next frames find all their blocks in the pool.
+    for (int frame = 0; frame < 10; ++frame) {
+        syncFrame(pool, 1000, 5000);
+        pool.Recycle();
+    }
+    // Workers can peak a bit higher than in the first frame, depending on the scheduling.
+    EXPECT_LE(pool.GetSystemAllocationCount(), allocationCount * 2);
+    EXPECT_LE(pool.GetReservedBytes(), reservedBytes * 2);
+}
+
+TEST(StagingPool, frameBlocksLiveUntilRecycle)
+{
+    HdVP2StagingPool pool;
+
+    int* first = pool.AllocateForFrame<int>(100);
+    std::iota(first, first + 100, 0);
+    int* second = pool.AllocateForFrame<int>(100);
+    EXPECT_NE(first, second);
+    std::memset(second, 0, 100 * sizeof(int));
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(first[i], i);
+    }
+
+    pool.Recycle();
+
+    // Both blocks were needed by the last frame, so they are reused.
+    const size_t allocationCount = pool.GetSystemAllocationCount();
+    pool.AllocateForFrame<int>(100);
+    pool.AllocateForFrame<int>(100);
+    EXPECT_EQ(pool.GetSystemAllocationCount(), allocationCount);
+}
+
+TEST(StagingPool, freesUnusedBlocks)
+{
+    HdVP2StagingPool pool;
+
+    pool.AllocateForFrame(1 << 20);
+    pool.AllocateForFrame(1 << 20);
+    pool.Recycle();
+    EXPECT_GE(pool.GetReservedBytes(), size_t(2 << 20));
+
+    // Still kept for one frame without staging...
+    pool.Recycle();
+    EXPECT_GE(pool.GetReservedBytes(), size_t(2 << 20));
+
+    // ...but freed after two.
+    pool.Recycle();
+    EXPECT_EQ(pool.GetReservedBytes(), 0u);
+}
+
+TEST(StagingPool, largeBlocksAreNotPooled)
+{
+    HdVP2StagingPool pool;
+
+    const size_t size = size_t(512) << 20;
+    void*        data = pool.Acquire(size);
+    EXPECT_EQ(pool.GetReservedBytes(), size);
+    pool.Release(data, size);
+    EXPECT_EQ(pool.GetReservedBytes(), 0u);
+}
+
+// Disabled by default, run it with --gtest_also_run_disabled_tests; the timings are recorded as
+// test properties.
+TEST(StagingPool, DISABLED_benchmark)
+{
+    const size_t primCount = 2000;
+    const size_t primvarSize = 20000;
+    const int    frameCount = 20;
+
+    // The staged primvars are kept until the end of the frame, like in the commit state.
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frameCount; ++frame) {
+        std::vector<std::vector<char>> staged(primCount);
+        tbb::parallel_for(size_t(0), primCount, [&](size_t prim) {
+            std::vector<int> indices;
+            for (size_t i = 0; i < primvarSize; ++i) {
+                indices.push_back(int(prim + i));
+            }
+
+            std::vector<char>& primvar = staged[prim];
+            primvar.resize(primvarSize * sizeof(float));
+            float* data = reinterpret_cast<float*>(primvar.data());
+            for (size_t i = 0; i < primvarSize; ++i) {
+                data[i] = float(indices[i]);
+            }
+        });
+    }
+    const auto heap = std::chrono::steady_clock::now() - start;
+
+    HdVP2StagingPool pool;
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frameCount; ++frame) {
+        syncFrame(pool, primCount, primvarSize);
+        pool.Recycle();
+    }
+    const auto pooled = std::chrono::steady_clock::now() - start;
+
+    using std::chrono::milliseconds;
+    ::testing::Test::RecordProperty(
+        "heap_ms", int(std::chrono::duration_cast<milliseconds>(heap).count()));
+    ::testing::Test::RecordProperty(
+        "pool_ms", int(std::chrono::duration_cast<milliseconds>(pooled).count()));
+    ::testing::Test::RecordProperty("system_allocations", int(pool.GetSystemAllocationCount()));
+}
@@ -0,0 +1,136 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2026 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+import usdUtils
+
+from mayaUsd import lib as mayaUsdLib
+
+from maya import cmds
+from maya.api import OpenMaya
+
+from pxr import Gf, UsdGeom, Vt
+
+import ufe
+
+import unittest
+
+
+class testVP2RenderDelegateSyncMayaAccess(unittest.TestCase):
+    """
+    Tests that the Rprims synced in parallel by the Viewport 2.0 render delegate
+    never use the Maya API.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__, initializeStandalone=False, loadPlugin=False)
+
+    def _CreateStage(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+        self._proxyDagPath, stage = mayaUtils.createProxyAndStage()
+
+        mesh = UsdGeom.Mesh.Define(stage, '/Mesh')
+        mesh.CreatePointsAttr(Vt.Vec3fArray(
+            [Gf.Vec3f(-1, -1, 0), Gf.Vec3f(1, -1, 0), Gf.Vec3f(1, 1, 0), Gf.Vec3f(-1, 1, 0)]))
+        mesh.CreateFaceVertexCountsAttr(Vt.IntArray([4]))
+        mesh.CreateFaceVertexIndicesAttr(Vt.IntArray([0, 1, 2, 3]))
+
+        curves = UsdGeom.BasisCurves.Define(stage, '/Curves')
+        curves.CreateTypeAttr(UsdGeom.Tokens.linear)
+        curves.CreatePointsAttr(Vt.Vec3fArray(
+            [Gf.Vec3f(2, 0, 0), Gf.Vec3f(3, 1, 0), Gf.Vec3f(4, 0, 0)]))
+        curves.CreateCurveVertexCountsAttr(Vt.IntArray([3]))
+
+        points = UsdGeom.Points.Define(stage, '/Points')
+        points.CreatePointsAttr(Vt.Vec3fArray([Gf.Vec3f(5, 0, 0), Gf.Vec3f(6, 0, 0)]))
+        points.CreateWidthsAttr(Vt.FloatArray([0.5, 0.5]))
+
+        return stage
+
+    def _GetSceneItem(self, usdPathString):
+        ufePath = ufe.Path([
+            mayaUtils.createUfePathSegment(self._proxyDagPath),
+            usdUtils.createUfePathSegment(usdPathString)])
+        return ufe.Hierarchy.createItem(ufePath)
+
+    def _Refresh(self):
+        cmds.refresh(force=True)
+
+    def testNoMayaAccessFromSync(self):
+        accessCount = mayaUsdLib.GetVP2SyncMayaAccessCount()
+
+        stage = self._CreateStage()
+        panel = mayaUtils.activeModelPanel()
+        cmds.viewFit(all=True)
+
+        # Sync the mesh, curves and points in every display style.
+        for displayAppearance in ['smoothShaded', 'wireframe', 'boundingBox']:
+            cmds.modelEditor(panel, edit=True, displayAppearance=displayAppearance)
+            self._Refresh()
+        cmds.modelEditor(panel, edit=True, displayAppearance='smoothShaded')
+
+        # Selection highlighting reads the selection colors.
+        selection = ufe.Selection()
+        for path in ['/Mesh', '/Curves', '/Points']:
+            selection.append(self._GetSceneItem(path))
+        ufe.GlobalSelection.get().replaceWith(selection)
+        self._Refresh()
+        ufe.GlobalSelection.get().clear()
+        self._Refresh()
+
+        # Edits are synced again.
+        UsdGeom.Points(stage.GetPrimAtPath('/Points')).GetWidthsAttr().Set(
+            Vt.FloatArray([1.0, 1.0]))
+        self._Refresh()
+
+        # Color preference changes query the colors again before syncing.
+        leadColor = cmds.displayRGBColor('lead', query=True)
+        cmds.displayRGBColor('lead', 1.0, 0.0, 0.0)
+        self._Refresh()
+        cmds.displayRGBColor('lead', *leadColor)
+
+        self.assertEqual(mayaUsdLib.GetVP2SyncMayaAccessCount(), accessCount)
+
+    @unittest.skipUnless(hasattr(OpenMaya, 'MFnDisplayLayer'), 'Requires the display layer API.')
+    def testNoMayaAccessFromSyncWithDisplayLayers(self):
+        accessCount = mayaUsdLib.GetVP2SyncMayaAccessCount()
+
+        self._CreateStage()
+        cmds.viewFit(all=True)
+
+        # Display layer colors from the palette and template or reference display types.
+        cmds.createDisplayLayer(name='layer1', noRecurse=True, empty=True)
+        selectionList = OpenMaya.MSelectionList()
+        selectionList.add('layer1')
+        displayLayer = OpenMaya.MFnDisplayLayer(selectionList.getDependNode(0))
+        for path in ['/Mesh', '/Curves', '/Points']:
+            displayLayer.add(self._proxyDagPath + ',' + path)
+
+        cmds.setAttr('layer1.color', 13)
+        self._Refresh()
+        for displayType in [1, 2]:
+            cmds.setAttr('layer1.displayType', displayType)
+            self._Refresh()
+
+        self.assertEqual(mayaUsdLib.GetVP2SyncMayaAccessCount(), accessCount)
+
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
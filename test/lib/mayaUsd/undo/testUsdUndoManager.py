@@ -148,6 +148,32 @@ class TestUsdUndoManager(unittest.TestCase):
         # check number of children under the root
         self.assertEqual(len(defaultPrim.GetChildren()), 1)
 
+    def testCoalescedEdits(self):
+        '''
+            Test that repeated edits of the same value in a block only keep
+            the inverse that restores the original value.
+        '''
+        # start with a new file
+        cmds.file(force=True, new=True)
+
+        prim = self.stage.DefinePrim('/World', 'Sphere')
+        radiusAttr = UsdGeom.Sphere(prim).GetRadiusAttr()
+        radiusAttr.Set(1.0)
+
+        undoItem = mayaUsdLib.UsdUndoableItem()
+        with mayaUsdLib.UsdUndoBlock(undoItem):
+            for i in range(100):
+                radiusAttr.Set(2.0 + i)
+
+        self.assertEqual(radiusAttr.Get(), 101.0)
+        self.assertEqual(undoItem.getEditCount(), 1)
+
+        undoItem.undo()
+        self.assertEqual(radiusAttr.Get(), 1.0)
+
+        undoItem.redo()
+        self.assertEqual(radiusAttr.Get(), 101.0)
+
     def testRemovePrims(self):
         '''
             Test delete prims
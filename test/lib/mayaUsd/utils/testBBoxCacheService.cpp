@@ -0,0 +1,203 @@
+#include <usdUfe/utils/bboxCacheService.h>
+
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/cube.h>
+#include <pxr/usd/usdGeom/points.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const TfTokenVector defaultPurposes { UsdGeomTokens->default_ };
+
+// Define a unit cube under a translated xform.
+UsdGeomXformOp defineTranslatedCube(const UsdStageRefPtr& stage, const std::string& name)
+{
+    auto xform = UsdGeomXform::Define(stage, SdfPath("/" + name));
+    auto cube = UsdGeomCube::Define(stage, SdfPath("/" + name + "/cube"));
+    cube.CreateSizeAttr(VtValue(2.0));
+    cube.CreateExtentAttr(VtValue(VtVec3fArray { GfVec3f(-1.0f), GfVec3f(1.0f) }));
+    return xform.AddTranslateOp();
+}
+
+GfRange3d worldRange(const UsdPrim& prim, const UsdTimeCode& time)
+{
+    return UsdUfe::BBoxCacheService::instance()
+        .computeWorldBound(prim, time, defaultPurposes)
+        .ComputeAlignedRange();
+}
+
+} // namespace
+
+TEST(BBoxCacheService, timeChange)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto translateOp = defineTranslatedCube(stage, "xform");
+    translateOp.Set(GfVec3d(0.0), UsdTimeCode(1.0));
+    translateOp.Set(GfVec3d(10.0, 0.0, 0.0), UsdTimeCode(2.0));
+
+    const UsdPrim cube = stage->GetPrimAtPath(SdfPath("/xform/cube"));
+    EXPECT_EQ(worldRange(cube, UsdTimeCode(1.0)), GfRange3d(GfVec3d(-1.0), GfVec3d(1.0)));
+    EXPECT_EQ(
+        worldRange(cube, UsdTimeCode(2.0)),
+        GfRange3d(GfVec3d(9.0, -1.0, -1.0), GfVec3d(11.0, 1.0, 1.0)));
+
+    // Going back in time does not reuse the bounds of the last queried time.
+    EXPECT_EQ(worldRange(cube, UsdTimeCode(1.0)), GfRange3d(GfVec3d(-1.0), GfVec3d(1.0)));
+
+    // Playing more frames than the caches kept per stage.
+    for (int frame = 0; frame < 100; ++frame) {
+        const double x = frame * 10.0;
+        translateOp.Set(GfVec3d(x, 0.0, 0.0), UsdTimeCode(100.0 + frame));
+        EXPECT_EQ(
+            worldRange(cube, UsdTimeCode(100.0 + frame)),
+            GfRange3d(GfVec3d(x - 1.0, -1.0, -1.0), GfVec3d(x + 1.0, 1.0, 1.0)));
+    }
+}
+
+TEST(BBoxCacheService, defaultTime)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto translateOp = defineTranslatedCube(stage, "xform");
+    translateOp.Set(GfVec3d(0.0, 5.0, 0.0));
+    translateOp.Set(GfVec3d(0.0), UsdTimeCode(1.0));
+
+    // The default time is its own bucket, the numeric times don't evict it.
+    const UsdPrim   cube = stage->GetPrimAtPath(SdfPath("/xform/cube"));
+    const GfRange3d defaultRange(GfVec3d(-1.0, 4.0, -1.0), GfVec3d(1.0, 6.0, 1.0));
+    EXPECT_EQ(worldRange(cube, UsdTimeCode::Default()), defaultRange);
+    for (int frame = 0; frame < 20; ++frame) {
+        translateOp.Set(GfVec3d(frame, 0.0, 0.0), UsdTimeCode(frame));
+        EXPECT_EQ(
+            worldRange(cube, UsdTimeCode(frame)),
+            GfRange3d(GfVec3d(frame - 1.0, -1.0, -1.0), GfVec3d(frame + 1.0, 1.0, 1.0)));
+        EXPECT_EQ(worldRange(cube, UsdTimeCode::Default()), defaultRange);
+    }
+}
+
+TEST(BBoxCacheService, stageEdits)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto translateOp = defineTranslatedCube(stage, "xform");
+    translateOp.Set(GfVec3d(0.0));
+
+    const UsdPrim xform = stage->GetPrimAtPath(SdfPath("/xform"));
+    const UsdPrim cube = stage->GetPrimAtPath(SdfPath("/xform/cube"));
+    const auto    time = UsdTimeCode::Default();
+    EXPECT_EQ(worldRange(xform, time), GfRange3d(GfVec3d(-1.0), GfVec3d(1.0)));
+
+    // Transform edit.
+    translateOp.Set(GfVec3d(0.0, 5.0, 0.0));
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-1.0, 4.0, -1.0), GfVec3d(1.0, 6.0, 1.0)));
+
+    // Extent edit.
+    UsdGeomCube(cube).GetExtentAttr().Set(VtVec3fArray { GfVec3f(-2.0f), GfVec3f(2.0f) });
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-2.0, 3.0, -2.0), GfVec3d(2.0, 7.0, 2.0)));
+
+    // Primvar edits don't change the bounds.
+    UsdGeomPrimvarsAPI(cube)
+        .CreatePrimvar(TfToken("displayOpacity"), SdfValueTypeNames->FloatArray)
+        .Set(VtFloatArray { 0.5f });
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-2.0, 3.0, -2.0), GfVec3d(2.0, 7.0, 2.0)));
+
+    // The widths primvar changes the extent of points.
+    auto points = UsdGeomPoints::Define(stage, SdfPath("/points"));
+    points.CreatePointsAttr(VtValue(VtVec3fArray { GfVec3f(0.0f) }));
+    points.CreateWidthsAttr(VtValue(VtFloatArray { 2.0f }));
+    EXPECT_EQ(worldRange(points.GetPrim(), time), GfRange3d(GfVec3d(-1.0), GfVec3d(1.0)));
+    points.GetWidthsAttr().Set(VtFloatArray { 4.0f });
+    EXPECT_EQ(worldRange(points.GetPrim(), time), GfRange3d(GfVec3d(-2.0), GfVec3d(2.0)));
+
+    // New prim.
+    auto other = UsdGeomCube::Define(stage, SdfPath("/xform/other"));
+    other.CreateExtentAttr(VtValue(VtVec3fArray { GfVec3f(-1.0f), GfVec3f(1.0f) }));
+    other.AddTranslateOp().Set(GfVec3d(0.0, 0.0, 10.0));
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-2.0, 3.0, -2.0), GfVec3d(2.0, 7.0, 11.0)));
+
+    // Removed prim.
+    stage->RemovePrim(SdfPath("/xform/other"));
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-2.0, 3.0, -2.0), GfVec3d(2.0, 7.0, 2.0)));
+
+    // Explicitly cleared stage.
+    UsdUfe::BBoxCacheService::instance().clearStage(stage);
+    EXPECT_EQ(
+        worldRange(xform, time), GfRange3d(GfVec3d(-2.0, 3.0, -2.0), GfVec3d(2.0, 7.0, 2.0)));
+}
+
+TEST(BBoxCacheService, relativeTransform)
+{
+    auto stage = UsdStage::CreateInMemory();
+    auto translateOp = defineTranslatedCube(stage, "xform");
+    translateOp.Set(GfVec3d(1.0, 2.0, 3.0));
+    UsdGeomXformable(stage->GetPrimAtPath(SdfPath("/xform/cube")))
+        .AddTranslateOp()
+        .Set(GfVec3d(10.0, 0.0, 0.0));
+
+    auto&         service = UsdUfe::BBoxCacheService::instance();
+    const UsdPrim cube = stage->GetPrimAtPath(SdfPath("/xform/cube"));
+    const UsdPrim xform = stage->GetPrimAtPath(SdfPath("/xform"));
+    const auto    time = UsdTimeCode::Default();
+
+    EXPECT_EQ(
+        service.computeRelativeTransform(cube, stage->GetPseudoRoot(), time)
+            .ExtractTranslation(),
+        GfVec3d(11.0, 2.0, 3.0));
+    EXPECT_EQ(
+        service.computeRelativeTransform(cube, xform, time).ExtractTranslation(),
+        GfVec3d(10.0, 0.0, 0.0));
+
+    translateOp.Set(GfVec3d(0.0));
+    EXPECT_EQ(
+        service.computeRelativeTransform(cube, stage->GetPseudoRoot(), time)
+            .ExtractTranslation(),
+        GfVec3d(10.0, 0.0, 0.0));
+}
+
+TEST(BBoxCacheService, concurrentStages)
+{
+    // Each thread queries its own stage, with its own lock.
+    const int                   stageCount = 8;
+    std::vector<UsdStageRefPtr> stages;
+    std::vector<UsdGeomXformOp> translateOps;
+    for (int i = 0; i < stageCount; ++i) {
+        stages.push_back(UsdStage::CreateInMemory());
+        translateOps.push_back(defineTranslatedCube(stages.back(), "xform"));
+        translateOps.back().Set(GfVec3d(i, 0.0, 0.0));
+    }
+
+    std::vector<int>         errors(stageCount, 0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < stageCount; ++i) {
+        threads.emplace_back([&stages, &errors, i]() {
+            const UsdPrim   prim = stages[i]->GetPrimAtPath(SdfPath("/xform"));
+            const GfRange3d expected(GfVec3d(i - 1.0, -1.0, -1.0), GfVec3d(i + 1.0, 1.0, 1.0));
+            for (int query = 0; query < 1000; ++query) {
+                if (worldRange(prim, UsdTimeCode::Default()) != expected)
+                    ++errors[i];
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int i = 0; i < stageCount; ++i)
+        EXPECT_EQ(errors[i], 0);
+}
@@ -0,0 +1,168 @@
+#include <usdUfe/base/tokens.h>
+#include <usdUfe/utils/editRouter.h>
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Edit router that routes every edit to a fixed layer and counts how many
+// times it was invoked, either per item or per batch.
+class CountingEditRouter : public UsdUfe::EditRouter
+{
+public:
+    CountingEditRouter(const SdfLayerHandle& layer)
+        : _layer(layer)
+    {
+    }
+
+    void operator()(const VtDictionary& context, VtDictionary& routingData) override
+    {
+        ++itemCalls;
+        routingData[UsdUfe::EditRoutingTokens->Layer] = VtValue(_layer);
+    }
+
+    void routeBatch(
+        const std::vector<VtDictionary>& contexts,
+        std::vector<VtDictionary>&       routingData) override
+    {
+        ++batchCalls;
+        routingData.resize(contexts.size());
+        for (auto& data : routingData)
+            data[UsdUfe::EditRoutingTokens->Layer] = VtValue(_layer);
+    }
+
+    void setLayer(const SdfLayerHandle& layer) { _layer = layer; }
+
+    size_t itemCalls = 0;
+    size_t batchCalls = 0;
+
+private:
+    SdfLayerHandle _layer;
+};
+
+UsdStageRefPtr createStageWithPrims(size_t primCount, std::vector<UsdPrim>& prims)
+{
+    auto stage = UsdStage::CreateInMemory();
+    for (size_t i = 0; i < primCount; ++i)
+        prims.push_back(stage->DefinePrim(SdfPath("/prim" + std::to_string(i))));
+    return stage;
+}
+
+} // namespace
+
+TEST(EditRouterBatch, batchedAttrRoutingCallsRouterOnce)
+{
+    std::vector<UsdPrim> prims;
+    auto                 stage = createStageWithPrims(10, prims);
+    auto                 layer = SdfLayer::CreateAnonymous();
+
+    auto router = std::make_shared<CountingEditRouter>(layer);
+    UsdUfe::registerEditRouter(UsdUfe::EditRoutingTokens->RouteAttribute, router);
+
+    UsdUfe::EditRouterRequests requests;
+    for (const auto& prim : prims)
+        requests.push_back({ prim, TfToken("visibility") });
+
+    auto layers = UsdUfe::getAttrEditRouterLayers(requests);
+    ASSERT_EQ(layers.size(), prims.size());
+    for (const auto& routed : layers)
+        EXPECT_EQ(routed, layer);
+    EXPECT_EQ(router->batchCalls, 1u);
+    EXPECT_EQ(router->itemCalls, 0u);
+
+    // Per-item routing of the same attributes is served from the cache.
+    for (const auto& prim : prims)
+        EXPECT_EQ(UsdUfe::getAttrEditRouterLayer(prim, TfToken("visibility")), layer);
+    EXPECT_EQ(router->itemCalls, 0u);
+
+    // A different attribute is not cached.
+    EXPECT_EQ(UsdUfe::getAttrEditRouterLayer(prims[0], TfToken("radius")), layer);
+    EXPECT_EQ(router->itemCalls, 1u);
+
+    UsdUfe::restoreAllDefaultEditRouters();
+}
+
+TEST(EditRouterBatch, cacheInvalidation)
+{
+    std::vector<UsdPrim> prims;
+    auto                 stage = createStageWithPrims(4, prims);
+    auto                 layer = SdfLayer::CreateAnonymous();
+    auto                 otherLayer = SdfLayer::CreateAnonymous();
+    auto                 subLayer = SdfLayer::CreateAnonymous();
+    stage->GetRootLayer()->InsertSubLayerPath(subLayer->GetIdentifier());
+
+    auto router = std::make_shared<CountingEditRouter>(layer);
+    UsdUfe::registerEditRouter(UsdUfe::EditRoutingTokens->RouteTransform, router);
+
+    UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteTransform, prims);
+    UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteTransform, prims);
+    EXPECT_EQ(router->batchCalls, 1u);
+
+    // Changing the edit target discards the results of the stage.
+    stage->SetEditTarget(subLayer);
+    UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteTransform, prims);
+    EXPECT_EQ(router->batchCalls, 2u);
+
+    // So does editing the stage, the router can depend on its content.
+    router->setLayer(otherLayer);
+    stage->DefinePrim(SdfPath("/other"));
+    auto layers = UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteTransform, prims);
+    EXPECT_EQ(router->batchCalls, 3u);
+    for (const auto& routed : layers)
+        EXPECT_EQ(routed, otherLayer);
+
+    // Routers depending on other state need an explicit clear.
+    UsdUfe::clearEditRouterCache();
+    UsdUfe::getEditRouterLayers(UsdUfe::EditRoutingTokens->RouteTransform, prims);
+    EXPECT_EQ(router->batchCalls, 4u);
+
+    UsdUfe::restoreAllDefaultEditRouters();
+}
+
+// Disabled by default, run it with --gtest_also_run_disabled_tests; the timings are recorded as
+// test properties.
+TEST(EditRouterBatch, DISABLED_benchmarkPerItemVersusBatched)
+{
+    const size_t primCount = 10000;
+
+    std::vector<UsdPrim> prims;
+    auto                 stage = createStageWithPrims(primCount, prims);
+    auto                 layer = SdfLayer::CreateAnonymous();
+
+    auto router = std::make_shared<CountingEditRouter>(layer);
+    UsdUfe::registerEditRouter(UsdUfe::EditRoutingTokens->RouteAttribute, router);
+
+    const TfToken attrName("visibility");
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& prim : prims)
+        UsdUfe::getAttrEditRouterLayer(prim, attrName);
+    const auto perItem = std::chrono::steady_clock::now() - start;
+
+    UsdUfe::EditRouterRequests requests;
+    for (const auto& prim : prims)
+        requests.push_back({ prim, attrName });
+
+    start = std::chrono::steady_clock::now();
+    UsdUfe::getAttrEditRouterLayers(requests);
+    const auto batched = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(router->itemCalls, primCount);
+    EXPECT_EQ(router->batchCalls, 1u);
+
+    using std::chrono::microseconds;
+    ::testing::Test::RecordProperty(
+        "per_item_us", int(std::chrono::duration_cast<microseconds>(perItem).count()));
+    ::testing::Test::RecordProperty(
+        "batched_us", int(std::chrono::duration_cast<microseconds>(batched).count()));
+
+    UsdUfe::restoreAllDefaultEditRouters();
+}
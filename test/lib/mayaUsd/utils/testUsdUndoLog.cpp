@@ -0,0 +1,166 @@
+#include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/undo/UsdUndoLog.h>
+#include <usdUfe/undo/UsdUndoManager.h>
+#include <usdUfe/undo/UsdUndoableItem.h>
+
+#include <pxr/base/tf/getenv.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+UsdStageRefPtr createTrackedStage()
+{
+    auto stage = UsdStage::CreateInMemory();
+    UsdUfe::UsdUndoManager::instance().trackLayerStates(stage->GetRootLayer());
+    return stage;
+}
+
+VtFloatArray makeArray(std::size_t size, float value)
+{
+    // Constant arrays compress well, which the compression test relies on.
+    return VtFloatArray(size, value);
+}
+
+} // namespace
+
+TEST(UsdUndoLog, invertFuncsAcrossChunks)
+{
+    // Enough records to span several chunks, with a partially used last one.
+    const int        recordCount = 5000;
+    std::vector<int> calls;
+
+    UsdUfe::UsdUndoLog log;
+    for (int i = 0; i < recordCount; ++i)
+        log.addInvertFunc([&calls, i]() { calls.push_back(i); });
+    ASSERT_EQ(log.size(), static_cast<std::size_t>(recordCount));
+
+    log.compact();
+    ASSERT_TRUE(log.invert());
+    ASSERT_EQ(calls.size(), static_cast<std::size_t>(recordCount));
+    for (int i = 0; i < recordCount; ++i)
+        ASSERT_EQ(calls[i], recordCount - 1 - i);
+
+    // Records added after compaction go after the existing ones.
+    log.addInvertFunc([&calls]() { calls.push_back(-1); });
+    calls.clear();
+    ASSERT_TRUE(log.invert());
+    ASSERT_EQ(calls.size(), static_cast<std::size_t>(recordCount + 1));
+    ASSERT_EQ(calls.front(), -1);
+    ASSERT_EQ(calls.back(), 0);
+}
+
+TEST(UsdUndoLog, appendAcrossChunks)
+{
+    std::vector<int> calls;
+
+    UsdUfe::UsdUndoLog first;
+    for (int i = 0; i < 20; ++i)
+        first.addInvertFunc([&calls, i]() { calls.push_back(i); });
+
+    UsdUfe::UsdUndoLog second;
+    for (int i = 20; i < 100; ++i)
+        second.addInvertFunc([&calls, i]() { calls.push_back(i); });
+
+    first.append(second);
+    ASSERT_EQ(first.size(), 100u);
+
+    ASSERT_TRUE(first.invert());
+    ASSERT_EQ(calls.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(calls[i], 99 - i);
+}
+
+TEST(UsdUndoLog, undoRedoAcrossChunks)
+{
+    auto stage = createTrackedStage();
+
+    // One value record per attribute, spanning several chunks.
+    const int                 attrCount = 300;
+    std::vector<UsdAttribute> attrs;
+    for (int i = 0; i < attrCount; ++i) {
+        UsdPrim prim = stage->DefinePrim(SdfPath("/prim" + std::to_string(i)));
+        attrs.push_back(prim.CreateAttribute(TfToken("value"), SdfValueTypeNames->Int));
+        attrs.back().Set(-1);
+    }
+
+    UsdUfe::UsdUndoableItem item;
+    {
+        UsdUfe::UsdUndoBlock undoBlock(&item);
+        for (int i = 0; i < attrCount; ++i) {
+            // Only the first of these edits is kept once coalesced.
+            attrs[i].Set(i);
+            attrs[i].Set(i * 2);
+        }
+    }
+    ASSERT_EQ(item.getEditCount(), static_cast<std::size_t>(attrCount));
+
+    item.undo();
+    for (int i = 0; i < attrCount; ++i) {
+        int value = 0;
+        ASSERT_TRUE(attrs[i].Get(&value));
+        ASSERT_EQ(value, -1);
+    }
+
+    item.redo();
+    for (int i = 0; i < attrCount; ++i) {
+        int value = 0;
+        ASSERT_TRUE(attrs[i].Get(&value));
+        ASSERT_EQ(value, i * 2);
+    }
+}
+
+TEST(UsdUndoLog, undoRedoArrayValues)
+{
+    // Also run with USDUFE_UNDO_COMPRESSION_THRESHOLD set, to cover the
+    // compressed values, see the testUsdUndoLogCompressed test.
+    const int threshold = TfGetenvInt("USDUFE_UNDO_COMPRESSION_THRESHOLD", 0);
+
+    auto         stage = createTrackedStage();
+    UsdPrim      prim = stage->DefinePrim(SdfPath("/prim"));
+    UsdAttribute attr = prim.CreateAttribute(TfToken("values"), SdfValueTypeNames->FloatArray);
+
+    const VtFloatArray original = makeArray(4096, 1.0f);
+    const VtFloatArray edited = makeArray(4096, 2.0f);
+    attr.Set(original);
+    attr.Set(original, UsdTimeCode(1.0));
+
+    UsdUfe::UsdUndoableItem item;
+    {
+        UsdUfe::UsdUndoBlock undoBlock(&item);
+        attr.Set(edited);
+        attr.Set(edited, UsdTimeCode(1.0));
+    }
+
+    VtFloatArray value;
+    ASSERT_TRUE(attr.Get(&value));
+    ASSERT_EQ(value, edited);
+
+    item.undo();
+    ASSERT_TRUE(attr.Get(&value));
+    ASSERT_EQ(value, original);
+    ASSERT_TRUE(attr.Get(&value, UsdTimeCode(1.0)));
+    ASSERT_EQ(value, original);
+
+    item.redo();
+    ASSERT_TRUE(attr.Get(&value));
+    ASSERT_EQ(value, edited);
+    ASSERT_TRUE(attr.Get(&value, UsdTimeCode(1.0)));
+    ASSERT_EQ(value, edited);
+
+    // The array values are kept compressed only above the threshold.
+    UsdUfe::UsdUndoLog log;
+    log.addSetField(nullptr, prim.GetPath(), TfToken("default"), VtValue(original));
+    log.addSetField(nullptr, prim.GetPath(), TfToken("default"), VtValue(makeArray(2, 1.0f)));
+    ASSERT_EQ(log.compressedValueCount(), threshold > 0 ? 1u : 0u);
+}
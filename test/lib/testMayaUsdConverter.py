@@ -251,3 +251,120 @@ class MayaUsdConverterTestCase(unittest.TestCase):
         self.runTypeChecks(sdfValueType,value1,value2)
         self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
         
+
+    def testFloatArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.FloatArray
+        """
+        #
+        value1 = Vt.FloatArray([1.0, 2.5, 3.0, 4.5, 5.0])
+        value2 = Vt.FloatArray([6.0, 7.5])
+        sdfValueType = Sdf.ValueTypeNames.FloatArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testDoubleArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.DoubleArray
+        """
+        #
+        value1 = Vt.DoubleArray([1.0, 2.5, 3.0, 4.5, 5.0])
+        value2 = Vt.DoubleArray([6.0, 7.5])
+        sdfValueType = Sdf.ValueTypeNames.DoubleArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testPoint3dArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.Point3dArray
+        """
+        #
+        value1 = Vt.Vec3dArray([Gf.Vec3d(1.0, 2.0, 3.0), Gf.Vec3d(4.0, 5.0, 6.0), Gf.Vec3d(7.0, 8.0, 9.0)])
+        value2 = Vt.Vec3dArray([Gf.Vec3d(-1.0, -2.0, -3.0)])
+        sdfValueType = Sdf.ValueTypeNames.Point3dArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testVector3dArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.Vector3dArray
+        """
+        #
+        value1 = Vt.Vec3dArray([Gf.Vec3d(1.0, 2.0, 3.0), Gf.Vec3d(4.0, 5.0, 6.0), Gf.Vec3d(7.0, 8.0, 9.0)])
+        value2 = Vt.Vec3dArray([Gf.Vec3d(-1.0, -2.0, -3.0)])
+        sdfValueType = Sdf.ValueTypeNames.Vector3dArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testPoint3fArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.Point3fArray
+        """
+        #
+        value1 = Vt.Vec3fArray([Gf.Vec3f(1.0, 2.0, 3.0), Gf.Vec3f(4.0, 5.0, 6.0), Gf.Vec3f(7.0, 8.0, 9.0),
+                                Gf.Vec3f(10.5, 11.5, 12.5), Gf.Vec3f(-13.0, -14.0, -15.0)])
+        value2 = Vt.Vec3fArray([Gf.Vec3f(-1.0, -2.0, -3.0)])
+        sdfValueType = Sdf.ValueTypeNames.Point3fArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testVector3fArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.Vector3fArray
+        """
+        #
+        value1 = Vt.Vec3fArray([Gf.Vec3f(1.0, 2.0, 3.0), Gf.Vec3f(4.0, 5.0, 6.0), Gf.Vec3f(7.0, 8.0, 9.0),
+                                Gf.Vec3f(10.5, 11.5, 12.5), Gf.Vec3f(-13.0, -14.0, -15.0)])
+        value2 = Vt.Vec3fArray([Gf.Vec3f(-1.0, -2.0, -3.0)])
+        sdfValueType = Sdf.ValueTypeNames.Vector3fArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testConverterLookupCache(self):
+        """
+        Test the cache of the converters found for a pair of Maya plug and Usd attribute.
+        """
+        cmds.file(new=True, force=True)
+        stage = self.createStage("layerLookupCache")
+        plug, attr = self.createMPlugAndUsdAttribute(Sdf.ValueTypeNames.FloatArray, "group1", stage, "/Foo")
+
+        # Repeated lookups are answered by the cache
+        self.assertNotEqual(mayaUsdLib.Converter.find(plug, attr), None)
+        hitCount = mayaUsdLib.Converter.test_getLookupCacheHitCount()
+        self.assertNotEqual(mayaUsdLib.Converter.find(plug, attr), None)
+        self.assertEqual(mayaUsdLib.Converter.test_getLookupCacheHitCount(), hitCount + 1)
+
+        # A Usd attribute of another type is looked up separately
+        pointsAttr = stage.GetPrimAtPath("/Foo").CreateAttribute("points", Sdf.ValueTypeNames.Point3fArray)
+        self.assertEqual(mayaUsdLib.Converter.find(plug, pointsAttr), None)
+        self.assertEqual(mayaUsdLib.Converter.test_getLookupCacheHitCount(), hitCount + 1)
+
+        # A deleted attribute is not found in the cache, even when it is recreated with another type
+        nodeName, attrName = plug.split('.')
+        cmds.deleteAttr(plug)
+        plug = mayaUsdLib.ReadUtil.FindOrCreateMayaAttr(
+            Sdf.ValueTypeNames.Point3fArray,
+            Sdf.VariabilityUniform,
+            nodeName,
+            attrName)
+        converter = mayaUsdLib.Converter.find(plug, pointsAttr)
+        self.assertNotEqual(converter, None)
+        self.assertEqual(mayaUsdLib.Converter.test_getLookupCacheHitCount(), hitCount + 1)
+        self.assertTrue(converter.validate(plug, pointsAttr))
+        self.assertEqual(mayaUsdLib.Converter.find(plug, attr), None)
+
+        # The new attribute is cached in turn
+        self.assertNotEqual(mayaUsdLib.Converter.find(plug, pointsAttr), None)
+        self.assertEqual(mayaUsdLib.Converter.test_getLookupCacheHitCount(), hitCount + 2)
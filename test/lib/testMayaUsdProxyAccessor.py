@@ -1303,3 +1303,27 @@ class MayaUsdProxyAccessorTestCase(unittest.TestCase):
         # and invalid attribute pointer for the attribute forceCompute which
         # would cause a crash when hiding the duplicated proxy shape.
         cmds.hide(duplicatedProxyShape)
+
+    def testBatchedStageChanges(self):
+        """
+        Validate that input accessor plugs on several prims are all updated when their
+        USD attributes are changed together.
+        """
+        cmds.file(new=True, force=True)
+        nodeDagPath, stage = createProxyFromFile(self.testAnimatedHierarchyUsdFile)
+
+        inputPlugs = []
+        for primPath in ['/ParentA', '/ParentA/Sphere', '/ParentA/Cube']:
+            ufeItem = createUfeSceneItem(nodeDagPath, primPath)
+            plug = pa.getOrCreateAccessPlug(ufeItem, usdAttrName='xformOp:translate')
+            cmds.setKeyframe('{}.{}'.format(nodeDagPath, plug), time=1.0, value=0.0)
+            inputPlugs.append((primPath, plug))
+        cmds.currentTime(1)
+
+        with Sdf.ChangeBlock():
+            for index, (primPath, _) in enumerate(inputPlugs):
+                attr = stage.GetPrimAtPath(primPath).GetAttribute('xformOp:translate')
+                attr.Set((float(index), 2.0, 3.0), Usd.TimeCode.Default())
+
+        self.validatePlugsEqual(nodeDagPath,
+            [(plug, (float(index), 2.0, 3.0)) for index, (_, plug) in enumerate(inputPlugs)])